@@ -22,12 +22,27 @@ using boost::asio::ip::udp;
 #include <arpa/inet.h>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+// JSONDispatcher
+//	Broadcasts prescaled events as JSON over UDP.
+//	The JSON is written into a reused string buffer and, if send_queue_size > 0,
+//	handed to a sender thread through a bounded queue, so a slow network never
+//	stalls the art thread; messages are dropped (and counted) when the queue is full.
+//	With events_per_datagram > 1, several events are coalesced into one datagram
+//	as a JSON array, sent when full, too big, or older than coalesce_timeout_ms
+//	(checked by the sender thread, so a batch is not held until the next event).
+//	Fragments of packed datagrams (see UDPFragment::packet_count()) have one
+//	data element per datagram.
 namespace ots
 {
 class JSONDispatcher : public art::EDAnalyzer
@@ -38,14 +53,42 @@ class JSONDispatcher : public art::EDAnalyzer
 
 	virtual void analyze(art::Event const& evt) override;
 	virtual void beginRun(art::Run const& run) override;
+	virtual void endRun(art::Run const& run) override;
 
   private:
+	void appendEventJSON_(art::Event const& evt, artdaq::Fragments const& fragments);
+	void appendDataJSON_(int type, uint8_t const* data, size_t size);
+	void dispatch_();
+	void sendLoop_();
+
 	int                     prescale_;
 	std::string             raw_data_label_;
 	std::string             frag_type_;
 	boost::asio::io_service io_service_;
 	udp::socket             socket_;
 	udp::endpoint           remote_endpoint_;
+
+	// JSON writer and coalescing, batch members are protected by batchMutex_
+	std::mutex                            batchMutex_;
+	const size_t                          sendQueueSize_;  // 0 to send synchronously (from the art thread, or sender thread on coalesce timeout)
+	const unsigned int                    eventsPerDatagram_;
+	const size_t                          maxDatagramSize_;
+	const std::chrono::milliseconds       coalesceTimeout_;
+	const size_t                          writerReserveSize_;
+	std::string                           jsonWriter_;
+	unsigned int                          batchedEvents_;
+	std::chrono::steady_clock::time_point firstBatchedEventTime_;
+
+	// sender thread, members are protected by sendQueueMutex_
+	std::mutex                            sendQueueMutex_;
+	std::condition_variable               sendQueueCondition_;
+	std::deque<std::string>               sendQueue_;
+	std::vector<std::string>              spareBuffers_;  // sent messages, reused as writer buffers
+	bool                                  batchPending_;  // coalesced events are waiting, flush at batchDeadline_
+	std::chrono::steady_clock::time_point batchDeadline_;
+	bool                                  sendThreadRunning_;
+	std::thread                           sendThread_;
+	unsigned long long                    droppedMessages_;
 };
 
 }  // namespace ots
@@ -57,6 +100,15 @@ ots::JSONDispatcher::JSONDispatcher(fhicl::ParameterSet const& pset)
     , frag_type_(pset.get<std::string>("frag_type", "UDP"))
     , io_service_()
     , socket_(io_service_, udp::v4())
+    , sendQueueSize_(pset.get<size_t>("send_queue_size", 64))
+    , eventsPerDatagram_(std::max(pset.get<unsigned int>("events_per_datagram", 1), 1u))
+    , maxDatagramSize_(pset.get<size_t>("max_datagram_size", 65000))
+    , coalesceTimeout_(pset.get<unsigned int>("coalesce_timeout_ms", 500))
+    , writerReserveSize_(pset.get<size_t>("json_buffer_reserve", 0x10000))
+    , batchedEvents_(0)
+    , batchPending_(false)
+    , sendThreadRunning_(false)
+    , droppedMessages_(0)
 {
 	std::cout << __COUT_HDR_FL__ << "JSONDispatcher Constructor Start" << std::endl;
 	int port = pset.get<int>("port", 35555);
@@ -80,129 +132,333 @@ ots::JSONDispatcher::JSONDispatcher(fhicl::ParameterSet const& pset)
 	// std::cout << __COUT_HDR_FL__ << "JSONDispatcher gettting UDP endpoint" <<
 	// std::endl;
 	remote_endpoint_ = udp::endpoint(boost::asio::ip::address_v4::broadcast(), port);
-	std::cout << __COUT_HDR_FL__ << "JSONDispatcher Constructor End" << std::endl;
+
+	jsonWriter_.reserve(writerReserveSize_);
+	if(sendQueueSize_ || eventsPerDatagram_ > 1)  // sender thread also flushes coalesced events on timeout
+	{
+		spareBuffers_.reserve(sendQueueSize_ + 1);
+		sendThreadRunning_ = true;
+		sendThread_        = std::thread(&JSONDispatcher::sendLoop_, this);
+	}
+	std::cout << __COUT_HDR_FL__ << "JSONDispatcher Constructor End, send queue size = " << sendQueueSize_
+	          << ", events per datagram = " << eventsPerDatagram_ << std::endl;
 }
 
-ots::JSONDispatcher::~JSONDispatcher() {}
+ots::JSONDispatcher::~JSONDispatcher()
+{
+	{
+		std::lock_guard<std::mutex> lock(batchMutex_);
+		if(batchedEvents_)
+			dispatch_();
+	}
+
+	if(sendThread_.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(sendQueueMutex_);
+			sendThreadRunning_ = false;
+		}
+		sendQueueCondition_.notify_one();
+		sendThread_.join();  // sends anything still queued
+	}
+	if(droppedMessages_)
+		TLOG(TLVL_WARNING, "JSONDispatcher") << "Dropped " << droppedMessages_ << " JSON messages because the send queue was full.";
+}
 
 void ots::JSONDispatcher::beginRun(art::Run const& run) { std::cout << __COUT_HDR_FL__ << "JSONDispatcher beginning run " << run.run() << std::endl; }
 
+void ots::JSONDispatcher::endRun(art::Run const& /*run*/)
+{
+	std::lock_guard<std::mutex> lock(batchMutex_);
+	if(batchedEvents_)
+		dispatch_();
+}
+
 void ots::JSONDispatcher::analyze(art::Event const& evt)
 {
 	// std::cout << __COUT_HDR_FL__ << "JSONDispatcher getting event number to check
 	// prescale" << std::endl;
 	art::EventNumber_t eventNumber = evt.event();
-	TLOG(TLVL_INFO, "JSONDispatcher") << "Received event with sequence ID " << eventNumber;
-	if((int)eventNumber % prescale_ == 0)
+	TLOG(TLVL_DEBUG, "JSONDispatcher") << "Received event with sequence ID " << eventNumber;
+
+	if((int)eventNumber % prescale_ != 0)
+		return;
+
+	// look for raw UDP data
+	art::Handle<artdaq::Fragments> raw;
+	evt.getByLabel(raw_data_label_, frag_type_, raw);
+	if(!raw.isValid())
+		return;
+
+	std::lock_guard<std::mutex> lock(batchMutex_);
+
+	// coalesced events are sent as a JSON array
+	if(eventsPerDatagram_ > 1)
+		jsonWriter_ += batchedEvents_ ? ',' : '[';
+	else if(batchedEvents_ == 0)
+		jsonWriter_.clear();
+	size_t eventStart = jsonWriter_.size();
+
+	appendEventJSON_(evt, *raw);
+
+	if(batchedEvents_ && jsonWriter_.size() + 1 > maxDatagramSize_)
+	{
+		// this event does not fit, send the previous ones and start a new batch with it
+		std::string event = jsonWriter_.substr(eventStart);
+		jsonWriter_.resize(eventStart - 1);  // remove separator
+		dispatch_();
+		jsonWriter_ += '[';
+		jsonWriter_ += event;
+	}
+	if(batchedEvents_++ == 0)
 	{
-		// std::cout << __COUT_HDR_FL__ << "JSONDispatcher dispatching event" <<
-		// std::endl;
-		std::ostringstream outputJSON;
-		outputJSON << "{\"run\":" << std::to_string(evt.run()) << ",\"subrun\":" << std::to_string(evt.subRun())
-		           << ",\"event\":" << std::to_string(eventNumber);
+		firstBatchedEventTime_ = std::chrono::steady_clock::now();
+		if(eventsPerDatagram_ > 1)  // let the sender thread flush the batch on timeout
+		{
+			{
+				std::lock_guard<std::mutex> queueLock(sendQueueMutex_);
+				batchPending_  = true;
+				batchDeadline_ = firstBatchedEventTime_ + coalesceTimeout_;
+			}
+			sendQueueCondition_.notify_one();
+		}
+	}
+
+	if(batchedEvents_ >= eventsPerDatagram_ || jsonWriter_.size() + 1 > maxDatagramSize_)
+		dispatch_();
+}
+
+// appendEventJSON_
+//	Write event JSON to jsonWriter_, without formatting streams.
+void ots::JSONDispatcher::appendEventJSON_(art::Event const& evt, artdaq::Fragments const& fragments)
+{
+	std::string& out = jsonWriter_;
+	out += "{\"run\":";
+	out += std::to_string(evt.run());
+	out += ",\"subrun\":";
+	out += std::to_string(evt.subRun());
+	out += ",\"event\":";
+	out += std::to_string(evt.event());
 
-		// ***********************
-		// *** UDP Fragments ***
-		// ***********************
+	// ***********************
+	// *** UDP Fragments ***
+	// ***********************
 
-		// look for raw UDP data
+	out += ",\"fragments\":[";
+	for(size_t idx = 0; idx < fragments.size(); ++idx)
+	{
+		if(idx > 0)
+			out += ',';
+		out += '{';
+		const auto& frag(fragments[idx]);
 
-		// std::cout << __COUT_HDR_FL__ << "JSONDispatcher getting handle on Fragments" <<
-		// std::endl;
-		art::Handle<artdaq::Fragments> raw;
-		evt.getByLabel(raw_data_label_, frag_type_, raw);
-		outputJSON << ",\"fragments\":[";
+		ots::UDPFragment bb(frag);
 
-		if(raw.isValid())
+		if(frag.hasMetadata())
+		{
+			out += "\"metadata\":{";
+			auto md = frag.metadata<ots::UDPFragment::Metadata>();
+			out += "\"port\":";
+			out += std::to_string(md->port);
+			out += ',';
+			char               buf[INET_ADDRSTRLEN];
+			struct sockaddr_in addr;
+			addr.sin_addr.s_addr = md->address;
+			inet_ntop(AF_INET, &(addr.sin_addr), buf, INET_ADDRSTRLEN);
+			out += "\"address\":\"";
+			out += buf;
+			out += '"';
+			if(bb.packet_count())
+			{
+				out += ",\"packet_count\":";
+				out += std::to_string(bb.packet_count());
+			}
+			out += "},";
+		}
+		out += "\"header\":{";
+		out += "\"event_size\":";
+		out += std::to_string(bb.hdr_event_size());
+		out += ",\"data_type\":";
+		out += std::to_string(bb.hdr_data_type());
+		int type = bb.hdr_data_type();
+		out += "},";
+		out += "\"data\":";
+		size_t packetCount = bb.packet_count();
+		if(packetCount)  // one data element per packed datagram
 		{
-			// std::cout << __COUT_HDR_FL__ << "JSONDispatcher dumping UDPFragments" <<
-			// std::endl;
-			for(size_t idx = 0; idx < raw->size(); ++idx)
+			out += '[';
+			for(size_t i = 0; i < packetCount; ++i)
 			{
-				if(idx > 0)
-				{
-					outputJSON << ",";
-				}
-				outputJSON << "{";
-				const auto& frag((*raw)[idx]);
-
-				ots::UDPFragment bb(frag);
-				int              type = 0;
-
-				if(frag.hasMetadata())
-				{
-					outputJSON << "\"metadata\":{";
-					// std::cout << __COUT_HDR_FL__ << "Fragment metadata: " << std::endl;
-					auto md = frag.metadata<ots::UDPFragment::Metadata>();
-					outputJSON << "\"port\":" << std::to_string(md->port) << ",";
-					char               buf[sizeof(in_addr)];
-					struct sockaddr_in addr;
-					addr.sin_addr.s_addr = md->address;
-					inet_ntop(AF_INET, &(addr.sin_addr), buf, INET_ADDRSTRLEN);
-					outputJSON << "\"address\":\"" << std::string(buf) << "\"";
-					outputJSON << "},";
-				}
-				outputJSON << "\"header\":{";
-				outputJSON << "\"event_size\":" << std::to_string(bb.hdr_event_size()) << ",";
-				outputJSON << "\"data_type\":" << std::to_string(bb.hdr_data_type());
-				type = bb.hdr_data_type();
-				outputJSON << "},";
-				outputJSON << "\"data\":";
-				if(type == 0 || type > 2)
-				{
-					outputJSON << "[";
-					auto it = bb.dataBegin();
-					outputJSON << std::hex << "\"0x" << (int)*it << "\"" << std::dec;
-					++it;
-
-					for(; it != bb.dataEnd(); ++it)
-					{
-						outputJSON << "," << std::hex << "\"0x" << (int)*it << "\"" << std::dec;
-					}
-					outputJSON << "]";
-				}
-				else
-				{
-					if(type == 2)
-					{
-						outputJSON << "\"";
-					}
-					std::string output = std::string((const char*)bb.dataBegin());
-					if(type == 2)
-					{
-						std::string find    = "\"";
-						std::string replace = "\\\"";
-						for(std::string::size_type i = 0; (i = output.find(find, i)) != std::string::npos;)
-						{
-							output.replace(i, find.length(), replace);
-							i += replace.length();
-						}
-					}
-					outputJSON << output;
-					if(type == 2)
-					{
-						outputJSON << "\"";
-					}
-				}
-				outputJSON << "}";
+				if(i)
+					out += ',';
+				appendDataJSON_(type, bb.packetBegin(i), bb.packetSize(i));
 			}
+			out += ']';
 		}
 		else
+			appendDataJSON_(type, bb.dataBegin(), bb.dataEnd() - bb.dataBegin());
+		out += '}';
+	}
+	out += "]}";
+}  // end appendEventJSON_()
+
+// appendDataJSON_
+//	Write one UDP data block to jsonWriter_, by data type:
+//		1: JSON, copied up to the first NUL (an empty block is null)
+//		2: string, escaped, up to the first NUL
+//		else: array of hex bytes
+void ots::JSONDispatcher::appendDataJSON_(int type, uint8_t const* data, size_t size)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+
+	std::string& out = jsonWriter_;
+	if(type == 1 || type == 2)
+	{
+		const char* text     = (const char*)data;
+		size_t      textSize = std::find(text, text + size, '\0') - text;  // ignore terminator and padding
+
+		if(type == 1)
 		{
+			if(textSize)
+				out.append(text, textSize);
+			else
+				out += "null";
 			return;
 		}
 
-		outputJSON << "]}";
-		// std::cout << __COUT_HDR_FL__ <<"JSONDispatcher filling JSON into buffer" <<
-		// std::endl;
-		std::string s = outputJSON.str() + "\0";
-		// std::cout << __COUT_HDR_FL__ << "JSONDispatcher output: " << s << std::endl;
-		auto message = boost::asio::buffer(s);
-		// std::cout << __COUT_HDR_FL__ <<"JSONDispatcher broadcasting JSON data" <<
-		// std::endl;
-		socket_.send_to(message, remote_endpoint_);
-		// std::cout << __COUT_HDR_FL__ << "JSONDispatcher done with event" << std::endl;
+		out += '"';
+		for(size_t i = 0; i < textSize; ++i)
+		{
+			unsigned char c = text[i];
+			if(c == '"' || c == '\\')
+			{
+				out += '\\';
+				out += c;
+			}
+			else if(c < 0x20)  // control characters are not allowed in JSON strings
+			{
+				out += "\\u00";
+				out += hexDigits[c >> 4];
+				out += hexDigits[c & 0xF];
+			}
+			else
+				out += c;
+		}
+		out += '"';
+		return;
 	}
-}
+
+	out += '[';
+	for(size_t i = 0; i < size; ++i)
+	{
+		if(i)
+			out += ',';
+		out += "\"0x";
+		if(data[i] >= 0x10)
+			out += hexDigits[data[i] >> 4];
+		out += hexDigits[data[i] & 0xF];
+		out += '"';
+	}
+	out += ']';
+}  // end appendDataJSON_()
+
+// dispatch_
+//	Send the batched events, or queue them for the sender thread, and get a fresh writer buffer.
+//	Call with batchMutex_ locked.
+void ots::JSONDispatcher::dispatch_()
+{
+	if(eventsPerDatagram_ > 1)
+	{
+		jsonWriter_ += ']';
+
+		std::lock_guard<std::mutex> lock(sendQueueMutex_);
+		batchPending_ = false;
+	}
+	batchedEvents_ = 0;
+
+	if(!sendQueueSize_)
+	{
+		boost::system::error_code ec;
+		socket_.send_to(boost::asio::buffer(jsonWriter_), remote_endpoint_, 0, ec);
+		if(ec)
+			TLOG(TLVL_WARNING, "JSONDispatcher") << "An error occurred sending JSON: " << ec.message();
+		jsonWriter_.clear();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sendQueueMutex_);
+		if(sendQueue_.size() >= sendQueueSize_)
+		{
+			// drop, and reuse the writer buffer
+			if(droppedMessages_++ % 1000 == 0)
+				TLOG(TLVL_WARNING, "JSONDispatcher") << "Send queue is full, dropped " << droppedMessages_ << " JSON messages so far.";
+			jsonWriter_.clear();
+			return;
+		}
+
+		sendQueue_.push_back(std::move(jsonWriter_));
+		if(spareBuffers_.size())
+		{
+			jsonWriter_ = std::move(spareBuffers_.back());
+			spareBuffers_.pop_back();
+		}
+		else
+			jsonWriter_ = std::string();
+	}
+	sendQueueCondition_.notify_one();
+
+	jsonWriter_.clear();
+	jsonWriter_.reserve(writerReserveSize_);  // no-op for reused buffers
+}  // end dispatch_()
+
+// sendLoop_
+//	Sender thread: send queued messages, then return their buffers for reuse.
+//	Also flushes coalesced events that are older than the coalesce timeout.
+void ots::JSONDispatcher::sendLoop_()
+{
+	std::string message;
+	while(true)
+	{
+		bool flushBatch = false;
+		{
+			std::unique_lock<std::mutex> lock(sendQueueMutex_);
+			if(message.capacity())
+				spareBuffers_.push_back(std::move(message));
+
+			auto wakeUp = [this] { return !sendQueue_.empty() || !sendThreadRunning_ || (batchPending_ && std::chrono::steady_clock::now() >= batchDeadline_); };
+			if(batchPending_)
+				sendQueueCondition_.wait_until(lock, batchDeadline_, wakeUp);
+			else
+				sendQueueCondition_.wait(lock, wakeUp);
+
+			if(!sendQueue_.empty())
+			{
+				message = std::move(sendQueue_.front());
+				sendQueue_.pop_front();
+			}
+			else if(!sendThreadRunning_)
+				break;  // stopped and all sent
+			else
+				flushBatch = batchPending_ && std::chrono::steady_clock::now() >= batchDeadline_;
+		}
+
+		if(flushBatch)
+		{
+			// batchMutex_ before sendQueueMutex_, same order as analyze()
+			std::lock_guard<std::mutex> lock(batchMutex_);
+			if(batchedEvents_ && std::chrono::steady_clock::now() - firstBatchedEventTime_ >= coalesceTimeout_)
+				dispatch_();
+			continue;
+		}
+		if(!message.size())
+			continue;
+
+		boost::system::error_code ec;
+		socket_.send_to(boost::asio::buffer(message), remote_endpoint_, 0, ec);
+		if(ec)
+			TLOG(TLVL_WARNING, "JSONDispatcher") << "An error occurred sending JSON: " << ec.message();
+	}
+}  // end sendLoop_()
 
 DEFINE_ART_MODULE(ots::JSONDispatcher)
@@ -94,8 +94,23 @@ void ots::UDPDump::analyze(art::Event const& evt)
 				std::cout << __COUT_HDR_FL__ << "Board port number = " << ((int)md->port) << ", address = " << std::string(buf) << std::endl;
 			}
 
-			int type = bb.hdr_data_type();
-			if(type == 0 || type > 2)
+			int    type        = bb.hdr_data_type();
+			size_t packetCount = bb.packet_count();
+			if(packetCount)  // packed datagrams, iterate in place
+			{
+				std::cout << __COUT_HDR_FL__ << "UDP fragment " << frag.fragmentID() << " has " << packetCount << " packed datagrams" << std::endl;
+				for(size_t ii = 0; ii < packetCount; ++ii)
+				{
+					uint8_t const* packet     = bb.packetBegin(ii);
+					size_t         packetSize = bb.packetSize(ii);
+
+					std::cout << __COUT_HDR_FL__ << "Datagram " << std::dec << ii << ", " << packetSize << " bytes:" << std::hex;
+					for(size_t jj = 0; jj < packetSize && jj < num_bytes_to_show_; ++jj)
+						std::cout << " 0x" << (int)packet[jj];
+					std::cout << std::dec << std::endl;
+				}
+			}
+			else if(type == 0 || type > 2)
 			{
 				auto it = bb.dataBegin();
 				std::cout << __COUT_HDR_FL__ << std::hex << "0x" << (int)*it << std::endl;
@@ -8,7 +8,17 @@
 // 1. The first word of the UDP packet is an 8-bit flag with information
 // about the status of the sender
 // 2. The second word is an 8-bit sequence ID, used for detecting
-// dropped UDP datagrams
+// dropped UDP datagrams. It is unwrapped to 64 bits, and lost, duplicated
+// and reordered datagrams are counted and reported through metricMan.
+//
+// Datagrams are received in batches (recvmmsg) directly into a preallocated
+// ring of fixed-size slots. The receive thread is the single producer and
+// getNext_ is the single consumer, so no lock or allocation is needed per packet.
+//
+// If pack_datagrams is enabled, getNext_ copies datagrams from the ring directly
+// into a growing UDPFragment payload, with a per-packet offset table (see
+// UDPFragment::packet_count()), and emits the fragment when it reaches
+// max_fragment_size_bytes or fragment_time_window_ms has elapsed.
 
 // Some C++ conventions used:
 
@@ -31,9 +41,12 @@
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace ots
 {
+class UDPFragmentWriter;
+
 enum class CommandType : uint8_t
 {
 	Read        = 0,
@@ -106,6 +119,12 @@ class UDPReceiver : public artdaq::CommandableFragmentGenerator
 	// The packet number of the next packet. Used to discover dropped packets
 	uint8_t expectedPacketNumber_;
 
+	// Datagram accounting, written by the receive thread only
+	std::atomic<uint64_t> datagramsReceived_;
+	std::atomic<uint64_t> datagramsLost_;
+	std::atomic<uint64_t> datagramsDuplicated_;
+	std::atomic<uint64_t> datagramsReordered_;
+
 	// Socket parameters
 	struct sockaddr_in si_data_;
 	int                datasocket_;
@@ -114,10 +133,44 @@ class UDPReceiver : public artdaq::CommandableFragmentGenerator
   private:
 	void receiveLoop_();
 	bool isTimerExpired_();
+	bool acceptSequenceNumber_(uint8_t seqNum);
+	void reportReceiveMetrics_();
+	void drainReceiveRing_();
+	void drainReceiveRingPacked_(artdaq::FragmentPtrs& output);
+	void startPackedFragment_(uint8_t firstByte);
+	void finalizePackedFragment_(artdaq::FragmentPtrs& output);
 
 	std::unique_ptr<std::thread> receiverThread_;
-	std::mutex                   receiveBufferLock_;
-	packetBuffer_list_t          receiveBuffers_;
+
+	// datagram ring, single-producer (receiveLoop_) single-consumer (getNext_)
+	//	slot i holds datagram at receiveRing_[i * maxDatagramSize_], a zero size marks a rejected datagram
+	const size_t          maxDatagramSize_;
+	const size_t          receiveRingSlots_;
+	const unsigned int    receiveBatchSize_;  // max datagrams per recvmmsg
+	std::vector<uint8_t>  receiveRing_;
+	std::vector<uint32_t> receiveRingSizes_;
+	std::atomic<size_t>   receiveRingHead_;  // total slots published by producer
+	std::atomic<size_t>   receiveRingTail_;  // total slots released by consumer
+	packetBuffer_list_t   packetBufferPool_;  // cleared packet buffers, reused to avoid allocation per packet
+
+	// multi-packet fragment packing
+	const bool                         packDatagrams_;
+	const size_t                       maxFragmentSizeBytes_;
+	artdaq::FragmentPtr                packedFragment_;
+	std::unique_ptr<UDPFragmentWriter> packedFragmentWriter_;
+	std::vector<uint32_t>              packedOffsets_;  // start of each packed datagram, relative to UDP data
+	size_t                             packedDataBytes_;
+
+	// sequence tracking (receive thread)
+	const unsigned int sequenceReorderWindow_;  // a datagram up to this many sequence numbers late is a duplicate or reordered, not a forward gap
+	bool               sequenceSynchronized_;
+	uint64_t           expectedSequence_;      // unwrapped sequence number of the next datagram
+	uint64_t           receivedSequenceMask_;  // bit i set if expectedSequence_ - 1 - i was received
+
+	// metrics reporting (getNext_ thread)
+	const double                          metricsReportIntervalSeconds_;
+	std::chrono::steady_clock::time_point lastMetricsReport_;
+	uint64_t                              reportedDatagrams_[4];  // received, lost, duplicated, reordered
 
 	bool fakeDataMode_;
 
@@ -15,6 +15,7 @@
 #include "otsdaq/Macros/CoutMacros.h"
 
 #include <sys/poll.h>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -29,9 +30,28 @@ ots::UDPReceiver::UDPReceiver(fhicl::ParameterSet const& ps)
     , ip_(ps.get<std::string>("ip", "127.0.0.1"))
     , rcvbuf_(ps.get<int>("rcvbuf", 0x1000000))
     , expectedPacketNumber_(0)
+    , datagramsReceived_(0)
+    , datagramsLost_(0)
+    , datagramsDuplicated_(0)
+    , datagramsReordered_(0)
     , datasocket_(-1)
     , sendCommands_(ps.get<bool>("send_OtsUDP_commands", false))
     , receiverThread_(nullptr)
+    , maxDatagramSize_(ps.get<size_t>("max_datagram_size", 1500))
+    , receiveRingSlots_(ps.get<size_t>("receive_ring_slots", 8192))
+    , receiveBatchSize_(ps.get<unsigned int>("receive_batch_size", 64))
+    , receiveRingHead_(0)
+    , receiveRingTail_(0)
+    , packDatagrams_(ps.get<bool>("pack_datagrams", false))
+    , maxFragmentSizeBytes_(ps.get<size_t>("max_fragment_size_bytes", 0x100000))
+    , packedDataBytes_(0)
+    , sequenceReorderWindow_(std::min(ps.get<unsigned int>("sequence_reorder_window", 32), 64u))
+    , sequenceSynchronized_(false)
+    , expectedSequence_(0)
+    , receivedSequenceMask_(0)
+    , metricsReportIntervalSeconds_(ps.get<double>("metrics_report_interval_s", 5))
+    , lastMetricsReport_(std::chrono::steady_clock::now())
+    , reportedDatagrams_{0, 0, 0, 0}
     , fakeDataMode_(ps.get<bool>("fake_data_mode", false))
     , fragmentWindow_(ps.get<double>("fragment_time_window_ms", 1000))
     , lastFrag_(std::chrono::high_resolution_clock::now())
@@ -76,6 +96,23 @@ ots::UDPReceiver::UDPReceiver(fhicl::ParameterSet const& ps)
 			exit(1);
 		}
 	}
+	if(maxDatagramSize_ < 2 || receiveRingSlots_ == 0 || receiveBatchSize_ == 0)
+		throw art::Exception(art::errors::Configuration) << "UDPReceiver: Invalid receive ring parameters: max_datagram_size=" << maxDatagramSize_
+		                                                 << " receive_ring_slots=" << receiveRingSlots_ << " receive_batch_size=" << receiveBatchSize_;
+	if(!fakeDataMode_)
+	{
+		receiveRing_.resize(receiveRingSlots_ * maxDatagramSize_);
+		receiveRingSizes_.resize(receiveRingSlots_);
+	}
+	if(packDatagrams_)
+	{
+		if(maxFragmentSizeBytes_ < maxDatagramSize_ || maxFragmentSizeBytes_ > 0x3FFFFFF0)  // UDPFragment event size is 28 bits of 4-byte words
+			throw art::Exception(art::errors::Configuration) << "UDPReceiver: Invalid max_fragment_size_bytes=" << maxFragmentSizeBytes_
+			                                                 << ", must be between max_datagram_size and " << 0x3FFFFFF0;
+		packedOffsets_.reserve(0x10000);
+		TLOG(TLVL_INFO) << "Packing datagrams into fragments of up to " << maxFragmentSizeBytes_ << " bytes or " << fragmentWindow_ << " ms.";
+	}
+
 	TLOG(TLVL_INFO) << "UDP Receiver Construction Complete!";
 
 	TLOG(TLVL_DEBUG) << "Constructed.";
@@ -110,6 +147,16 @@ void ots::UDPReceiver::start()
 
 	TLOG(TLVL_INFO) << "Starting...";
 
+	// reset datagram accounting for the run (receive thread is not running)
+	sequenceSynchronized_ = false;
+	datagramsReceived_    = 0;
+	datagramsLost_        = 0;
+	datagramsDuplicated_  = 0;
+	datagramsReordered_   = 0;
+	for(auto& reported : reportedDatagrams_)
+		reported = 0;
+	lastMetricsReport_ = std::chrono::steady_clock::now();
+
 	if(!fakeDataMode_)
 	{
 		receiverThread_.reset(new std::thread(&UDPReceiver::receiveLoop_, this));
@@ -120,92 +167,323 @@ void ots::UDPReceiver::start()
 }  // end start()
 
 //==============================================================================
+// receiveLoop_
+//	Producer side of the receive ring: each recvmmsg fills up to receiveBatchSize_
+//	free slots directly, the sequence number is read from the received data,
+//	and the batch is published to getNext_ with a single atomic store.
+//	If the ring is full, wait for getNext_ and leave datagrams in the socket buffer.
 void ots::UDPReceiver::receiveLoop_()
 {
+	std::vector<struct mmsghdr> msgs(receiveBatchSize_);
+	std::vector<struct iovec>   iovecs(receiveBatchSize_);
+
+	size_t head = receiveRingHead_.load(std::memory_order_relaxed);
+
 	while(!should_stop())
 	{
+		size_t freeSlots = receiveRingSlots_ - (head - receiveRingTail_.load(std::memory_order_acquire));
+		if(freeSlots == 0)
+		{
+			TLOG(TLVL_TRACE) << "Receive ring is full, waiting for getNext_...";
+			usleep(100);
+			continue;
+		}
+
 		struct pollfd ufds[1];
 		ufds[0].fd     = datasocket_;
 		ufds[0].events = POLLIN | POLLPRI;
 
 		int rv = poll(ufds, 1, 1000);
-		if(rv > 0)
+		if(rv <= 0)
+			continue;
+
+		TLOG(TLVL_TRACE) << "revents: " << ufds[0].revents << ", ";  // ufds[1].revents ;
+		if(ufds[0].revents != POLLIN && ufds[0].revents != POLLPRI)
+			continue;
+
+		// point the batch at the next free slots
+		unsigned int batchSize = freeSlots < receiveBatchSize_ ? freeSlots : receiveBatchSize_;
+		for(unsigned int i = 0; i < batchSize; ++i)
+		{
+			iovecs[i].iov_base = &receiveRing_[((head + i) % receiveRingSlots_) * maxDatagramSize_];
+			iovecs[i].iov_len  = maxDatagramSize_;
+
+			memset(&msgs[i].msg_hdr, 0, sizeof(msgs[i].msg_hdr));
+			msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+			msgs[i].msg_hdr.msg_iovlen  = 1;
+			msgs[i].msg_hdr.msg_name    = &si_data_;
+			msgs[i].msg_hdr.msg_namelen = sizeof(si_data_);
+		}
+
+		int received = recvmmsg(datasocket_, &msgs[0], batchSize, MSG_DONTWAIT, nullptr);
+		if(received == -1)
+		{
+			if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+				TLOG(TLVL_WARNING) << "Error on socket: " << strerror(errno);
+			continue;
+		}
+		TLOG(TLVL_TRACE) << "Received " << received << " datagrams.";
+
+		for(int i = 0; i < received; ++i)
 		{
-			TLOG(TLVL_TRACE) << "revents: " << ufds[0].revents << ", ";  // ufds[1].revents ;
-			if(ufds[0].revents == POLLIN || ufds[0].revents == POLLPRI)
+			size_t   slot = (head + i) % receiveRingSlots_;
+			uint8_t* data = &receiveRing_[slot * maxDatagramSize_];
+
+			// FIXME -> IN THE STIB GENERATOR WE DON'T HAVE A HEADER
+			receiveRingSizes_[slot] = 0;  // reject unless sequence is accepted
+			if(msgs[i].msg_len < 2)
 			{
-				// FIXME -> IN THE STIB GENERATOR WE DON'T HAVE A HEADER
-				// FIXME -> IN THE STIB GENERATOR WE DON'T HAVE A HEADER
-				// FIXME -> IN THE STIB GENERATOR WE DON'T HAVE A HEADER
-				uint8_t   peekBuffer[4];
-				socklen_t dataSz = sizeof(si_data_);
-				recvfrom(datasocket_, peekBuffer, sizeof(peekBuffer), MSG_PEEK, (struct sockaddr*)&si_data_, &dataSz);
-
-				TLOG(TLVL_TRACE) << "Received UDP Datagram with sequence number " << std::hex << "0x" << static_cast<int>(peekBuffer[1]) << "!" << std::dec;
-				TLOG(TLVL_TRACE) << "peekBuffer[1] == expectedPacketNumber_: " << std::hex << static_cast<int>(peekBuffer[1])
-				                 << " =?= " << (int)expectedPacketNumber_;
-				TLOG(TLVL_TRACE) << "peekBuffer: 0: " << std::hex << static_cast<int>(peekBuffer[0]) << ", 1: " << std::hex << static_cast<int>(peekBuffer[1])
-				                 << ", 2: " << std::hex << static_cast<int>(peekBuffer[2]) << ", 3: " << std::hex << static_cast<int>(peekBuffer[3]);
-
-				uint8_t seqNum = peekBuffer[1];
-				// ReturnCode dataCode = getReturnCode(peekBuffer[0]);
-				if(seqNum >= expectedPacketNumber_ || (seqNum < 64 && expectedPacketNumber_ > 192))
-				{
-					if(seqNum != expectedPacketNumber_)
-					{
-						int delta = seqNum - expectedPacketNumber_;
-						TLOG(TLVL_WARNING) << std::dec << "Sequence Number different than expected! (delta: " << delta << ")";
-						expectedPacketNumber_ = seqNum;
-					}
-
-					packetBuffer_t receiveBuffer;
-					receiveBuffer.resize(1500);
-					int sts = recvfrom(datasocket_, &receiveBuffer[0], receiveBuffer.size(), 0, (struct sockaddr*)&si_data_, &dataSz);
-					receiveBuffer.resize(sts);
-
-					if(sts == -1)
-					{
-						TLOG(TLVL_WARNING) << "Error on socket: " << strerror(errno);
-					}
-					else
-					{
-						TLOG(TLVL_TRACE) << "Received " << sts << " bytes.";
-					}
-
-					std::unique_lock<std::mutex> lock(receiveBufferLock_);
-					TLOG(TLVL_TRACE) << "Now placing UDP datagram with sequence number " << std::hex << (int)seqNum << " into buffer." << std::dec;
-					receiveBuffers_.push_back(receiveBuffer);
-
-					++expectedPacketNumber_;
-				}
-				else
-				{
-					// Receiving out-of-order datagram, then moving on...
-					TLOG(TLVL_WARNING) << "Received out-of-order datagram: " << seqNum << " != " << expectedPacketNumber_ << " (expected)";
-					packetBuffer_t receiveBuffer;
-					receiveBuffer.resize(1500);
-					int sts = recvfrom(datasocket_, &receiveBuffer[0], receiveBuffer.size(), 0, (struct sockaddr*)&si_data_, &dataSz);
-					receiveBuffer.resize(sts);
-				}
+				TLOG(TLVL_WARNING) << "Received datagram too small for header: " << msgs[i].msg_len << " bytes";
+				continue;
 			}
+
+			uint8_t seqNum = data[1];
+			TLOG(TLVL_TRACE) << "Received UDP Datagram with sequence number " << std::hex << "0x" << static_cast<int>(seqNum) << " =?= "
+			                 << (int)expectedPacketNumber_ << " (expected), " << std::dec << msgs[i].msg_len << " bytes.";
+
+			// ReturnCode dataCode = getReturnCode(data[0]);
+			if(acceptSequenceNumber_(seqNum))
+				receiveRingSizes_[slot] = msgs[i].msg_len;
 		}
+
+		// publish batch to consumer
+		head += received;
+		receiveRingHead_.store(head, std::memory_order_release);
 	}
 	TLOG(TLVL_INFO) << "receive Loop exiting...";
-}
+}  // end receiveLoop_()
+
+//==============================================================================
+// acceptSequenceNumber_
+//	Unwrap the 8-bit sequence number relative to the expected one and account for it:
+//		late by up to sequenceReorderWindow_	- duplicated (if already received) or reordered
+//												(previously counted as lost), and rejected as before
+//		otherwise								- in order or forward gap (counted as lost), and accepted
+//	Per-datagram messages are trace level only, loss is summarized by reportReceiveMetrics_.
+bool ots::UDPReceiver::acceptSequenceNumber_(uint8_t seqNum)
+{
+	datagramsReceived_.fetch_add(1, std::memory_order_relaxed);
+
+	if(!sequenceSynchronized_)  // first datagram of run defines the sequence
+	{
+		sequenceSynchronized_ = true;
+		expectedSequence_     = seqNum;
+		receivedSequenceMask_ = ~0ULL;  // treat anything before the first datagram as received
+	}
+
+	unsigned int delta = (uint8_t)(seqNum - (uint8_t)expectedSequence_);  // forward distance, modulo 256
+	if(delta && delta >= 256 - sequenceReorderWindow_)
+	{
+		uint64_t ageBit = 1ULL << (255 - delta);  // age 1 (bit 0) is the previous sequence number
+		if(receivedSequenceMask_ & ageBit)
+		{
+			datagramsDuplicated_.fetch_add(1, std::memory_order_relaxed);
+			TLOG(TLVL_TRACE) << "Received duplicate datagram: " << (int)seqNum << " != " << (int)expectedPacketNumber_ << " (expected)";
+		}
+		else
+		{
+			receivedSequenceMask_ |= ageBit;
+			datagramsReordered_.fetch_add(1, std::memory_order_relaxed);
+			datagramsLost_.fetch_sub(1, std::memory_order_relaxed);  // was counted lost when skipped
+			TLOG(TLVL_TRACE) << "Received out-of-order datagram: " << (int)seqNum << " != " << (int)expectedPacketNumber_ << " (expected)";
+		}
+		return false;
+	}
+
+	if(delta)
+	{
+		datagramsLost_.fetch_add(delta, std::memory_order_relaxed);
+		TLOG(TLVL_TRACE) << "Sequence Number different than expected! (delta: " << delta << ")";
+	}
+
+	receivedSequenceMask_ = (delta + 1 >= 64 ? 0 : receivedSequenceMask_ << (delta + 1)) | 1;
+	expectedSequence_ += delta + 1;
+	expectedPacketNumber_ = expectedSequence_;
+	return true;
+}  // end acceptSequenceNumber_()
+
+//==============================================================================
+// reportReceiveMetrics_
+//	Every metrics_report_interval_s, send datagram counts for the interval to metricMan,
+//	and summarize any loss in one warning instead of one per datagram.
+void ots::UDPReceiver::reportReceiveMetrics_()
+{
+	auto   now     = std::chrono::steady_clock::now();
+	double elapsed = std::chrono::duration<double>(now - lastMetricsReport_).count();
+	if(elapsed < metricsReportIntervalSeconds_)
+		return;
+	lastMetricsReport_ = now;
+
+	const uint64_t    counts[] = {datagramsReceived_.load(std::memory_order_relaxed),
+                               datagramsLost_.load(std::memory_order_relaxed),
+                               datagramsDuplicated_.load(std::memory_order_relaxed),
+                               datagramsReordered_.load(std::memory_order_relaxed)};
+	const char* const names[]  = {"Received", "Lost", "Duplicated", "Reordered"};
+
+	int64_t deltas[4];  // lost can decrease, if a reordered datagram arrives in a later interval
+	for(int i = 0; i < 4; ++i)
+	{
+		deltas[i]             = (int64_t)(counts[i] - reportedDatagrams_[i]);
+		reportedDatagrams_[i] = counts[i];
+	}
+
+	if(metricMan && metricMan->Running())
+	{
+		for(int i = 0; i < 4; ++i)
+			metricMan->sendMetric(std::string("UDP Datagrams ") + names[i], (double)deltas[i], "datagrams", 3, artdaq::MetricMode::Accumulate);
+		metricMan->sendMetric("UDP Datagram Rate", deltas[0] / elapsed, "datagrams/s", 3, artdaq::MetricMode::Average);
+		if(deltas[0] + deltas[1] > 0)
+			metricMan->sendMetric("UDP Datagram Loss Fraction", (double)deltas[1] / (deltas[0] + deltas[1]), "", 3, artdaq::MetricMode::Average);
+	}
+
+	if(deltas[1] || deltas[2] || deltas[3])
+		TLOG(TLVL_WARNING) << "In the last " << elapsed << " s: received " << deltas[0] << ", lost " << deltas[1] << ", duplicated " << deltas[2]
+		                   << ", reordered " << deltas[3] << " datagrams (run totals: received " << counts[0] << ", lost " << counts[1] << ").";
+}  // end reportReceiveMetrics_()
+
+//==============================================================================
+// drainReceiveRing_
+//	Consumer side of the receive ring: move all published datagrams into packetBuffers_,
+//	reusing previously cleared packet buffers so no allocation is needed in steady state.
+void ots::UDPReceiver::drainReceiveRing_()
+{
+	size_t tail = receiveRingTail_.load(std::memory_order_relaxed);
+	size_t head = receiveRingHead_.load(std::memory_order_acquire);
+
+	for(; tail != head; ++tail)
+	{
+		size_t slot = tail % receiveRingSlots_;
+		if(receiveRingSizes_[slot] == 0)
+			continue;  // rejected datagram
+
+		const char* data = (const char*)&receiveRing_[slot * maxDatagramSize_];
+		if(packetBufferPool_.size())
+		{
+			packetBuffers_.splice(packetBuffers_.end(), packetBufferPool_, packetBufferPool_.begin());
+			packetBuffers_.back().assign(data, receiveRingSizes_[slot]);
+		}
+		else
+			packetBuffers_.emplace_back(data, receiveRingSizes_[slot]);
+	}
+
+	// release slots to producer
+	receiveRingTail_.store(tail, std::memory_order_release);
+}  // end drainReceiveRing_()
+
+//==============================================================================
+// drainReceiveRingPacked_
+//	Consumer side of the receive ring when packing datagrams: append each published
+//	datagram directly to the open fragment payload, emitting the fragment if it would
+//	exceed max_fragment_size_bytes (or the 16-bit packet count).
+void ots::UDPReceiver::drainReceiveRingPacked_(artdaq::FragmentPtrs& output)
+{
+	size_t tail = receiveRingTail_.load(std::memory_order_relaxed);
+	size_t head = receiveRingHead_.load(std::memory_order_acquire);
+
+	for(; tail != head; ++tail)
+	{
+		size_t   slot = tail % receiveRingSlots_;
+		uint32_t size = receiveRingSizes_[slot];
+		if(size == 0)
+			continue;  // rejected datagram
+
+		const uint8_t* data = &receiveRing_[slot * maxDatagramSize_];
+
+		// leave room for padding and offset table
+		if(packedFragment_ && (packedOffsets_.size() >= 0xFFFF ||
+		                       packedDataBytes_ + size + 3 + (packedOffsets_.size() + 2) * sizeof(uint32_t) > maxFragmentSizeBytes_))
+			finalizePackedFragment_(output);
+		if(!packedFragment_)
+			startPackedFragment_(data[0]);
+
+		packedFragment_->resizeBytesWithCushion(sizeof(UDPFragment::Header) + packedDataBytes_ + size);
+		memcpy(packedFragment_->dataBeginBytes() + sizeof(UDPFragment::Header) + packedDataBytes_, data, size);
+		packedOffsets_.push_back(packedDataBytes_);
+		packedDataBytes_ += size;
+	}
+
+	// release slots to producer
+	receiveRingTail_.store(tail, std::memory_order_release);
+}  // end drainReceiveRingPacked_()
+
+//==============================================================================
+// startPackedFragment_
+//	The fragment data type is taken from the first datagram.
+void ots::UDPReceiver::startPackedFragment_(uint8_t firstByte)
+{
+	ots::UDPFragment::Metadata metadata;
+	metadata.port         = dataport_;
+	metadata.address      = si_data_.sin_addr.s_addr;
+	metadata.packet_count = 0;  // set when finalized
+
+	packedFragment_ = artdaq::Fragment::FragmentBytes(0, ev_counter(), fragment_id(), ots::detail::FragmentType::UDP, metadata);
+	ev_counter_inc();
+
+	packedFragmentWriter_.reset(new ots::UDPFragmentWriter(*packedFragment_));
+	packedFragmentWriter_->set_hdr_type((int)getDataType(firstByte));
+
+	packedOffsets_.clear();
+	packedDataBytes_ = 0;
+	lastFrag_        = std::chrono::high_resolution_clock::now();
+}  // end startPackedFragment_()
+
+//==============================================================================
+// finalizePackedFragment_
+//	Pad the packed datagrams to a 4-byte boundary, append the offset table,
+//	and move the fragment to output.
+void ots::UDPReceiver::finalizePackedFragment_(artdaq::FragmentPtrs& output)
+{
+	size_t paddedDataBytes = (packedDataBytes_ + 3) / 4 * 4;
+	size_t packetCount     = packedOffsets_.size();
+	packedOffsets_.push_back(packedDataBytes_);  // end of last datagram
+	size_t tableBytes = packedOffsets_.size() * sizeof(uint32_t);
+
+	packedFragmentWriter_->resize(paddedDataBytes + tableBytes);  // also sets header event size
+	uint8_t* dataBegin = packedFragmentWriter_->dataBegin();
+	memset(dataBegin + packedDataBytes_, 0, paddedDataBytes - packedDataBytes_);
+	memcpy(dataBegin + paddedDataBytes, &packedOffsets_[0], tableBytes);
+	packedFragment_->metadata<ots::UDPFragment::Metadata>()->packet_count = packetCount;
+
+	TLOG(TLVL_TRACE) << "Emitting packed fragment with " << packetCount << " datagrams, " << packedDataBytes_ << " bytes.";
+
+	if(rawOutput_)
+	{
+		std::string   outputPath = rawPath_ + "/UDPReceiver-" + ip_ + ":" + std::to_string(dataport_) + ".bin";
+		std::ofstream rawOutput(outputPath, std::ios::out | std::ios::app | std::ios::binary);
+		rawOutput.write((const char*)dataBegin, packedDataBytes_);
+	}
+
+	packedFragmentWriter_.reset(nullptr);
+	output.emplace_back(std::move(packedFragment_));
+	packedOffsets_.clear();
+	packedDataBytes_ = 0;
+}  // end finalizePackedFragment_()
 
 //==============================================================================
 bool ots::UDPReceiver::getNext_(artdaq::FragmentPtrs& output)
 {
 	if(should_stop())
 	{
+		// emit partially packed fragment before reporting end of data
+		if(packedFragment_)
+		{
+			finalizePackedFragment_(output);
+			return true;
+		}
 		return false;
 	}
 
-	if(!fakeDataMode_)
+	reportReceiveMetrics_();
+
+	if(!fakeDataMode_ && packDatagrams_)
+	{
+		drainReceiveRingPacked_(output);
+		if(packedFragment_ && isTimerExpired_())
+			finalizePackedFragment_(output);
+	}
+	else if(!fakeDataMode_)
 	{
-		std::unique_lock<std::mutex> lock(receiveBufferLock_);
-		std::move(receiveBuffers_.begin(), receiveBuffers_.end(), std::inserter(packetBuffers_, packetBuffers_.end()));
-		receiveBuffers_.clear();
+		drainReceiveRing_();
 	}
 	else
 	{
@@ -220,7 +498,11 @@ bool ots::UDPReceiver::getNext_(artdaq::FragmentPtrs& output)
 		packetBuffers_.push_back(pkt);
 	}
 
-	if(packetBuffers_.size() > 0)
+	if(output.size())
+	{
+		TLOG(TLVL_TRACE) << "Returning packed output of size " << output.size();
+	}
+	else if(packetBuffers_.size() > 0)
 	{
 		size_t packetBufferSize = 0;
 		for(auto& buf : packetBuffers_)
@@ -231,13 +513,19 @@ bool ots::UDPReceiver::getNext_(artdaq::FragmentPtrs& output)
 		                 << ", sz = " << std::to_string(packetBufferSize);
 		ProcessData_(output, packetBufferSize);
 
-		packetBuffers_.clear();
+		packetBufferPool_.splice(packetBufferPool_.end(), packetBuffers_);  // keep buffers for reuse
 		TLOG(TLVL_TRACE) << "Returning output of size " << output.size();
 	}
 	else
 	{
-		// Sleep 10 times per poll timeout
-		usleep(100000);
+		// Sleep up to 10 times per poll timeout, but return as soon as the receive ring has data
+		//	so that a burst does not fill the ring while getNext_ is asleep
+		for(int i = 0; i < 100 && !should_stop() && !(packedFragment_ && isTimerExpired_()); ++i)
+		{
+			if(!fakeDataMode_ && receiveRingHead_.load(std::memory_order_acquire) != receiveRingTail_.load(std::memory_order_relaxed))
+				break;
+			usleep(1000);
+		}
 	}
 	return true;
 }
@@ -248,7 +536,8 @@ void ots::UDPReceiver::ProcessData_(artdaq::FragmentPtrs& output, size_t totalSi
 	TLOG(TLVL_TRACE) << "ProcessData_ start";
 	ots::UDPFragment::Metadata metadata;
 	metadata.port    = dataport_;
-	metadata.address = si_data_.sin_addr.s_addr;
+	metadata.address      = si_data_.sin_addr.s_addr;
+	metadata.packet_count = 0;  // one data block
 
 	std::size_t initial_payload_size = 0;
 
@@ -34,7 +34,7 @@ class ots::UDPFragment
 
 		data_t port : 16;
 		data_t address : 32;
-		data_t unused : 16;
+		data_t packet_count : 16;  // 0 if the UDP data is one block, else number of packed datagrams (see packet_count())
 
 		static size_t const size_words = 1ull;  // Units of Metadata::data_t
 	};
@@ -91,7 +91,36 @@ class ots::UDPFragment
 	// End of the UDP data, returned as a pointer
 	uint8_t const* dataEnd() const { return dataBegin() + udp_data_words(); }
 
+	// Packed datagrams: the UDP data holds the datagrams back to back, zero padded to
+	// a 4-byte boundary, followed by a table of (packet_count + 1) uint32_t offsets
+	// relative to dataBegin(); datagram i spans [offset[i], offset[i + 1]).
+	// Returns 0 if the fragment is not packed, in which case the UDP data is one block.
+	size_t packet_count() const
+	{
+		if(!artdaq_Fragment_.hasMetadata())
+			return 0;
+		size_t packetCount = artdaq_Fragment_.metadata<Metadata>()->packet_count;
+		if(packetCount == 0 || (packetCount + 1) * sizeof(uint32_t) > udp_data_words())
+			return 0;
+
+		// consistency check, so that metadata from before packing existed is not misread
+		uint32_t const* offsets = packetOffsets_(packetCount);
+		if(offsets[0] != 0 || (offsets[packetCount] + 3) / 4 * 4 + (packetCount + 1) * sizeof(uint32_t) != udp_data_words())
+			return 0;
+		return packetCount;
+	}
+
+	// Start and size of packed datagram i, for i < packet_count()
+	uint8_t const* packetBegin(size_t i) const { return dataBegin() + packetOffsets_(artdaq_Fragment_.metadata<Metadata>()->packet_count)[i]; }
+	size_t         packetSize(size_t i) const
+	{
+		uint32_t const* offsets = packetOffsets_(artdaq_Fragment_.metadata<Metadata>()->packet_count);
+		return offsets[i + 1] - offsets[i];
+	}
+
   protected:
+	uint32_t const* packetOffsets_(size_t packetCount) const { return reinterpret_cast<uint32_t const*>(dataEnd()) - (packetCount + 1); }
+
 	// Functions to translate between byte size and the size of
 	// this fragment overlay's concept of a unit of data (i.e.,
 	// Header::data_t).
@@ -5,6 +5,7 @@
 #include "otsdaq/TablePlugins/XDAQContextTable/XDAQContextTable.h"
 
 #include <fstream>  // std::ofstream
+#include <typeinfo>
 
 #include "otsdaq/TableCore/TableGroupKey.h"
 #include "otsdaq/TablePlugins/DesktopIconTable.h"  //for dynamic desktop icon change
@@ -59,6 +60,8 @@ const uint8_t ConfigurationManager::METADATA_COL_AUTHOR    = 3;
 const uint8_t ConfigurationManager::METADATA_COL_TIMESTAMP = 4;
 
 
+const size_t ConfigurationManager::NODE_CACHE_MAX_SIZE = 100000;
+
 const std::string ConfigurationManager::CONTEXT_SUBSYSTEM_OPTIONAL_TABLE = "SubsystemUserDataPathsTable";
 const std::set<std::string> ConfigurationManager::contextMemberNames_  = {ConfigurationManager::XDAQ_CONTEXT_TABLE_NAME,
                                                                           ConfigurationManager::XDAQ_APPLICATION_TABLE_NAME,
@@ -100,6 +103,8 @@ ConfigurationManager::ConfigurationManager(bool initForWriteAccess /*=false*/, b
     , theContextTableGroup_("")
     , theBackboneTableGroup_("")
     , groupMetadataTable_(true /*special table*/, ConfigurationInterface::GROUP_METADATA_TABLE_NAME)
+    , nodeCacheEnabled_(!initForWriteAccess)
+    , nodeCacheActiveViewChangeCount_(0)
 {
 	__GEN_COUTV__(runTimeSeconds());
 	theInterface_ = ConfigurationInterface::getInstance(ConfigurationInterface::CONFIGURATION_MODE::ARTDAQ_DATABASE);  // false to use artdaq DB
@@ -186,6 +191,7 @@ ConfigurationManager::ConfigurationManager(const std::string& username) : Config
 	// overwrite read-only username initialization with write-access username:
 	mfSubject_ = username;
 	username_  = username;
+	nodeCacheEnabled_ = false;  // views are edited in place with write access
 }  // end constructor(username)
 
 //==============================================================================
@@ -436,6 +442,8 @@ void ConfigurationManager::destroyTableGroup(const std::string& theGroup, bool o
 			__GEN_COUT__ << dbgHeader << " Configuration group: " << theGroup << __E__;
 	}
 
+	clearNodeCache();  // active views are about to change
+
 	std::set<std::string>::const_iterator contextFindIt, backboneFindIt, iterateFindIt;
 	for(auto it = nameToTableMap_.begin(); it != nameToTableMap_.end();
 	    /*no increment*/)
@@ -1336,6 +1344,8 @@ void ConfigurationManager::loadMemberMap(const std::map<std::string /*name*/, Ta
 		} 
 	} //end multi-thread handling
 
+	clearNodeCache();  // active views have changed
+
 	__GEN_COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "loadMemberMap end Clock time = " << runTimeSeconds() <<__E__;	
 }  // end loadMemberMap()
 
@@ -1350,6 +1360,10 @@ void ConfigurationManager::loadMemberMap(const std::map<std::string /*name*/, Ta
 //
 //	if progressBar != 0, then do step handling, for finer granularity
 //
+//	if doActivate and a group of the same type is active, only members with a different
+//		version than the previous group are (re)filled and init'd (table plugins are always init'd); the
+//		member version diff is available from getLastTableGroupDiffs()
+//
 // 	if(doNotLoadMembers) return memberMap; //this is useful if just getting group metadata
 //	else NOTE: active views are changed! (when loading member map)
 //
@@ -1585,6 +1599,9 @@ void ConfigurationManager::loadTableGroup(const std::string&
 							<< convertGroupTypeToName(groupType) << " group '" << groupName << "(" << groupKey << ")"
 							<< "']" << __E__;
 
+			std::map<std::string /*name*/, TableVersion /*version*/> membersToLoad = memberMap;  // members to (re)fill and activate
+			std::map<std::string /*name*/, TableVersion /*version*/> membersToInit = memberMap;  // members to init()
+			std::map<std::string /*name*/, std::pair<TableVersion /*previous*/, TableVersion /*new*/>> groupDiff;  // recorded on successful activation
 			if(doActivate)
 			{
 				std::string groupToDeactivate =
@@ -1595,23 +1612,58 @@ void ConfigurationManager::loadTableGroup(const std::string&
 							: (groupType == ConfigurationManager::GroupType::ITERATE_TYPE ? theIterateTableGroup_ : theConfigurationTableGroup_));
 
 				//		deactivate all of that type (invalidate active view)
+				std::map<std::string /*name*/, TableVersion /*version*/> previousMemberMap;
 				if(groupToDeactivate != "")  // deactivate only if pre-existing group
 				{
 					//__GEN_COUT__ << "groupToDeactivate '" << groupToDeactivate << "'" <<
 					// __E__;
+					std::map<std::string, TableVersion> activeVersions = getActiveVersions();
 					destroyTableGroup(groupToDeactivate, true);
+
+					// the tables just deactivated were the members of the previous group
+					for(const auto& activePair : activeVersions)
+						if(!nameToTableMap_.at(activePair.first)->isActive())
+							previousMemberMap.emplace(activePair);
 				}
 				//		else
 				//		{
 				//			//Getting here, is kind of strange:
 				//			//	- this group may have only been partially loaded before?
 				//		}
+
+				// incremental activation: only (re)fill members that differ from the previous group
+				//	Note: Scratch versions can change content without changing version, so always reload.
+				//	Note: table plugins may derive state from other tables, so always init() those.
+				for(const auto& memberPair : memberMap)
+				{
+					auto previousIt = previousMemberMap.find(memberPair.first);
+					if(previousIt != previousMemberMap.end() && previousIt->second == memberPair.second && !memberPair.second.isScratchVersion() &&
+					   nameToTableMap_.at(memberPair.first)->isStored(memberPair.second) &&
+					   nameToTableMap_.at(memberPair.first)->setActiveView(memberPair.second))  // already filled and initialized
+					{
+						TableBase* table = nameToTableMap_.at(memberPair.first);
+						membersToLoad.erase(memberPair.first);
+						if(typeid(*table) == typeid(TableBase))  // no plugin init() to call
+							membersToInit.erase(memberPair.first);
+					}
+					else
+						groupDiff[memberPair.first] = std::make_pair(previousIt != previousMemberMap.end() ? previousIt->second : TableVersion(), memberPair.second);
+				}
+				for(const auto& previousPair : previousMemberMap)
+					if(memberMap.find(previousPair.first) == memberMap.end())  // removed member
+						groupDiff[previousPair.first] = std::make_pair(previousPair.second, TableVersion());
+
+				__GEN_COUT__ << "Activating " << convertGroupTypeToName(groupType) << " group '" << groupName << "(" << groupKey << ")' with " << 
+					membersToLoad.size() << " of " << memberMap.size() << " member tables changed from previous group '" << 
+					groupToDeactivate << ".'" << __E__;
+				for(const auto& diffPair : groupDiff)
+					__GEN_COUT__ << "\t" << diffPair.first << ": v" << diffPair.second.first << " ==> v" << diffPair.second.second << __E__;
 			}
 
 			if(progressBar)
 				progressBar->step();
 
-			loadMemberMap(memberMap, accumulatedWarnings);
+			loadMemberMap(membersToLoad, accumulatedWarnings);
 
 			if(progressBar)
 				progressBar->step();
@@ -1645,7 +1697,7 @@ void ConfigurationManager::loadTableGroup(const std::string&
 				if(groupType != ConfigurationManager::GroupType::CONFIGURATION_TYPE ||
 					numOfThreads < 2) // no multi-threading			
 				{
-					for(auto& memberPair : memberMap)
+					for(auto& memberPair : membersToInit)
 					{
 						// do NOT allow activating Scratch versions if tracking is ON!
 						if(!ignoreVersionTracking && ConfigurationInterface::isVersionTrackingEnabled() && memberPair.second.isScratchVersion())
@@ -1722,7 +1774,7 @@ void ConfigurationManager::loadTableGroup(const std::string&
 							}
 						}
 
-					for(auto& memberPair : memberMap)
+					for(auto& memberPair : membersToInit)
 					{
 						if(threadsLaunched >= numOfThreads)
 						{
@@ -1797,6 +1849,8 @@ void ConfigurationManager::loadTableGroup(const std::string&
 
 			if(doActivate)
 			{
+				lastGroupLoadDiff_[convertGroupTypeToName(groupType)] = groupDiff;
+
 				if(groupType == ConfigurationManager::GroupType::CONTEXT_TYPE)  //
 				{
 					//			__GEN_COUT_INFO__ << "Type=Context, Group loaded: " <<
@@ -1996,6 +2050,7 @@ void ConfigurationManager::copyTableGroupFromCache(
 			//	to make the new view the active view do this:
 			// 		nameToTableMap_.at(memberPair.first)->setActiveView(memberPair.second);
 		} //end member map copy loop
+		clearNodeCache();  // views have changed
 		__GEN_COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Done with member copy loop." << __E__;
 
 		//	for each member
@@ -2542,6 +2597,80 @@ ConfigurationTree ConfigurationManager::getNode(const std::string& nodeString, b
 		return configTree;
 }  // end getNode()
 
+//==============================================================================
+// getNode
+//	Same as getNode(nodeString) but uses pre-tokenized path, so the path
+//	string is not re-split on every call.
+ConfigurationTree ConfigurationManager::getNode(const ConfigurationTree::NodePath& nodePath, bool doNotThrowOnBrokenUIDLinks) const
+{
+	if(nodePath.getNodeNames().size() == 0)
+		return ConfigurationTree(this, 0);  // return root node
+
+	// root node handles descending to table node and below (and the node cache)
+	return ConfigurationTree(this, 0).getNode(nodePath, doNotThrowOnBrokenUIDLinks);
+}  // end getNode(NodePath)
+
+//==============================================================================
+// findCachedNode
+//	returns null if the node has not been resolved since the last active view change
+//		(see TableBase::getActiveViewChangeCount()).
+//	activeViewChangeCount is returned for the cacheNode() call after resolution.
+std::shared_ptr<const ConfigurationTree> ConfigurationManager::findCachedNode(const std::string& cacheKey, unsigned long& activeViewChangeCount) const
+{
+	activeViewChangeCount = TableBase::getActiveViewChangeCount();
+
+	std::lock_guard<std::mutex> lock(nodeCacheMutex_);
+	if(nodeCacheActiveViewChangeCount_ != activeViewChangeCount)
+	{
+		nodeCache_.clear();
+		nodeCacheActiveViewChangeCount_ = activeViewChangeCount;
+		return nullptr;
+	}
+
+	auto it = nodeCache_.find(cacheKey);
+	if(it == nodeCache_.end())
+		return nullptr;
+	return it->second;
+}  // end findCachedNode()
+
+//==============================================================================
+// cacheNode
+//	Note: node resolution is done outside of the lock, so two threads may
+//		resolve the same path, in which case the first result is kept.
+//	The node is dropped if an active view changed since findCachedNode().
+void ConfigurationManager::cacheNode(const std::string& cacheKey, const ConfigurationTree& node, unsigned long activeViewChangeCount) const
+{
+	std::lock_guard<std::mutex> lock(nodeCacheMutex_);
+	if(activeViewChangeCount != TableBase::getActiveViewChangeCount() || activeViewChangeCount != nodeCacheActiveViewChangeCount_)
+		return;
+
+	if(nodeCache_.size() >= NODE_CACHE_MAX_SIZE)  // protect against unbounded growth (e.g. from generated paths)
+	{
+		__GEN_COUT_TYPE__(TLVL_DEBUG+20) << __COUT_HDR__ << "Node cache reached max size " << NODE_CACHE_MAX_SIZE << ", clearing." << __E__;
+		nodeCache_.clear();
+	}
+	nodeCache_.emplace(cacheKey, std::make_shared<const ConfigurationTree>(node));
+}  // end cacheNode()
+
+//==============================================================================
+// clearNodeCache
+//	must be called whenever active table views change
+void ConfigurationManager::clearNodeCache(void) const
+{
+	std::lock_guard<std::mutex> lock(nodeCacheMutex_);
+	nodeCache_.clear();
+}  // end clearNodeCache()
+
+//==============================================================================
+// setNodeCacheEnabled
+//	The node cache is enabled by default only for read-only access,
+//		since ConfigurationManagerRW edits views in place.
+void ConfigurationManager::setNodeCacheEnabled(bool enable)
+{
+	nodeCacheEnabled_ = enable;
+	clearNodeCache();
+}  // end setNodeCacheEnabled()
+
 //==============================================================================
 std::map<std::string, ConfigurationTree> ConfigurationManager::getNodes(const std::string& nodeString) const
 {
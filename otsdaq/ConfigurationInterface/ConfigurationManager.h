@@ -24,6 +24,7 @@ class ConfigurationManager
 	// private members.
 	friend class ConfigurationManagerRW;
 	friend class GatewaySupervisor;
+	friend class ConfigurationTree; // for node resolution cache
 
   public:
 
@@ -32,6 +33,10 @@ class ConfigurationManager
 			std::pair<std::string, TableGroupKey>,
 			std::map<std::string, TableVersion> /* memberMap */ 
 			>> lastGroupLoad_t;
+	typedef std::map<std::string /* groupType */,
+		std::map<std::string /* tableName */,
+			std::pair<TableVersion /* previous */, TableVersion /* new */>
+			>> lastGroupLoadDiff_t;
 
 	//==============================================================================
 	// Static members
@@ -178,10 +183,12 @@ const T* retPtr = dynamic_cast<const T*>(srcPtr); if(retPtr == nullptr) { __SS__
 		std::pair<std::string /*groupName*/,
 		TableGroupKey>>& 				getFailedTableGroups		(void) const {return lastFailedGroupLoad_;}
 	const lastGroupLoad_t& 				getLastTableGroups			(void) const {return lastGroupLoad_;}
+	const lastGroupLoadDiff_t& 			getLastTableGroupDiffs		(void) const {return lastGroupLoadDiff_;} //member tables changed by the last activation of each group type (invalid version if added/removed)
 	const std::string& 					getActiveGroupName			(const ConfigurationManager::GroupType& type = ConfigurationManager::GroupType::CONFIGURATION_TYPE) const;
 	TableGroupKey      					getActiveGroupKey			(const ConfigurationManager::GroupType& type = ConfigurationManager::GroupType::CONFIGURATION_TYPE) const;
 
 	ConfigurationTree 					getNode						(const std::string& nodeString, bool doNotThrowOnBrokenUIDLinks = false) const;  //"root/parent/parent/"
+	ConfigurationTree 					getNode						(const ConfigurationTree::NodePath& nodePath, bool doNotThrowOnBrokenUIDLinks = false) const;
 	std::map<std::string, ConfigurationTree> 
 										getNodes					(const std::string& nodeString) const;
 	ConfigurationTree 					getContextNode				(const std::string& contextUID, const std::string& applicationUID) const;
@@ -205,6 +212,9 @@ const T* retPtr = dynamic_cast<const T*>(srcPtr); if(retPtr == nullptr) { __SS__
 	std::shared_ptr<TableGroupKey> 		makeTheTableGroupKey		(TableGroupKey key);
 	void                           		restoreActiveTableGroups	(bool throwErrors = false, const std::string& pathToActiveGroupsFile = "", ConfigurationManager::LoadGroupType onlyLoadIfBackboneOrContext = ConfigurationManager::LoadGroupType::ALL_TYPES, std::string* accumulatedWarnings = 0);
 
+	void 								clearNodeCache				(void) const;
+	void 								setNodeCacheEnabled			(bool enable);  // e.g. for a manager only used read-only, call before concurrent use
+
 	void 								setOwnerContext				(const std::string& contextUID) { ownerContextUID_ = contextUID; }
 	void 								setOwnerApp					(const std::string& appUID) { ownerAppUID_ = appUID; }
 	static void							saveGroupNameAndKey			(const std::pair<std::string /*group name*/, TableGroupKey>& theGroup,const std::string& fileName);
@@ -218,6 +228,11 @@ const T* retPtr = dynamic_cast<const T*>(srcPtr); if(retPtr == nullptr) { __SS__
 
 	TableBase*							getDesktopIconTable			(void); //to dynamically affect desktop icons in otherwise readonly environment (e.g. GatewaySupervisor add icon behavior)
 
+	bool								isNodeCacheEnabled			(void) const { return nodeCacheEnabled_; }
+	std::shared_ptr<const ConfigurationTree>
+										findCachedNode				(const std::string& cacheKey, unsigned long& activeViewChangeCount) const;
+	void								cacheNode					(const std::string& cacheKey, const ConfigurationTree& node, unsigned long activeViewChangeCount) const;
+
 	void 								initializeFromFhicl			(const std::string& fhiclPath);
 	void 								recursiveInitFromFhiclPSet	(const std::string& tableName, const fhicl::ParameterSet& pset, const std::string& recordName = "", const std::string& groupName = "", const std::string& groupLinkIndex = "");
 	void 								recursiveTreeToFhicl		(ConfigurationTree node, std::ostream& out, std::string& tabStr, std::string& commentStr, unsigned int depth = -1);
@@ -247,6 +262,7 @@ const T* retPtr = dynamic_cast<const T*>(srcPtr); if(retPtr == nullptr) { __SS__
 	std::map<std::string, 
 		std::pair<std::string, TableGroupKey>> 			lastFailedGroupLoad_;
 	lastGroupLoad_t										lastGroupLoad_;
+	lastGroupLoadDiff_t									lastGroupLoadDiff_;
 
 
 
@@ -259,6 +275,16 @@ const T* retPtr = dynamic_cast<const T*>(srcPtr); if(retPtr == nullptr) { __SS__
 
 	std::mutex    										metaDataTableMutex_;
 
+	// node resolution cache for getNode(): (start node, multi-part path) -> resolved node
+	//	cleared whenever active table views change (i.e. any TableBase::setActiveView()/deactivate()).
+	//	Only enabled for read-only access, since ConfigurationManagerRW edits views in place.
+	static const size_t									NODE_CACHE_MAX_SIZE;
+	bool												nodeCacheEnabled_;
+	mutable std::mutex									nodeCacheMutex_;
+	mutable unsigned long								nodeCacheActiveViewChangeCount_;  // of cached nodes
+	mutable std::map<std::string /*cache key*/,
+		std::shared_ptr<const ConfigurationTree>>		nodeCache_;
+
 	// clang-format on
 };
 }  // namespace ots
@@ -1,6 +1,7 @@
 #include "otsdaq/ConfigurationInterface/ConfigurationManagerRW.h"
 
 #include <dirent.h>
+#include <sys/stat.h>
 
 
 using namespace ots;
@@ -187,11 +188,12 @@ const std::map<std::string, TableInfo>& ConfigurationManagerRW::getAllTableInfo(
 	// and then which versions
 	__GEN_COUT__ << "======================================================== getAllTableInfo start runtime=" << runTimeSeconds() << __E__;
 	__GEN_COUT__ << "Refreshing all! Extracting list of tables..." << __E__;
-	DIR*                pDIR;
-	struct dirent*      entry;
-	std::string         path              = TABLE_INFO_PATH;
-	char                fileExt[]         = TABLE_INFO_EXT;
-	const unsigned char MIN_TABLE_NAME_SZ = 3;
+	DIR*                     pDIR;
+	struct dirent*           entry;
+	std::string              path              = TABLE_INFO_PATH;
+	char                     fileExt[]         = TABLE_INFO_EXT;
+	const unsigned char      MIN_TABLE_NAME_SZ = 3;
+	std::vector<std::string> tableNames;
 	if((pDIR = opendir(path.c_str())) != 0)
 	{
 		while((entry = readdir(pDIR)) != 0)
@@ -205,41 +207,164 @@ const std::map<std::string, TableInfo>& ConfigurationManagerRW::getAllTableInfo(
 				continue;  // skip different extentions
 
 			entry->d_name[strlen(entry->d_name) - strlen(fileExt)] = '\0';  // remove file extension to get table name
+			tableNames.push_back(entry->d_name);
+		}
+		closedir(pDIR);
+	}
+
+	// check table info file status against the cache, to only parse modified info files
+	//	(a table instance is only reused if it is still the one created here)
+	std::vector<TableInfoFileStatus>                 fileStatuses(tableNames.size());
+	std::vector<std::shared_ptr<ots::TableInfoLoad>> tableInfoLoads(tableNames.size());
+	std::vector<size_t>                              tableInfoLoadIndices;
+	for(size_t i = 0; i < tableNames.size(); ++i)
+	{
+		const std::string& tableName = tableNames[i];
+		struct stat        fileStatus;
+		bool               foundFileStatus = stat((path + tableName + fileExt).c_str(), &fileStatus) == 0;
+
+		fileStatuses[i].modifiedTime_            = foundFileStatus ? fileStatus.st_mtim.tv_sec : 0;
+		fileStatuses[i].modifiedTimeNanoseconds_ = foundFileStatus ? fileStatus.st_mtim.tv_nsec : 0;
+		fileStatuses[i].size_                    = foundFileStatus ? fileStatus.st_size : 0;
+		fileStatuses[i].tablePtr_                = 0;
+
+		auto cacheIt = tableInfoFileCache_.find(tableName);
+		if(foundFileStatus && cacheIt != tableInfoFileCache_.end() && cacheIt->second.modifiedTime_ == fileStatuses[i].modifiedTime_ &&
+		   cacheIt->second.modifiedTimeNanoseconds_ == fileStatuses[i].modifiedTimeNanoseconds_ && cacheIt->second.size_ == fileStatuses[i].size_)
+		{
+			auto tableIt = nameToTableMap_.find(tableName);
+			if(tableIt != nameToTableMap_.end() && tableIt->second == cacheIt->second.tablePtr_)
+				continue;  // reuse existing table instance
+		}
+
+		if(cacheIt != tableInfoFileCache_.end())
+			tableInfoFileCache_.erase(cacheIt);
+
+		tableInfoLoads[i] = std::make_shared<ots::TableInfoLoad>();
+		tableInfoLoadIndices.push_back(i);
+	}  // end table info file status loop
 
-			// 0 will force the creation of new instance (and reload from Info)
-			table = 0;
+	__GEN_COUT__ << "Loading " << tableInfoLoadIndices.size() << " modified table info files of " << tableNames.size() << " tables." << __E__;
 
-			try  // only add valid table instances to maps
+	// load modified table infos (in parallel, if possible)
+	{
+		const int numOfThreads = PROCESSOR_COUNT / 2;
+		if(numOfThreads < 2 || tableInfoLoadIndices.size() < 2)  // no multi-threading
+		{
+			std::shared_ptr<std::atomic<bool>> threadDone = std::make_shared<std::atomic<bool>>(true);
+			for(const auto& i : tableInfoLoadIndices)
+				ConfigurationManagerRW::loadTableInfoThread(this, tableNames[i], tableInfoLoads[i], threadDone);
+		}
+		else  // multi-threading
+		{
+			int threadsLaunched  = 0;
+			int foundThreadIndex = 0;
+
+			std::vector<std::shared_ptr<std::atomic<bool>>> threadDone;
+			for(int i = 0; i < numOfThreads; ++i)
+				threadDone.push_back(std::make_shared<std::atomic<bool>>(true));
+
+			for(const auto& i : tableInfoLoadIndices)
 			{
-				theInterface_->get(table, entry->d_name, 0, 0,
-				                   true);  // dont fill
-			}
-			catch(cet::exception const&)
+				if(threadsLaunched >= numOfThreads)
+				{
+					// find availableThreadIndex
+					foundThreadIndex = -1;
+					while(foundThreadIndex == -1)
+					{
+						for(int j = 0; j < numOfThreads; ++j)
+							if(*(threadDone[j]))
+							{
+								foundThreadIndex = j;
+								break;
+							}
+						if(foundThreadIndex == -1)
+						{
+							__GEN_COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Waiting for available thread..." << __E__;
+							usleep(1000);
+						}
+					}  // end thread search loop
+					threadsLaunched = numOfThreads - 1;
+				}
+				__GEN_COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Starting thread... " << foundThreadIndex << " for " << tableNames[i] << __E__;
+
+				*(threadDone[foundThreadIndex]) = false;
+
+				std::thread([](ConfigurationManagerRW*             theCfgMgr,
+				               std::string                         theTableName,
+				               std::shared_ptr<ots::TableInfoLoad> theTableInfoLoad,
+				               std::shared_ptr<std::atomic<bool>>  theThreadDone) {
+					ConfigurationManagerRW::loadTableInfoThread(theCfgMgr, theTableName, theTableInfoLoad, theThreadDone);
+				},
+				            this,
+				            tableNames[i],
+				            tableInfoLoads[i],
+				            threadDone[foundThreadIndex])
+				    .detach();
+
+				++threadsLaunched;
+				++foundThreadIndex;
+			}  // end table info thread loop
+
+			// check for all threads done
+			do
 			{
-				if(table)
-					delete table;
-				table = 0;
+				foundThreadIndex = -1;
+				for(int j = 0; j < numOfThreads; ++j)
+					if(!*(threadDone[j]))
+					{
+						foundThreadIndex = j;
+						break;
+					}
+				if(foundThreadIndex != -1)
+				{
+					__GEN_COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Waiting for thread to finish... " << foundThreadIndex << __E__;
+					usleep(1000);
+				}
+			} while(foundThreadIndex != -1);  // end thread done search loop
+		}  // end multi-thread handling
+	}  // end load modified table infos
 
-				__GEN_COUT__ << "Skipping! No valid class found for... " << entry->d_name << "\n";
+	// rethrow unexpected errors (as if sequential), after cleaning up all new instances
+	for(const auto& i : tableInfoLoadIndices)
+		if(tableInfoLoads[i]->otherException_)
+		{
+			std::exception_ptr otherException = tableInfoLoads[i]->otherException_;
+			for(const auto& j : tableInfoLoadIndices)
+				if(tableInfoLoads[j]->tablePtr_)
+				{
+					delete tableInfoLoads[j]->tablePtr_;
+					tableInfoLoads[j]->tablePtr_ = 0;
+				}
+			std::rethrow_exception(otherException);
+		}
+
+	for(size_t i = 0; i < tableNames.size(); ++i)
+	{
+		const std::string& tableName = tableNames[i];
+
+		if(tableInfoLoads[i])  // new table instance
+		{
+			table = tableInfoLoads[i]->tablePtr_;
+
+			if(!tableInfoLoads[i]->isValidClass_)
+			{
+				__GEN_COUT__ << "Skipping! No valid class found for... " << tableName << "\n";
 				continue;
 			}
-			catch(std::runtime_error& e)
+			else if(tableInfoLoads[i]->runtimeError_ != "")
 			{
-				if(table)
-					delete table;
-				table = 0;
-
-				__GEN_COUT__ << "Skipping! No valid class found for... " << entry->d_name << "\n";
-				__GEN_COUT__ << "Error: " << e.what() << __E__;
+				__GEN_COUT__ << "Skipping! No valid class found for... " << tableName << "\n";
+				__GEN_COUT__ << "Error: " << tableInfoLoads[i]->runtimeError_ << __E__;
 
 				// for a runtime_error, it is likely that columns are the problem
 				//	the Table Editor needs to still fix these.. so attempt to
 				// 	proceed.
 				if(accumulatedWarnings)
 				{
-					if(errorFilterName == "" || errorFilterName == entry->d_name)
+					if(errorFilterName == "" || errorFilterName == tableName)
 					{
-						*accumulatedWarnings += std::string("\nIn table '") + entry->d_name + "'..." + e.what();  // global accumulate
+						*accumulatedWarnings += std::string("\nIn table '") + tableName + "'..." + tableInfoLoads[i]->runtimeError_;  // global accumulate
 
 						__SS__ << "Attempting to allow illegal columns!" << __E__;
 						*accumulatedWarnings += ss.str();
@@ -251,34 +376,39 @@ const std::map<std::string, TableInfo>& ConfigurationManagerRW::getAllTableInfo(
 					std::string returnedAccumulatedErrors;
 					try
 					{
-						table = new TableBase(entry->d_name, &returnedAccumulatedErrors);
+						table = new TableBase(tableName, &returnedAccumulatedErrors);
 					}
 					catch(...)
 					{
-						__GEN_COUT__ << "Skipping! Allowing illegal columns didn't work either... " << entry->d_name << "\n";
+						__GEN_COUT__ << "Skipping! Allowing illegal columns didn't work either... " << tableName << "\n";
 						continue;
 					}
 					__GEN_COUT__ << "Error (but allowed): " << returnedAccumulatedErrors << __E__;
 
-					if(errorFilterName == "" || errorFilterName == entry->d_name)
-						*accumulatedWarnings += std::string("\nIn table '") + entry->d_name + "'..." + returnedAccumulatedErrors;  // global accumulate
+					if(errorFilterName == "" || errorFilterName == tableName)
+						*accumulatedWarnings += std::string("\nIn table '") + tableName + "'..." + returnedAccumulatedErrors;  // global accumulate
 				}
 				else
 					continue;
 			}
+			else  // cache successful info file load
+			{
+				fileStatuses[i].tablePtr_      = table;
+				tableInfoFileCache_[tableName] = fileStatuses[i];
+			}
 
-			if(nameToTableMap_[entry->d_name])  // handle if instance existed
+			if(nameToTableMap_[tableName])  // handle if instance existed
 			{
 				// copy the temporary versions! (or else all is lost)
-				std::set<TableVersion> versions = nameToTableMap_[entry->d_name]->getStoredVersions();
+				std::set<TableVersion> versions = nameToTableMap_[tableName]->getStoredVersions();
 				for(auto& version : versions)
 					if(version.isTemporaryVersion())
 					{
 						try  // do NOT let TableView::init() throw here
 						{
-							nameToTableMap_[entry->d_name]->setActiveView(version);
+							nameToTableMap_[tableName]->setActiveView(version);
 							table->copyView(  // this calls TableView::init()
-							    nameToTableMap_[entry->d_name]->getView(),
+							    nameToTableMap_[tableName]->getView(),
 							    version,
 							    username_);
 						}
@@ -288,26 +418,27 @@ const std::map<std::string, TableInfo>& ConfigurationManagerRW::getAllTableInfo(
 						}  // just trust configurationBase throws out the failed version
 					}
 
-				delete nameToTableMap_[entry->d_name];
-				nameToTableMap_[entry->d_name] = 0;
+				delete nameToTableMap_[tableName];
+				nameToTableMap_[tableName] = 0;
 			}
 
-			nameToTableMap_[entry->d_name] = table;
+			nameToTableMap_[tableName] = table;
+		}
+		else  // reuse unmodified table instance
+			table = nameToTableMap_[tableName];
 
-			allTableInfo_[entry->d_name].tablePtr_ = table;
-			allTableInfo_[entry->d_name].versions_ = theInterface_->getVersions(table);
+		allTableInfo_[tableName].tablePtr_ = table;
+		allTableInfo_[tableName].versions_ = theInterface_->getVersions(table);
 
-			// also add any existing temporary versions to all table info
-			//	because the interface wont find those versions
-			std::set<TableVersion> versions = nameToTableMap_[entry->d_name]->getStoredVersions();
-			for(auto& version : versions)
-				if(version.isTemporaryVersion())
-				{
-					allTableInfo_[entry->d_name].versions_.emplace(version);
-				}
-		}
-		closedir(pDIR);
-	}
+		// also add any existing temporary versions to all table info
+		//	because the interface wont find those versions
+		std::set<TableVersion> versions = nameToTableMap_[tableName]->getStoredVersions();
+		for(auto& version : versions)
+			if(version.isTemporaryVersion())
+			{
+				allTableInfo_[tableName].versions_.emplace(version);
+			}
+	}  // end table name loop
 	__GEN_COUT__ << "Extracting list of tables complete." << __E__;
 
 
@@ -503,6 +634,51 @@ const std::map<std::string, TableInfo>& ConfigurationManagerRW::getAllTableInfo(
 	return allTableInfo_;
 }  // end getAllTableInfo()
 	
+//==============================================================================
+// loadTableInfoThread()
+//	Constructs a new table instance from its info file, for getAllTableInfo().
+//	Failures are recorded in tableInfoLoad to be handled by the calling thread.
+void ConfigurationManagerRW::loadTableInfoThread(ConfigurationManagerRW* 				cfgMgr,
+													std::string 						tableName,
+													std::shared_ptr<ots::TableInfoLoad>	tableInfoLoad,
+													std::shared_ptr<std::atomic<bool>> 	threadDone)
+{
+	__COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Thread started... " << tableName << __E__;
+
+	// 0 will force the creation of new instance (and reload from Info)
+	TableBase* table = 0;
+
+	try  // only add valid table instances to maps
+	{
+		cfgMgr->theInterface_->get(table, tableName, 0, 0,
+		                           true);  // dont fill
+	}
+	catch(cet::exception const&)
+	{
+		tableInfoLoad->isValidClass_ = false;
+	}
+	catch(std::runtime_error& e)
+	{
+		tableInfoLoad->runtimeError_ = e.what();
+		if(tableInfoLoad->runtimeError_ == "")
+			tableInfoLoad->runtimeError_ = "Unknown runtime error.";
+	}
+	catch(...)
+	{
+		tableInfoLoad->otherException_ = std::current_exception();
+	}
+
+	if(!tableInfoLoad->isValidClass_ || tableInfoLoad->runtimeError_ != "" || tableInfoLoad->otherException_)
+	{
+		if(table)
+			delete table;
+		table = 0;
+	}
+
+	tableInfoLoad->tablePtr_ = table;
+	*(threadDone)            = true;
+}  // end loadTableInfoThread()
+
 //==============================================================================
 // loadTableGroupThread()
 void ConfigurationManagerRW::loadTableGroupThread(ConfigurationManagerRW* 				cfgMgr, 
@@ -3,6 +3,8 @@
 
 #include "otsdaq/ConfigurationInterface/ConfigurationManager.h"
 
+#include <exception>
+
 namespace ots
 {
 struct TableInfo
@@ -16,6 +18,20 @@ struct TableInfo
 	TableBase*             tablePtr_;
 };
 
+struct TableInfoLoad
+{
+	TableInfoLoad()
+	    :  // constructor
+	    tablePtr_(0)
+	    , isValidClass_(true)
+	{}
+
+	TableBase*         tablePtr_;
+	bool               isValidClass_;    // false if no valid class found for table
+	std::string        runtimeError_;    // if not empty, table info failed to load (e.g. column errors)
+	std::exception_ptr otherException_;  // any other failure, to rethrow from calling thread
+};
+
 struct GroupInfo
 {
 	GroupInfo()
@@ -115,6 +131,10 @@ class ConfigurationManagerRW : public ConfigurationManager
 	void 										testXDAQContext					(void);  // for debugging
 
   public:
+	static void 								loadTableInfoThread				(ConfigurationManagerRW* 			cfgMgr,
+																				std::string							tableName,
+																				std::shared_ptr<ots::TableInfoLoad>	theTableInfoLoad,
+																				std::shared_ptr<std::atomic<bool>> 	theThreadDone);
 	static void 								loadTableGroupThread			(ConfigurationManagerRW* 			cfgMgr,
 																				std::string							groupName, 
 																				ots::TableGroupKey					groupKey,
@@ -140,6 +160,17 @@ class ConfigurationManagerRW : public ConfigurationManager
 	std::map<std::string, TableInfo> 								allTableInfo_;
 	std::map<std::string, GroupInfo> 								allGroupInfo_;
 
+	// info file status at time of last table instance construction by getAllTableInfo()
+	//	so that unmodified table info is not parsed again on refresh
+	struct TableInfoFileStatus
+	{
+		time_t												modifiedTime_;
+		long												modifiedTimeNanoseconds_;
+		long long											size_;
+		TableBase*											tablePtr_;
+	};
+	std::map<std::string /*tableName*/, TableInfoFileStatus>		tableInfoFileCache_;
+
 	static std::atomic<bool>										firstTimeConstructed_;
 };
 
@@ -1,5 +1,6 @@
 #include "otsdaq/ConfigurationInterface/ConfigurationTree.h"
 
+#include <cstdint>
 #include <typeinfo>
 
 #include "otsdaq/ConfigurationInterface/ConfigurationManager.h"
@@ -944,11 +945,140 @@ ConfigurationTree ConfigurationTree::recurse(const ConfigurationTree& tree,
 //
 // if doNotThrowOnBrokenUIDLinks
 //		then catch exceptions on UID links and call disconnected
+//
+//	Note: nodes resolved from multi-part paths are memoized by the ConfigurationManager
+//		(see ConfigurationManager::findCachedNode()) until the next active view change.
+//		Single-part lookups are cheaper than the cache.
 ConfigurationTree ConfigurationTree::getNode(const std::string& nodeString, bool doNotThrowOnBrokenUIDLinks) const
 {
 	// __COUT__ << "nodeString=" << nodeString << " len=" << nodeString.length() << __E__;
-	return recursiveGetNode(nodeString, doNotThrowOnBrokenUIDLinks, "" /*originalNodeString*/);
+	const std::string cacheKey = getNodeCacheKey(nodeString, doNotThrowOnBrokenUIDLinks);
+	if(cacheKey.empty())
+		return recursiveGetNode(nodeString, doNotThrowOnBrokenUIDLinks, "" /*originalNodeString*/);
+
+	unsigned long                            activeViewChangeCount;
+	std::shared_ptr<const ConfigurationTree> cachedNode = configMgr_->findCachedNode(cacheKey, activeViewChangeCount);
+	if(cachedNode)
+		return *cachedNode;
+
+	ConfigurationTree node = recursiveGetNode(nodeString, doNotThrowOnBrokenUIDLinks, "" /*originalNodeString*/);
+	configMgr_->cacheNode(cacheKey, node, activeViewChangeCount);
+	return node;
 }  // end getNode() connected to recursiveGetNode()
+
+//==============================================================================
+// getNode
+//	Same as getNode(nodeString) but uses pre-tokenized path, so the path
+//	string is not re-split on every call.
+ConfigurationTree ConfigurationTree::getNode(const ConfigurationTree::NodePath& nodePath, bool doNotThrowOnBrokenUIDLinks) const
+{
+	if(nodePath.getNodeNames().size() == 0)
+	{
+		__SS__ << "Invalid empty node path! Looking for child node '" << nodePath.getPath() << "' from node '" << getValue() << "'..." << __E__;
+
+		ss << nodeDump() << __E__;
+		__SS_THROW__;
+	}
+
+	const std::string cacheKey = nodePath.getNodeNames().size() > 1 ? getNodeCacheKey(nodePath.getPath(), doNotThrowOnBrokenUIDLinks) : "";
+	if(cacheKey.empty())
+		return recurse(*this, nodePath, 0 /*nodeIndex*/, doNotThrowOnBrokenUIDLinks);
+
+	unsigned long                            activeViewChangeCount;
+	std::shared_ptr<const ConfigurationTree> cachedNode = configMgr_->findCachedNode(cacheKey, activeViewChangeCount);
+	if(cachedNode)
+		return *cachedNode;
+
+	ConfigurationTree node = recurse(*this, nodePath, 0 /*nodeIndex*/, doNotThrowOnBrokenUIDLinks);
+	configMgr_->cacheNode(cacheKey, node, activeViewChangeCount);
+	return node;
+}  // end getNode(NodePath)
+
+//==============================================================================
+// recurse
+//	Used by getNode(NodePath) to descend one path part at a time
+ConfigurationTree ConfigurationTree::recurse(const ConfigurationTree&            tree,
+                                             const ConfigurationTree::NodePath& nodePath,
+                                             size_t                              nodeIndex,
+                                             bool                                doNotThrowOnBrokenUIDLinks)
+{
+	if(nodeIndex >= nodePath.getNodeNames().size())
+		return tree;
+	return recurse(tree.recursiveGetNode(nodePath.getNodeNames()[nodeIndex], doNotThrowOnBrokenUIDLinks, nodePath.getPath()),
+	               nodePath,
+	               nodeIndex + 1,
+	               doNotThrowOnBrokenUIDLinks);
+}  // end recurse(NodePath)
+
+//==============================================================================
+// getNodeCacheKey
+//	Returns the key identifying a getNode() request from this node,
+//	or empty string if the request should not be cached (e.g. single-part paths
+//	or disconnected nodes).
+//	Note: the key includes the table view pointer, so that a change of active view
+//		of the starting table never returns a stale node.
+std::string ConfigurationTree::getNodeCacheKey(const std::string& nodeString, bool doNotThrowOnBrokenUIDLinks) const
+{
+	if(!configMgr_ || !configMgr_->isNodeCacheEnabled())
+		return "";
+
+	// only multi-part paths (e.g. "uid/link/col") are worth a cache lookup
+	size_t partIndex = nodeString.find_first_not_of('/');
+	if(partIndex == std::string::npos || (partIndex = nodeString.find('/', partIndex)) == std::string::npos ||
+	   nodeString.find_first_not_of('/', partIndex) == std::string::npos)
+		return "";
+
+	std::string key;
+	if(isRootNode())
+	{
+		key.reserve(3 + nodeString.size());
+		key += 'R';
+		key += doNotThrowOnBrokenUIDLinks ? '1' : '0';
+	}
+	else if(!table_ || !tableView_)
+		return "";  // do not cache descending from disconnected nodes
+	else
+	{
+		key.reserve(80 + nodeString.size());
+		key += 'T';
+		key += doNotThrowOnBrokenUIDLinks ? '1' : '0';
+		key += std::to_string(reinterpret_cast<uintptr_t>(table_));
+		key += ':';
+		key += std::to_string(reinterpret_cast<uintptr_t>(tableView_));
+		key += ':';
+		key += std::to_string(row_);
+		key += ':';
+		key += std::to_string(col_);
+		key += ':';
+		key += groupId_;
+		key += ':';
+		key += childLinkIndex_;
+	}
+	key += '/';
+	key += nodeString;
+	return key;
+}  // end getNodeCacheKey()
+
+//==============================================================================
+// NodePath constructor
+//	split nodeString on '/' and ignore empty path parts
+ConfigurationTree::NodePath::NodePath(const std::string& nodeString) : nodeString_(nodeString)
+{
+	size_t startingIndex = 0, endingIndex;
+	while(startingIndex < nodeString.length())
+	{
+		endingIndex = nodeString.find('/', startingIndex);
+		if(endingIndex == std::string::npos)
+			endingIndex = nodeString.length();
+
+		if(endingIndex > startingIndex)
+			nodeNames_.push_back(nodeString.substr(startingIndex, endingIndex - startingIndex));
+		startingIndex = endingIndex + 1;
+	}
+}  // end NodePath constructor
+
+//==============================================================================
+// recursiveGetNode
 ConfigurationTree ConfigurationTree::recursiveGetNode(const std::string& nodeString,
                                                       bool               doNotThrowOnBrokenUIDLinks,
                                                       const std::string& originalNodeString) const
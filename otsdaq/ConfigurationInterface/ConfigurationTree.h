@@ -120,6 +120,24 @@ class ConfigurationTree
 
 	static const std::string ROOT_NAME;
 
+	//==============================================================================
+	// NodePath
+	//	Pre-tokenized node path for repeated lookups of the same path,
+	//	e.g. in loops over records, to avoid re-splitting the path string on each
+	//	getNode(). Empty path parts (i.e. repeated '/') are ignored, as in getNode().
+	class NodePath
+	{
+	  public:
+		NodePath(const std::string& nodeString);
+
+		const std::string&              getPath			(void) const { return nodeString_; }
+		const std::vector<std::string>& getNodeNames	(void) const { return nodeNames_; }
+
+	  private:
+		std::string              nodeString_;
+		std::vector<std::string> nodeNames_;
+	};
+
 	struct BitMap
 	{
 		BitMap() : isDefault_(true), zero_(0) {}
@@ -187,6 +205,7 @@ class ConfigurationTree
   public:
 	// navigating between nodes
 	ConfigurationTree 							getNode						(const std::string& nodeName, bool doNotThrowOnBrokenUIDLinks = false) const;
+	ConfigurationTree 							getNode						(const ConfigurationTree::NodePath& nodePath, bool doNotThrowOnBrokenUIDLinks = false) const;
 	std::map<std::string, ConfigurationTree>	getNodes					(const std::string& nodeString) const;
 	ConfigurationTree 							getBackNode					(std::string nodeName, unsigned int backSteps = 1) const;
 	ConfigurationTree 							getForwardNode				(std::string  nodeName, unsigned int forwardSteps = 1) const;
@@ -313,6 +332,8 @@ class ConfigurationTree
 	                  const unsigned int                 col = TableView::INVALID);
 
 	static ConfigurationTree 					recurse						(const ConfigurationTree& t, const std::string& childPath, bool doNotThrowOnBrokenUIDLinks, const std::string& originalNodeString);
+	static ConfigurationTree 					recurse						(const ConfigurationTree& t, const ConfigurationTree::NodePath& nodePath, size_t nodeIndex, bool doNotThrowOnBrokenUIDLinks);
+	std::string              					getNodeCacheKey				(const std::string& nodeString, bool doNotThrowOnBrokenUIDLinks) const;
 	ConfigurationTree        					recursiveGetNode			(const std::string& nodeName, bool doNotThrowOnBrokenUIDLinks, const std::string& originalNodeString) const;
 	static void              					recursivePrint				(const ConfigurationTree& t, unsigned int depth, std::ostream& out, std::string space);
 
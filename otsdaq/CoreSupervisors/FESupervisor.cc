@@ -195,20 +195,9 @@ try
 		__SUP_COUTV__(targetInterfaceID);
 		__SUP_COUTV__(value);
 
-		// test that the interface exists
-		theFEInterfacesManager_->getFEInterface(targetInterfaceID);
+		// place in receive buffer and wake waiting receivers
+		theFEInterfacesManager_->deliverFrontEndCommunication(targetInterfaceID, requester, value);
 
-		// mutex scope
-		{
-			std::lock_guard<std::mutex> lock(theFEInterfacesManager_->frontEndCommunicationReceiveMutex_);
-
-			theFEInterfacesManager_->frontEndCommunicationReceiveBuffer_[targetInterfaceID][requester].emplace(value);
-
-			__SUP_COUT__ << "Number of target interface ID '" << targetInterfaceID
-			             << "' buffers: " << theFEInterfacesManager_->frontEndCommunicationReceiveBuffer_[targetInterfaceID].size() << __E__;
-			__SUP_COUT__ << "Number of source interface ID '" << requester
-			             << "' values received: " << theFEInterfacesManager_->frontEndCommunicationReceiveBuffer_[targetInterfaceID][requester].size() << __E__;
-		}
 		return SOAPUtilities::makeSOAPMessageReference("Received");
 	}  // end type feSend
 	else if(type == "feMacro")
@@ -390,6 +379,7 @@ try
 		else
 			rxParameters.addParameter("feMacroName");
 		rxParameters.addParameter("targetInterfaceID");
+		rxParameters.addParameter("waitTimeoutMs");  // optional, empty for no wait
 
 		SOAPUtilities::receive(message, rxParameters);
 
@@ -399,14 +389,18 @@ try
 			macroName = rxParameters.getValue("macroName");
 		else
 			macroName = rxParameters.getValue("feMacroName");
+		unsigned int waitTimeoutMs = 0;
+		if(rxParameters.getValue("waitTimeoutMs") != "")
+			StringMacros::getNumber(rxParameters.getValue("waitTimeoutMs"), waitTimeoutMs);
 
 		// LORE__SUP_COUTV__(targetInterfaceID);
 		// LORE__SUP_COUTV__(macroName);
 
-		bool done = false;
+		bool        done = false;
+		std::string progress;
 		try
 		{
-			done = theFEInterfacesManager_->checkMacroMultiDimensional(targetInterfaceID, macroName);
+			done = theFEInterfacesManager_->checkMacroMultiDimensional(targetInterfaceID, macroName, &progress, waitTimeoutMs);
 		}
 		catch(std::runtime_error& e)
 		{
@@ -433,6 +427,7 @@ try
 		xoap::MessageReference replyMessage = SOAPUtilities::makeSOAPMessageReference(type + "Done");
 		SOAPParameters         txParameters;
 		txParameters.addParameter("Done", done ? "1" : "0");
+		txParameters.addParameter("Progress", progress);
 		SOAPUtilities::addParameters(replyMessage, txParameters);
 
 		// LORE__SUP_COUT__ << "Sending FE macro result: " << SOAPUtilities::translate(replyMessage) << __E__;
@@ -496,6 +491,7 @@ xoap::MessageReference FESupervisor::macroMakerSupervisorRequest(xoap::MessageRe
 	//	GetInterfaces
 	//	UniversalWrite
 	//	UniversalRead
+	//	UniversalBulkAccess
 	//	GetInterfaceMacros
 	//	RunInterfaceMacro
 	//	RunMacroMakerMacro
@@ -727,6 +723,93 @@ xoap::MessageReference FESupervisor::macroMakerSupervisorRequest(xoap::MessageRe
 			retParameters.addParameter("dataResult", hexResult);
 			return SOAPUtilities::makeSOAPMessageReference(supervisorClassNoNamespace_ + "aa", retParameters);
 		}
+		else if(request == "UniversalBulkAccess")
+		{
+			if(!theFEInterfacesManager_)
+			{
+				__SUP_SS__ << "No FE Interface Manager! Are you configured?" << __E__;
+				__SUP_SS_THROW__;
+			}
+
+			// Operations := semi-colon-separated list of
+			//	<InterfaceID>,<Address hex>		for a read
+			//	<InterfaceID>,<Address hex>,<Data hex>	for a write
+			SOAPParameters requestParameters;
+			requestParameters.addParameter("Operations");
+			SOAPUtilities::receive(message, requestParameters);
+
+			std::vector<std::string> operations;
+			StringMacros::getVectorFromString(requestParameters.getValue("Operations"), operations, {';'} /*delimeter set*/);
+
+			__SUP_COUTV__(operations.size());
+
+			// hex string to little-endian binary string of given size (truncated or filled with 0s)
+			auto hexToBinary = [](const std::string& hexStr, unsigned int size) {
+				std::string binary(size, 0);
+				char        tmpHex[3] = {0, 0, 0};
+				for(unsigned int i = 0; i < hexStr.size() && i / 2 < size; i += 2)
+				{
+					tmpHex[0] = i + 1 < hexStr.size() ? hexStr[hexStr.size() - 1 - i - 1] : '0';
+					tmpHex[1] = hexStr[hexStr.size() - 1 - i];
+					sscanf(tmpHex, "%hhX", (unsigned char*)&binary[i / 2]);
+				}
+				return binary;
+			};  // end hexToBinary()
+
+			std::vector<std::pair<std::string /*interfaceID*/, FEVInterface::universalAccess_t> > accesses;
+			accesses.reserve(operations.size());
+			for(const auto& operation : operations)
+			{
+				std::vector<std::string> fields;
+				StringMacros::getVectorFromString(operation, fields, {','} /*delimeter set*/);
+				if(fields.size() < 2 || fields.size() > 3)
+				{
+					__SUP_SS__ << "Invalid universal bulk access operation '" << operation << "' - expecting <InterfaceID>,<Address>[,<Data>]" << __E__;
+					__SUP_SS_THROW__;
+				}
+
+				accesses.push_back(std::make_pair(fields[0], FEVInterface::universalAccess_t()));
+				FEVInterface::universalAccess_t& access = accesses.back().second;
+				access.isWrite_                         = fields.size() == 3;
+				try
+				{
+					access.address_ = hexToBinary(fields[1], theFEInterfacesManager_->getInterfaceUniversalAddressSize(fields[0]));
+					if(access.isWrite_)
+						access.data_ = hexToBinary(fields[2], theFEInterfacesManager_->getInterfaceUniversalDataSize(fields[0]));
+				}
+				catch(const std::runtime_error& e)  // e.g. interface not found, reported with the results
+				{
+					access.error_ = e.what();
+				}
+			}
+
+			theFEInterfacesManager_->universalBulkAccess(accesses);
+
+			// Results := semi-colon-separated list in order of operations
+			//	<Data hex> for a read, empty for a write, or Error:<encoded message>
+			std::string results;
+			char        hexstr[3];
+			for(size_t i = 0; i < accesses.size(); ++i)
+			{
+				const FEVInterface::universalAccess_t& access = accesses[i].second;
+				if(i)
+					results += ';';
+				if(access.error_ != "")
+				{
+					__SUP_COUT_ERR__ << "Exception caught during universal bulk access of '" << operations[i] << "': " << access.error_ << __E__;
+					results += "Error:" + StringMacros::encodeURIComponent(access.error_);
+				}
+				else if(!access.isWrite_)
+					for(size_t j = access.data_.size(); j > 0; --j)  // most significant byte first
+					{
+						sprintf(hexstr, "%2.2X", (unsigned char)access.data_[j - 1]);
+						results += hexstr;
+					}
+			}
+
+			retParameters.addParameter("Results", results);
+			return SOAPUtilities::makeSOAPMessageReference(supervisorClassNoNamespace_ + "BulkAccessDone", retParameters);
+		}
 		else if(request == "GetInterfaceMacros")
 		{
 			if(theFEInterfacesManager_)
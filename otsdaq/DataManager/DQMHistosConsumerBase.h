@@ -3,6 +3,7 @@
 
 #include <mutex>
 #include <string>
+#include "otsdaq/ConfigurationInterface/ConfigurationTree.h"
 #include "otsdaq/DataManager/DataConsumer.h"
 #include "otsdaq/RootUtilities/DQMHistosBase.h"
 
@@ -16,6 +17,32 @@ class DQMHistosConsumerBase : public DQMHistosBase, public DataConsumer
 	{
 		;
 	}
+	// configures autosave from the optional AutoSaveIntervalInSeconds and
+	//	BackgroundAutoSave fields of the DQM histos consumer table record
+	DQMHistosConsumerBase(std::string              supervisorApplicationUID,
+	                      std::string              bufferUID,
+	                      std::string              processorUID,
+	                      const ConfigurationTree& theXDAQContextConfigTree,
+	                      const std::string&       configurationPath)
+	    : WorkLoop(processorUID), DataConsumer(supervisorApplicationUID, bufferUID, processorUID, LowConsumerPriority)
+	{
+		ConfigurationTree consumerNode = theXDAQContextConfigTree.getNode(configurationPath);
+		try
+		{
+			if(!consumerNode.getNode("AutoSaveIntervalInSeconds").isDefaultValue())
+				setAutoSaveInterval(consumerNode.getNode("AutoSaveIntervalInSeconds").getValue<unsigned int>());
+		}
+		catch(...)
+		{
+		}  // ignore missing field
+		try
+		{
+			setBackgroundAutoSave(consumerNode.getNode("BackgroundAutoSave").getValue<bool>());
+		}
+		catch(...)
+		{
+		}  // ignore missing field, and autosave on the consumer thread
+	}
 	virtual ~DQMHistosConsumerBase(void) { ; }
 	std::mutex& getFillHistoMutex(void) { return fillHistoMutex_; }
 
@@ -0,0 +1,459 @@
+#include "otsdaq/DataManager/RawDataFileWriter.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <fcntl.h>
+#include <string.h>  //memcpy, strerror
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>  //posix_memalign
+
+using namespace ots;
+
+#undef __MF_SUBJECT__
+#define __MF_SUBJECT__ "RawDataFileWriter"
+
+const size_t RawDataFileWriter::DIRECT_IO_ALIGNMENT = 4096;
+
+//==============================================================================
+RawDataFileWriter::RawDataFileWriter(size_t stagingBufferSize, unsigned int numberOfStagingBuffers, bool useDirectIO)
+    // round up to alignment so that all but the last write of a file are O_DIRECT compatible
+    : stagingBufferSize_(((stagingBufferSize ? stagingBufferSize : 1) + DIRECT_IO_ALIGNMENT - 1) / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT)
+    , useDirectIO_(useDirectIO)
+    , currentBuffer_(-1)
+    , fd_(-1)
+    , fileNumber_(0)
+    , fileOffset_(0)
+    , preOpenFd_(-1)
+    , preOpenDone_(false)
+    , preOpenDirectIO_(false)
+    , ioFailedFileNumber_(0)
+    , closedFileNumber_(0)
+    , exitThread_(false)
+{
+	if(numberOfStagingBuffers < 2)
+		numberOfStagingBuffers = 2;  // at least double-buffered
+
+	for(unsigned int i = 0; i < numberOfStagingBuffers; ++i)
+	{
+		void* buffer = 0;
+		if(posix_memalign(&buffer, DIRECT_IO_ALIGNMENT, stagingBufferSize_) != 0)
+		{
+			for(auto& stagingBuffer : stagingBuffers_)
+				free(stagingBuffer);
+			__SS__ << "Failed to allocate " << numberOfStagingBuffers << " staging buffers of " << stagingBufferSize_ << " bytes for the raw data file writer."
+			       << __E__;
+			__SS_THROW__;
+		}
+		stagingBuffers_.push_back((char*)buffer);
+		freeBuffers_.push_back(i);
+	}
+
+	setp(0, 0);
+	ioThread_ = std::thread([this]() { ioLoop_(); });
+}  // end constructor()
+
+//==============================================================================
+RawDataFileWriter::~RawDataFileWriter(void)
+{
+	try
+	{
+		close();
+	}
+	catch(const std::runtime_error& e)
+	{
+		__COUT_ERR__ << "Error closing raw data file: " << e.what() << __E__;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		exitThread_ = true;
+	}
+	ioCondition_.notify_all();
+	ioThread_.join();
+
+	// remove a pre-opened file that was never used
+	if(preOpenFd_ >= 0)
+	{
+		::close(preOpenFd_);
+		unlink(preOpenRequestPath_.c_str());
+	}
+
+	for(auto& stagingBuffer : stagingBuffers_)
+		free(stagingBuffer);
+}  // end destructor()
+
+//==============================================================================
+// openFile_
+//	Opens for write with O_DIRECT if requested and possible.
+int RawDataFileWriter::openFile_(const std::string& filePath, bool& directIO)
+{
+	int fd   = -1;
+	directIO = false;
+#ifdef O_DIRECT
+	if(useDirectIO_)
+	{
+		fd = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+		if(fd >= 0)
+			directIO = true;
+		else if(errno != EINVAL)  // EINVAL is file system does not support O_DIRECT
+			return -1;
+	}
+#endif
+	if(fd < 0)
+		fd = ::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	return fd;
+}  // end openFile_()
+
+//==============================================================================
+void RawDataFileWriter::open(const std::string& filePath)
+{
+	if(fd_ >= 0)
+		close();
+
+	bool directIO = false;
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		if(preOpenRequestPath_ != "")
+		{
+			consumerCondition_.wait(lock, [this]() { return preOpenDone_; });
+			if(preOpenRequestPath_ == filePath)
+			{
+				fd_      = preOpenFd_;
+				directIO = preOpenDirectIO_;
+			}
+			else if(preOpenFd_ >= 0)  // pre-opened the wrong file, so remove it
+			{
+				__COUT_WARN__ << "Pre-opened raw data file '" << preOpenRequestPath_ << "' was not used, removing it." << __E__;
+				::close(preOpenFd_);
+				unlink(preOpenRequestPath_.c_str());
+			}
+			preOpenRequestPath_ = "";
+			preOpenFd_          = -1;
+			preOpenDone_        = false;
+		}
+	}
+
+	if(fd_ < 0)
+		fd_ = openFile_(filePath, directIO);
+	if(fd_ < 0)
+	{
+		__SS__ << "Can't open raw data file " << filePath << ": " << strerror(errno) << __E__;
+		__SS_THROW__;
+	}
+
+	++fileNumber_;
+	fileOffset_               = 0;
+	fileStatistics_           = fileStatistics_t();
+	fileStatistics_.fileName_ = filePath;
+	fileStatistics_.directIO_ = directIO;
+	fileOpenTime_             = std::chrono::steady_clock::now();
+
+	if(currentBuffer_ < 0)
+		acquireBuffer_();
+}  // end open()
+
+//==============================================================================
+// preOpen
+//	Request the I/O thread to open the next file, so that the open() at
+//	rollover can take the file descriptor without waiting on the file system.
+void RawDataFileWriter::preOpen(const std::string& filePath)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	if(preOpenRequestPath_ != "")
+		return;  // only one pre-open at a time
+	preOpenRequestPath_ = filePath;
+	preOpenFd_          = -1;
+	preOpenDone_        = false;
+	lock.unlock();
+	ioCondition_.notify_one();
+}  // end preOpen()
+
+//==============================================================================
+// close
+//	Hand off the tail of the file and wait for the I/O thread to write it and
+//	close the file, so that any write error of this file is reported here.
+void RawDataFileWriter::close(void)
+{
+	if(fd_ < 0)
+		return;
+
+	handOff_(true /*closeFile*/);
+	fd_ = -1;
+
+	std::string ioError;
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		consumerCondition_.wait(lock, [this]() { return closedFileNumber_ >= fileNumber_; });
+		ioError = closedFileError_;
+	}
+	if(ioError != "")
+	{
+		__SS__ << "Error writing raw data file " << fileStatistics_.fileName_ << ": " << ioError << __E__;
+		__SS_THROW__;
+	}
+}  // end close()
+
+//==============================================================================
+RawDataFileWriter::fileStatistics_t RawDataFileWriter::getLastFileStatistics(void) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return lastFileStatistics_;
+}  // end getLastFileStatistics()
+
+//==============================================================================
+std::string RawDataFileWriter::getIOError(void) const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return ioError_;
+}  // end getIOError()
+
+//==============================================================================
+// acquireBuffer_
+//	Take a free staging buffer as the put area, waiting (a stall) if all
+//	buffers are queued for the I/O thread.
+void RawDataFileWriter::acquireBuffer_(void)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	if(freeBuffers_.size() == 0)
+	{
+		auto stallStart = std::chrono::steady_clock::now();
+		consumerCondition_.wait(lock, [this]() { return freeBuffers_.size() > 0; });
+		++fileStatistics_.stallCount_;
+		fileStatistics_.stallSeconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - stallStart).count();
+	}
+	currentBuffer_ = freeBuffers_.back();
+	freeBuffers_.pop_back();
+	lock.unlock();
+
+	setp(stagingBuffers_[currentBuffer_], stagingBuffers_[currentBuffer_] + stagingBufferSize_);
+}  // end acquireBuffer_()
+
+//==============================================================================
+// handOff_
+//	Queue the current staging buffer for the I/O thread.
+//	When closing, the put area is left empty until the next open().
+void RawDataFileWriter::handOff_(bool closeFile)
+{
+	size_t size = pptr() - pbase();
+
+	writeJob_t job;
+	job.fd_          = fd_;
+	job.fileNumber_  = fileNumber_;
+	job.bufferIndex_ = size ? currentBuffer_ : -1;
+	job.size_        = size;
+	job.offset_      = fileOffset_;
+	job.closeFile_   = closeFile;
+	if(closeFile)
+	{
+		job.statistics_ = fileStatistics_;
+		job.openTime_   = fileOpenTime_;
+	}
+	else
+		job.statistics_.fileName_ = fileStatistics_.fileName_;  // for error messages
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if(!size && currentBuffer_ >= 0)  // nothing to write, return buffer
+			freeBuffers_.push_back(currentBuffer_);
+		if(size || closeFile)
+			jobs_.push_back(job);
+	}
+	ioCondition_.notify_one();
+
+	fileOffset_ += size;
+	currentBuffer_ = -1;
+	setp(0, 0);
+
+	if(!closeFile)
+		acquireBuffer_();
+}  // end handOff_()
+
+//==============================================================================
+RawDataFileWriter::int_type RawDataFileWriter::overflow(int_type c)
+{
+	if(fd_ < 0)
+		return traits_type::eof();
+
+	if(pptr() == epptr())
+		handOff_(false /*closeFile*/);
+
+	if(!traits_type::eq_int_type(c, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+	}
+
+	// report I/O thread errors of this file to the stream (sets badbit)
+	if(ioFailedFileNumber_ == fileNumber_)
+		return traits_type::eof();
+	return traits_type::not_eof(c);
+}  // end overflow()
+
+//==============================================================================
+std::streamsize RawDataFileWriter::xsputn(const char* s, std::streamsize n)
+{
+	if(fd_ < 0)
+		return 0;
+
+	std::streamsize written = 0;
+	while(written < n)
+	{
+		if(pptr() == epptr())
+			handOff_(false /*closeFile*/);
+
+		std::streamsize copySize = std::min(n - written, (std::streamsize)(epptr() - pptr()));
+		memcpy(pptr(), s + written, copySize);
+		pbump(copySize);  // copySize is at most stagingBufferSize_
+		written += copySize;
+	}
+
+	// report I/O thread errors of this file to the stream (sets badbit)
+	if(ioFailedFileNumber_ == fileNumber_)
+		return 0;
+	return written;
+}  // end xsputn()
+
+//==============================================================================
+// seekoff
+//	Only position queries are supported, so that tellp() returns the current
+//	file size.
+RawDataFileWriter::pos_type RawDataFileWriter::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+	if(off == 0 && dir == std::ios_base::cur && (which & std::ios_base::out))
+		return pos_type(off_type(getFileSize()));
+	return pos_type(off_type(-1));
+}  // end seekoff()
+
+//==============================================================================
+// ioLoop_
+//	Dedicated I/O thread: pre-opens files and writes queued staging buffers in order.
+void RawDataFileWriter::ioLoop_(void)
+{
+	double writeSeconds    = 0;  // of the file being written
+	double maxWriteSeconds = 0;
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	while(1)
+	{
+		ioCondition_.wait(lock, [this]() { return exitThread_ || jobs_.size() || (preOpenRequestPath_ != "" && !preOpenDone_); });
+
+		if(preOpenRequestPath_ != "" && !preOpenDone_)
+		{
+			std::string filePath = preOpenRequestPath_;
+			lock.unlock();
+			bool directIO = false;
+			int  fd       = openFile_(filePath, directIO);
+			if(fd < 0)
+				__COUT_WARN__ << "Failed to pre-open raw data file " << filePath << ": " << strerror(errno) << __E__;
+			lock.lock();
+			preOpenFd_       = fd;
+			preOpenDirectIO_ = directIO;
+			preOpenDone_     = true;  // on failure open() retries on the consumer thread
+			consumerCondition_.notify_all();
+			continue;
+		}
+
+		if(jobs_.size() == 0)
+		{
+			if(exitThread_)
+				break;
+			continue;
+		}
+
+		writeJob_t job = jobs_.front();
+		jobs_.pop_front();
+		bool failed = ioError_ != "";
+		lock.unlock();
+
+		if(job.bufferIndex_ >= 0 && !failed)
+		{
+			auto        writeStart = std::chrono::steady_clock::now();
+			const char* data       = stagingBuffers_[job.bufferIndex_];
+			size_t      done       = 0;
+
+#ifdef O_DIRECT
+			// the tail of a file is not block sized, so turn off O_DIRECT for it
+			if(job.size_ % DIRECT_IO_ALIGNMENT)
+			{
+				int flags = fcntl(job.fd_, F_GETFL);
+				if(flags >= 0 && (flags & O_DIRECT))
+					fcntl(job.fd_, F_SETFL, flags & ~O_DIRECT);
+			}
+#endif
+			while(done < job.size_)
+			{
+				ssize_t ret = pwrite(job.fd_, data + done, job.size_ - done, job.offset_ + done);
+				if(ret < 0 && errno == EINTR)
+					continue;
+#ifdef O_DIRECT
+				if(ret < 0 && errno == EINVAL)  // alignment refused, fall back to buffered I/O
+				{
+					int flags = fcntl(job.fd_, F_GETFL);
+					if(flags >= 0 && (flags & O_DIRECT))
+					{
+						fcntl(job.fd_, F_SETFL, flags & ~O_DIRECT);
+						continue;
+					}
+				}
+#endif
+				if(ret <= 0)
+				{
+					std::string error = ret < 0 ? strerror(errno) : "no bytes written";
+					__COUT_ERR__ << "Failed to write raw data file '" << job.statistics_.fileName_ << "' at offset " << job.offset_ + done << ": "
+					             << error << __E__;
+					std::lock_guard<std::mutex> errorLock(mutex_);
+					if(ioError_ == "")
+						ioError_ = error;
+					ioFailedFileNumber_ = job.fileNumber_;
+					break;
+				}
+				done += ret;
+			}
+
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - writeStart).count();
+			writeSeconds += seconds;
+			if(seconds > maxWriteSeconds)
+				maxWriteSeconds = seconds;
+		}
+
+		if(job.closeFile_)
+		{
+			std::string closeError;
+			if(::close(job.fd_) != 0)  // e.g. deferred write back errors
+			{
+				closeError = strerror(errno);
+				__COUT_ERR__ << "Failed to close raw data file '" << job.statistics_.fileName_ << "': " << closeError << __E__;
+			}
+
+			fileStatistics_t& statistics = job.statistics_;
+			statistics.bytes_            = job.offset_ + job.size_;
+			statistics.seconds_          = std::chrono::duration<double>(std::chrono::steady_clock::now() - job.openTime_).count();
+			statistics.writeSeconds_     = writeSeconds;
+			statistics.maxWriteSeconds_  = maxWriteSeconds;
+			if(statistics.seconds_ > 0)
+				statistics.megaBytesPerSecond_ = statistics.bytes_ / 1.e6 / statistics.seconds_;
+			writeSeconds    = 0;
+			maxWriteSeconds = 0;
+
+			__COUT_INFO__ << "Closed raw data file '" << statistics.fileName_ << "' " << statistics.bytes_ << " bytes in " << statistics.seconds_ << " s ("
+			              << statistics.megaBytesPerSecond_ << " MB/s), write time " << statistics.writeSeconds_ << " s (max " << statistics.maxWriteSeconds_
+			              << " s per buffer), " << statistics.stallCount_ << " stalls (" << statistics.stallSeconds_ << " s)"
+			              << (statistics.directIO_ ? ", O_DIRECT" : "") << __E__;
+
+			lock.lock();
+			lastFileStatistics_ = statistics;
+			if(ioError_ == "")
+				ioError_ = closeError;
+			closedFileError_  = ioError_;
+			closedFileNumber_ = job.fileNumber_;
+			ioError_          = "";  // next file starts without error
+		}
+		else
+			lock.lock();
+
+		if(job.bufferIndex_ >= 0)
+			freeBuffers_.push_back(job.bufferIndex_);
+		consumerCondition_.notify_all();
+	}
+}  // end ioLoop_()
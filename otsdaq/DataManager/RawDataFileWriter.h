@@ -0,0 +1,120 @@
+#ifndef _ots_RawDataFileWriter_h_
+#define _ots_RawDataFileWriter_h_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ots
+{
+// RawDataFileWriter
+//	Asynchronous, double-buffered file writer used by RawDataSaverConsumerBase.
+//	It is a std::streambuf, so an std::ostream (e.g. RawDataSaverConsumerBase::outFile_)
+//	can be redirected to it and the consumer thread only copies into page-aligned
+//	staging buffers. Full buffers are handed to a dedicated I/O thread which
+//	writes them with pwrite (O_DIRECT when the file system allows it).
+//	The consumer thread only blocks (a "stall") when all staging buffers are
+//	waiting on disk.
+//
+//	The next file of a split can be pre-opened by the I/O thread with preOpen(), so
+//	that the open() at rollover does not wait on the file system.
+//	Throughput and stall statistics are kept per file, logged at close, and
+//	available through getLastFileStatistics().
+class RawDataFileWriter : public std::streambuf
+{
+	// clang-format off
+  public:
+	static const size_t 	DIRECT_IO_ALIGNMENT;
+
+	struct fileStatistics_t
+	{
+		std::string 	fileName_;
+		uint64_t 		bytes_ 				= 0;
+		double 			seconds_ 			= 0;  // from open to end of close
+		double 			megaBytesPerSecond_ = 0;
+		double 			writeSeconds_ 		= 0;  // time spent in pwrite
+		double 			maxWriteSeconds_ 	= 0;  // worst single buffer write latency
+		unsigned int 	stallCount_ 		= 0;  // times the consumer waited for a free buffer
+		double 			stallSeconds_ 		= 0;
+		bool 			directIO_ 			= false;
+	};
+
+	RawDataFileWriter(size_t stagingBufferSize = 4 << 20, unsigned int numberOfStagingBuffers = 2, bool useDirectIO = true);
+	virtual ~RawDataFileWriter(void);  // closes the current file and waits for all data to be written
+
+	void					open					(const std::string& filePath);  // throws on failure
+	void					preOpen					(const std::string& filePath);  // open next file in the I/O thread, ahead of open()
+	void					close					(void);  // hands off remaining data and waits for the I/O thread to close the file, throws on write errors of the file
+	bool					isOpen					(void) const { return fd_ >= 0; }
+	const std::string&		getPreOpenFilePath		(void) const { return preOpenRequestPath_; }
+
+	uint64_t				getFileSize				(void) const { return fileOffset_ + (pptr() - pbase()); }
+	fileStatistics_t		getLastFileStatistics	(void) const;
+	std::string				getIOError				(void) const;  // first I/O thread error of the current file, empty if none
+
+  protected:
+	// std::streambuf
+	virtual int_type		overflow				(int_type c) override;
+	virtual std::streamsize	xsputn					(const char* s, std::streamsize n) override;
+	virtual pos_type		seekoff					(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+	virtual int				sync					(void) override { return 0; }  // data is written when a staging buffer fills, or on close
+
+  private:
+	struct writeJob_t
+	{
+		int 				fd_;
+		uint64_t 			fileNumber_;
+		int 				bufferIndex_;  // -1 for no data
+		size_t 				size_;
+		uint64_t 			offset_;
+		bool 				closeFile_;
+		fileStatistics_t 	statistics_;  // file name, and consumer side statistics for close jobs
+		std::chrono::steady_clock::time_point openTime_;  // for close jobs
+	};
+
+	int						openFile_				(const std::string& filePath, bool& directIO);
+	void					handOff_				(bool closeFile);
+	void					acquireBuffer_			(void);
+	void					ioLoop_					(void);
+
+	const size_t 								stagingBufferSize_;
+	const bool 									useDirectIO_;
+	std::vector<char*> 							stagingBuffers_;
+	std::vector<int> 							freeBuffers_;
+	int 										currentBuffer_;
+
+	// consumer side state of the current file
+	int 										fd_;
+	uint64_t 									fileNumber_;  // counts opened files, so errors are attributed to their file
+	uint64_t 									fileOffset_;
+	fileStatistics_t 							fileStatistics_;
+	std::chrono::steady_clock::time_point 		fileOpenTime_;
+
+	mutable std::mutex 							mutex_;
+	std::condition_variable 					ioCondition_;  // I/O thread waits for jobs
+	std::condition_variable 					consumerCondition_;  // consumer waits for buffers or pre-open
+	std::deque<writeJob_t> 						jobs_;
+	std::string 								preOpenRequestPath_;  // pre-open for I/O thread, empty if none
+	int 										preOpenFd_;
+	bool 										preOpenDone_;
+	bool 										preOpenDirectIO_;
+	std::string 								ioError_;  // first error of the file being written by the I/O thread
+	std::atomic<uint64_t> 						ioFailedFileNumber_;  // file of the last write error (0 if none), to check without the lock
+	uint64_t 									closedFileNumber_;  // last file closed by the I/O thread
+	std::string 								closedFileError_;  // first error of that file, for close()
+	fileStatistics_t 							lastFileStatistics_;
+	bool 										exitThread_;
+	std::thread 								ioThread_;
+	// clang-format on
+};
+
+}  // namespace ots
+
+#endif
@@ -0,0 +1,461 @@
+#include "otsdaq/DataManager/RawDataIndexedFile.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <zlib.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept> /*runtime_error*/
+
+using namespace ots;
+
+#undef __MF_SUBJECT__
+#define __MF_SUBJECT__ "RawDataIndexedFile"
+
+const std::string RawDataIndexedFile::FILE_EXTENSION = ".ridx";
+
+const size_t RawDataIndexedFileReader::NOT_FOUND = (size_t)-1;
+
+namespace
+{
+const char FILE_MAGIC[8]        = {'O', 'T', 'S', 'R', 'A', 'W', '1', '\0'};
+const char BLOCK_MAGIC[4]       = {'R', 'A', 'W', 'B'};
+const char BLOCK_INDEX_MAGIC[4] = {'R', 'A', 'W', 'I'};
+
+const size_t BLOCK_HEADER_SIZE  = sizeof(BLOCK_MAGIC) + 3 * sizeof(uint32_t) + sizeof(uint64_t) + 2 * sizeof(int64_t);
+const size_t INDEX_TRAILER_SIZE = sizeof(BLOCK_INDEX_MAGIC) + sizeof(uint32_t) + sizeof(uint64_t);
+}  // namespace
+
+static_assert(sizeof(RawDataIndexedFile::blockIndex_t) == 40, "Raw data indexed file block index entry must be 40 bytes.");
+
+//==============================================================================
+RawDataIndexedFileWriter::RawDataIndexedFileWriter(unsigned int blockSize, bool compress)
+    : blockSize_(blockSize ? blockSize : 1)
+    , compress_(compress)
+    , output_(0)
+    , failed_(false)
+    , outputOffset_(0)
+    , packetStart_(0)
+    , numberOfPackets_(0)
+    , firstTimeMs_(0)
+    , lastTimeMs_(0)
+{
+	block_.reserve(blockSize_ + (blockSize_ >> 2));
+}  // end constructor()
+
+//==============================================================================
+void RawDataIndexedFileWriter::open(std::streambuf* output)
+{
+	output_          = output;
+	failed_          = false;
+	outputOffset_    = 0;
+	packetStart_     = 0;
+	numberOfPackets_ = 0;
+	block_.clear();
+	packetSizes_.clear();
+	blockIndex_.clear();
+}  // end open()
+
+//==============================================================================
+// endFileHeader
+//	Write the file header, including the bytes written since open().
+void RawDataIndexedFileWriter::endFileHeader(void)
+{
+	uint32_t tmp;
+	writeOutput_(FILE_MAGIC, sizeof(FILE_MAGIC));
+	tmp = blockSize_;
+	writeOutput_(&tmp, sizeof(tmp));
+	tmp = compress_ ? RawDataIndexedFile::COMPRESSION_ZLIB : RawDataIndexedFile::COMPRESSION_NONE;
+	writeOutput_(&tmp, sizeof(tmp));
+	tmp = block_.size();
+	writeOutput_(&tmp, sizeof(tmp));
+	writeOutput_(block_.data(), block_.size());
+	block_.clear();
+	packetStart_ = 0;
+}  // end endFileHeader()
+
+//==============================================================================
+void RawDataIndexedFileWriter::endPacket(int64_t timeMs)
+{
+	if(packetSizes_.size() == 0)
+		firstTimeMs_ = timeMs;
+	lastTimeMs_ = timeMs;
+
+	packetSizes_.push_back(block_.size() - packetStart_);
+	packetStart_ = block_.size();
+	++numberOfPackets_;
+
+	if(block_.size() >= blockSize_)
+		writeBlock_();
+}  // end endPacket()
+
+//==============================================================================
+// close
+//	Write the last block, the block index, and the file footer (the bytes
+//	written since the last packet).
+void RawDataIndexedFileWriter::close(void)
+{
+	if(!output_)
+		return;
+
+	writeBlock_();
+
+	uint64_t indexOffset = outputOffset_;
+	if(blockIndex_.size())
+		writeOutput_(&blockIndex_[0], blockIndex_.size() * sizeof(RawDataIndexedFile::blockIndex_t));
+
+	uint32_t tmp = block_.size();
+	writeOutput_(&tmp, sizeof(tmp));
+	writeOutput_(block_.data(), block_.size());
+	block_.clear();
+
+	writeOutput_(BLOCK_INDEX_MAGIC, sizeof(BLOCK_INDEX_MAGIC));
+	tmp = blockIndex_.size();
+	writeOutput_(&tmp, sizeof(tmp));
+	writeOutput_(&indexOffset, sizeof(indexOffset));
+
+	output_ = 0;
+	if(failed_)
+	{
+		__SS__ << "Failed to write raw data indexed file." << __E__;
+		__SS_THROW__;
+	}
+}  // end close()
+
+//==============================================================================
+void RawDataIndexedFileWriter::writeOutput_(const void* data, size_t size)
+{
+	if(failed_ || !size)
+		return;
+	if(output_->sputn((const char*)data, size) != (std::streamsize)size)
+		failed_ = true;
+	outputOffset_ += size;
+}  // end writeOutput_()
+
+//==============================================================================
+// writeBlock_
+//	Write the complete packets as a block, compressed if that makes it smaller.
+void RawDataIndexedFileWriter::writeBlock_(void)
+{
+	if(packetSizes_.size() == 0)
+		return;
+
+	RawDataIndexedFile::blockIndex_t index;
+	index.offset_            = outputOffset_;
+	index.firstPacketNumber_ = numberOfPackets_ - packetSizes_.size();
+	index.firstTimeMs_       = firstTimeMs_;
+	index.lastTimeMs_        = lastTimeMs_;
+	index.numberOfPackets_   = packetSizes_.size();
+	index.reserved_          = 0;
+
+	uint32_t    sizeTableSize    = packetSizes_.size() * sizeof(uint32_t);
+	uint32_t    uncompressedSize = sizeTableSize + packetStart_;
+	uint32_t    storedSize       = uncompressedSize;
+	const char* stored           = 0;
+
+	if(compress_)
+	{
+		z_stream stream;
+		memset(&stream, 0, sizeof(stream));
+		if(deflateInit(&stream, Z_BEST_SPEED) == Z_OK)
+		{
+			compressed_.resize(deflateBound(&stream, uncompressedSize));
+			stream.next_out  = &compressed_[0];
+			stream.avail_out = compressed_.size();
+
+			stream.next_in  = (Bytef*)&packetSizes_[0];
+			stream.avail_in = sizeTableSize;
+			int ret         = deflate(&stream, Z_NO_FLUSH);
+			if(ret == Z_OK)
+			{
+				stream.next_in  = (Bytef*)block_.data();
+				stream.avail_in = packetStart_;
+				ret             = deflate(&stream, Z_FINISH);
+			}
+			if(ret == Z_STREAM_END && stream.total_out < uncompressedSize)
+			{
+				storedSize = stream.total_out;
+				stored     = (const char*)&compressed_[0];
+			}
+			deflateEnd(&stream);
+		}
+	}
+
+	writeOutput_(BLOCK_MAGIC, sizeof(BLOCK_MAGIC));
+	writeOutput_(&index.numberOfPackets_, sizeof(index.numberOfPackets_));
+	writeOutput_(&uncompressedSize, sizeof(uncompressedSize));
+	writeOutput_(&storedSize, sizeof(storedSize));
+	writeOutput_(&index.firstPacketNumber_, sizeof(index.firstPacketNumber_));
+	writeOutput_(&index.firstTimeMs_, sizeof(index.firstTimeMs_));
+	writeOutput_(&index.lastTimeMs_, sizeof(index.lastTimeMs_));
+	if(stored)
+		writeOutput_(stored, storedSize);
+	else  // not compressed
+	{
+		writeOutput_(&packetSizes_[0], sizeTableSize);
+		writeOutput_(block_.data(), packetStart_);
+	}
+	blockIndex_.push_back(index);
+
+	block_.erase(0, packetStart_);  // keep bytes of pending packet, if any
+	packetStart_ = 0;
+	packetSizes_.clear();
+}  // end writeBlock_()
+
+//==============================================================================
+RawDataIndexedFileWriter::int_type RawDataIndexedFileWriter::overflow(int_type c)
+{
+	if(!output_ || failed_)
+		return traits_type::eof();
+	if(!traits_type::eq_int_type(c, traits_type::eof()))
+		block_.push_back(traits_type::to_char_type(c));
+	return traits_type::not_eof(c);
+}  // end overflow()
+
+//==============================================================================
+std::streamsize RawDataIndexedFileWriter::xsputn(const char* s, std::streamsize n)
+{
+	if(!output_ || failed_)
+		return 0;
+	block_.append(s, n);
+	return n;
+}  // end xsputn()
+
+//==============================================================================
+// seekoff
+//	Only position queries are supported, so that tellp() returns the
+//	approximate file size (bytes written, plus uncompressed bytes pending).
+RawDataIndexedFileWriter::pos_type RawDataIndexedFileWriter::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+	if(off == 0 && dir == std::ios_base::cur && (which & std::ios_base::out))
+		return pos_type(off_type(outputOffset_ + block_.size()));
+	return pos_type(off_type(-1));
+}  // end seekoff()
+
+//==============================================================================
+RawDataIndexedFileReader::RawDataIndexedFileReader(const std::string& filePath)
+    : filePath_(filePath), file_(filePath, std::ios::in | std::ios::binary), closedCleanly_(false), cachedBlock_(NOT_FOUND)
+{
+	if(!file_.is_open())
+	{
+		__SS__ << "Failed to open raw data indexed file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+
+	char     magic[sizeof(FILE_MAGIC)];
+	uint32_t blockSize, headerSize;
+	file_.read(magic, sizeof(magic));
+	file_.read((char*)&blockSize, sizeof(blockSize));
+	file_.read((char*)&compression_, sizeof(uint32_t));
+	file_.read((char*)&headerSize, sizeof(headerSize));
+	if(!file_ || memcmp(magic, FILE_MAGIC, sizeof(magic)) || compression_ > RawDataIndexedFile::COMPRESSION_ZLIB)
+	{
+		__SS__ << "Invalid raw data indexed file header: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+	fileHeader_.resize(headerSize);
+	if(headerSize)
+		read_(&fileHeader_[0], headerSize);
+	firstBlockOffset_ = file_.tellg();
+
+	file_.seekg(0, std::ios::end);
+	fileSize_ = file_.tellg();
+
+	if(!readIndex_())
+		scanBlocks_();
+}  // end constructor()
+
+//==============================================================================
+void RawDataIndexedFileReader::read_(void* data, size_t size)
+{
+	file_.read((char*)data, size);
+	if(!file_)
+	{
+		file_.clear();
+		__SS__ << "Unexpected end of raw data indexed file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+}  // end read_()
+
+//==============================================================================
+// readIndex_
+//	Use the block index at end of file. Returns false if there is none.
+bool RawDataIndexedFileReader::readIndex_(void)
+{
+	if(fileSize_ < firstBlockOffset_ + sizeof(uint32_t) + INDEX_TRAILER_SIZE)
+		return false;
+
+	char     indexMagic[sizeof(BLOCK_INDEX_MAGIC)];
+	uint32_t numberOfBlocks, footerSize;
+	uint64_t indexOffset;
+	file_.seekg(fileSize_ - INDEX_TRAILER_SIZE);
+	file_.read(indexMagic, sizeof(indexMagic));
+	file_.read((char*)&numberOfBlocks, sizeof(numberOfBlocks));
+	file_.read((char*)&indexOffset, sizeof(indexOffset));
+	if(!file_ || memcmp(indexMagic, BLOCK_INDEX_MAGIC, sizeof(indexMagic)) || indexOffset < firstBlockOffset_ ||
+	   indexOffset + numberOfBlocks * sizeof(RawDataIndexedFile::blockIndex_t) + sizeof(footerSize) + INDEX_TRAILER_SIZE > fileSize_)
+	{
+		file_.clear();
+		return false;
+	}
+
+	blockIndex_.resize(numberOfBlocks);
+	file_.seekg(indexOffset);
+	if(numberOfBlocks)
+		file_.read((char*)&blockIndex_[0], numberOfBlocks * sizeof(RawDataIndexedFile::blockIndex_t));
+	file_.read((char*)&footerSize, sizeof(footerSize));
+	if(!file_ || indexOffset + numberOfBlocks * sizeof(RawDataIndexedFile::blockIndex_t) + sizeof(footerSize) + footerSize + INDEX_TRAILER_SIZE != fileSize_)
+	{
+		file_.clear();
+		blockIndex_.clear();
+		return false;
+	}
+	fileFooter_.resize(footerSize);
+	if(footerSize)
+		read_(&fileFooter_[0], footerSize);
+
+	closedCleanly_ = true;
+	return true;
+}  // end readIndex_()
+
+//==============================================================================
+// scanBlocks_
+//	No block index (file not closed cleanly), so walk block headers.
+void RawDataIndexedFileReader::scanBlocks_(void)
+{
+	__COUT__ << "No block index found, walking block headers of raw data indexed file: " << filePath_ << __E__;
+
+	uint64_t                         offset = firstBlockOffset_;
+	char                             blockMagic[sizeof(BLOCK_MAGIC)];
+	uint32_t                         uncompressedSize, storedSize;
+	RawDataIndexedFile::blockIndex_t block;
+	block.reserved_ = 0;
+	while(offset + BLOCK_HEADER_SIZE <= fileSize_)
+	{
+		file_.seekg(offset);
+		file_.read(blockMagic, sizeof(blockMagic));
+		file_.read((char*)&block.numberOfPackets_, sizeof(block.numberOfPackets_));
+		file_.read((char*)&uncompressedSize, sizeof(uncompressedSize));
+		file_.read((char*)&storedSize, sizeof(storedSize));
+		file_.read((char*)&block.firstPacketNumber_, sizeof(block.firstPacketNumber_));
+		file_.read((char*)&block.firstTimeMs_, sizeof(block.firstTimeMs_));
+		file_.read((char*)&block.lastTimeMs_, sizeof(block.lastTimeMs_));
+		if(!file_ || memcmp(blockMagic, BLOCK_MAGIC, sizeof(blockMagic)) || offset + BLOCK_HEADER_SIZE + storedSize > fileSize_)
+			break;  // end of complete blocks
+
+		block.offset_ = offset;
+		blockIndex_.push_back(block);
+		offset += BLOCK_HEADER_SIZE + storedSize;
+	}
+	file_.clear();
+}  // end scanBlocks_()
+
+//==============================================================================
+uint64_t RawDataIndexedFileReader::getNumberOfPackets(void) const
+{
+	if(blockIndex_.size() == 0)
+		return 0;
+	return blockIndex_.back().firstPacketNumber_ + blockIndex_.back().numberOfPackets_;
+}  // end getNumberOfPackets()
+
+//==============================================================================
+size_t RawDataIndexedFileReader::findBlockByPacketNumber(uint64_t packetNumber) const
+{
+	auto it = std::upper_bound(blockIndex_.begin(), blockIndex_.end(), packetNumber, [](uint64_t number, const RawDataIndexedFile::blockIndex_t& block) {
+		return number < block.firstPacketNumber_;
+	});
+	if(it == blockIndex_.begin())
+		return NOT_FOUND;
+	--it;
+	if(packetNumber >= it->firstPacketNumber_ + it->numberOfPackets_)
+		return NOT_FOUND;
+	return it - blockIndex_.begin();
+}  // end findBlockByPacketNumber()
+
+//==============================================================================
+// findBlockByTime
+//	Packet times are the save times, so are in order unless the system clock
+//	was stepped back.
+size_t RawDataIndexedFileReader::findBlockByTime(int64_t timeMs) const
+{
+	auto it = std::lower_bound(blockIndex_.begin(), blockIndex_.end(), timeMs, [](const RawDataIndexedFile::blockIndex_t& block, int64_t time) {
+		return block.lastTimeMs_ < time;
+	});
+	if(it == blockIndex_.end())
+		return NOT_FOUND;
+	return it - blockIndex_.begin();
+}  // end findBlockByTime()
+
+//==============================================================================
+void RawDataIndexedFileReader::readBlock(size_t blockIndex, std::vector<std::string>& packets)
+{
+	packets.clear();
+	if(blockIndex >= blockIndex_.size())
+	{
+		__SS__ << "Block " << blockIndex << " is out of range, there are " << blockIndex_.size() << " blocks in raw data indexed file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+
+	char     blockMagic[sizeof(BLOCK_MAGIC)];
+	uint32_t numberOfPackets, uncompressedSize, storedSize;
+	file_.seekg(blockIndex_[blockIndex].offset_);
+	read_(blockMagic, sizeof(blockMagic));
+	read_(&numberOfPackets, sizeof(numberOfPackets));
+	read_(&uncompressedSize, sizeof(uncompressedSize));
+	read_(&storedSize, sizeof(storedSize));
+	file_.seekg(3 * sizeof(uint64_t), std::ios::cur);  // skip packet number and times, taken from index
+	if(memcmp(blockMagic, BLOCK_MAGIC, sizeof(blockMagic)) || numberOfPackets != blockIndex_[blockIndex].numberOfPackets_ ||
+	   numberOfPackets * sizeof(uint32_t) > uncompressedSize)
+	{
+		__SS__ << "Invalid block header at offset " << blockIndex_[blockIndex].offset_ << " in raw data indexed file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+
+	const char* data = 0;
+	stored_.resize(storedSize);
+	if(storedSize)
+		read_(&stored_[0], storedSize);
+	if(storedSize == uncompressedSize)  // not compressed
+		data = stored_.data();
+	else
+	{
+		uncompressed_.resize(uncompressedSize);
+		uLongf size = uncompressedSize;
+		if(uncompress((Bytef*)&uncompressed_[0], &size, (const Bytef*)stored_.data(), storedSize) != Z_OK || size != uncompressedSize)
+		{
+			__SS__ << "Failed to decompress block at offset " << blockIndex_[blockIndex].offset_ << " in raw data indexed file: " << filePath_ << __E__;
+			__SS_THROW__;
+		}
+		data = uncompressed_.data();
+	}
+
+	const uint32_t* packetSizes = (const uint32_t*)data;
+	size_t          offset      = numberOfPackets * sizeof(uint32_t);
+	packets.resize(numberOfPackets);
+	for(uint32_t i = 0; i < numberOfPackets; ++i)
+	{
+		if(offset + packetSizes[i] > uncompressedSize)
+		{
+			__SS__ << "Invalid packet size in block at offset " << blockIndex_[blockIndex].offset_ << " in raw data indexed file: " << filePath_ << __E__;
+			__SS_THROW__;
+		}
+		packets[i].assign(data + offset, packetSizes[i]);
+		offset += packetSizes[i];
+	}
+}  // end readBlock()
+
+//==============================================================================
+bool RawDataIndexedFileReader::readPacket(uint64_t packetNumber, std::string& packet)
+{
+	size_t blockIndex = findBlockByPacketNumber(packetNumber);
+	if(blockIndex == NOT_FOUND)
+		return false;
+
+	if(blockIndex != cachedBlock_)
+	{
+		cachedBlock_ = NOT_FOUND;
+		readBlock(blockIndex, cachedPackets_);
+		cachedBlock_ = blockIndex;
+	}
+	packet = cachedPackets_[packetNumber - blockIndex_[blockIndex].firstPacketNumber_];
+	return true;
+}  // end readPacket()
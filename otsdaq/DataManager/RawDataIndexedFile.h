@@ -0,0 +1,159 @@
+#ifndef _ots_RawDataIndexedFile_h_
+#define _ots_RawDataIndexedFile_h_
+
+#include <cstdint>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace ots
+{
+// RawDataIndexedFile
+//	Indexed, optionally compressed format for raw data files written by
+//	RawDataSaverConsumerBase. Packets (packet header, data and packet footer, as
+//	written by the plugin) are buffered into blocks of about a fixed uncompressed
+//	size, and each block header carries the packet number and time range of its
+//	packets. On close, a block index is appended so that a reader can find the
+//	block of any packet number or time with a binary search, and only read (and
+//	decompress) that block. If the file was not closed cleanly, the reader walks
+//	the block headers instead.
+//
+//	File Format:
+//		header:
+//			8B magic "OTSRAW1\0"
+//			4B target uncompressed block size in bytes
+//			4B compression (0: none, 1: zlib)
+//			4B sz of file header, file header (as written by plugin writeHeader)
+//		blocks:
+//			4B magic "RAWB"
+//			4B number of packets
+//			4B uncompressed size
+//			4B stored size (equal to uncompressed size if block is not compressed)
+//			8B first packet number (counting from 0 at start of file)
+//			8B first packet time (ms since epoch)
+//			8B last packet time (ms since epoch)
+//			stored data, uncompressed is:
+//				4B sz per packet
+//				packets
+//		block index (only if closed cleanly):
+//			blockIndex_t per block (40B each)
+//			4B sz of file footer, file footer (as written by plugin writeFooter)
+//			4B magic "RAWI"
+//			4B number of blocks
+//			8B file offset of block index
+class RawDataIndexedFile
+{
+	// clang-format off
+  public:
+	static const std::string FILE_EXTENSION;
+
+	enum
+	{
+		COMPRESSION_NONE = 0,
+		COMPRESSION_ZLIB = 1,
+	};
+
+	struct blockIndex_t
+	{
+		uint64_t 	offset_;  // file offset of block header
+		uint64_t 	firstPacketNumber_;
+		int64_t 	firstTimeMs_;
+		int64_t 	lastTimeMs_;
+		uint32_t 	numberOfPackets_;
+		uint32_t 	reserved_;
+	};
+	// clang-format on
+};
+
+// RawDataIndexedFileWriter
+//	A std::streambuf placed in front of the output file buffer (std::filebuf or
+//	RawDataFileWriter). Bytes written to it accumulate as the current packet
+//	until endPacket(), and complete blocks are compressed and passed on to the
+//	output buffer. The output buffer is not closed by close().
+class RawDataIndexedFileWriter : public std::streambuf
+{
+	// clang-format off
+  public:
+	RawDataIndexedFileWriter(unsigned int blockSize = 1 << 20, bool compress = true);
+
+	void					open					(std::streambuf* output);
+	void					endFileHeader			(void);  // bytes written since open() become the file header
+	void					endPacket				(int64_t timeMs);  // bytes written since last end become a packet
+	void					close					(void);  // bytes written since last end become the file footer, throws on failure
+
+	bool					isOpen					(void) const { return output_ != 0; }
+	std::streambuf*			getOutput				(void) const { return output_; }
+	uint64_t				getNumberOfPackets		(void) const { return numberOfPackets_; }
+
+  protected:
+	// std::streambuf
+	virtual int_type		overflow				(int_type c) override;
+	virtual std::streamsize	xsputn					(const char* s, std::streamsize n) override;
+	virtual pos_type		seekoff					(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+
+  private:
+	void					writeOutput_			(const void* data, size_t size);
+	void					writeBlock_				(void);
+
+	const unsigned int 						blockSize_;
+	const bool 								compress_;
+	std::streambuf* 						output_;
+	bool 									failed_;
+	uint64_t 								outputOffset_;  // bytes passed to output_
+
+	std::string 							block_;  // packets of the current block, then the pending packet
+	size_t 									packetStart_;  // offset in block_ of the pending packet
+	std::vector<uint32_t> 					packetSizes_;
+	uint64_t 								numberOfPackets_;
+	int64_t 								firstTimeMs_, lastTimeMs_;
+	std::vector<unsigned char> 				compressed_;
+	std::vector<RawDataIndexedFile::blockIndex_t> blockIndex_;
+	// clang-format on
+};
+
+// RawDataIndexedFileReader
+//	Random access to the packets of a RawDataIndexedFile.
+//	Lookups by packet number or time are a binary search on the block index,
+//	and only the found block is read.
+class RawDataIndexedFileReader
+{
+	// clang-format off
+  public:
+	static const size_t 	NOT_FOUND;
+
+	RawDataIndexedFileReader(const std::string& filePath);  // throws on failure
+
+	const std::string&		getFileHeader			(void) const { return fileHeader_; }
+	const std::string&		getFileFooter			(void) const { return fileFooter_; }  // empty if not closed cleanly
+	bool					wasClosedCleanly		(void) const { return closedCleanly_; }
+	const std::vector<RawDataIndexedFile::blockIndex_t>& getBlockIndex (void) const { return blockIndex_; }
+	uint64_t				getNumberOfPackets		(void) const;
+
+	size_t					findBlockByPacketNumber	(uint64_t packetNumber) const;  // returns NOT_FOUND if out of range
+	size_t					findBlockByTime			(int64_t timeMs) const;  // first block with packets at or after time, or NOT_FOUND
+	void					readBlock				(size_t blockIndex, std::vector<std::string>& packets);
+	bool					readPacket				(uint64_t packetNumber, std::string& packet);  // keeps the last block read for sequential access
+
+  private:
+	void					read_					(void* data, size_t size);
+	bool					readIndex_				(void);
+	void					scanBlocks_				(void);
+
+	const std::string 								filePath_;
+	std::ifstream 									file_;
+	uint64_t 										fileSize_;
+	uint64_t 										firstBlockOffset_;
+	unsigned int 									compression_;
+	std::string 									fileHeader_, fileFooter_;
+	bool 											closedCleanly_;
+	std::vector<RawDataIndexedFile::blockIndex_t> 	blockIndex_;
+	std::vector<char> 								stored_, uncompressed_;
+	size_t 											cachedBlock_;
+	std::vector<std::string> 						cachedPackets_;
+	// clang-format on
+};
+
+}  // namespace ots
+
+#endif
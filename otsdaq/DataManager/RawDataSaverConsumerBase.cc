@@ -4,6 +4,7 @@
 
 #include <unistd.h>
 #include <cassert>
+#include <chrono>
 #include <iostream>
 // #include <string.h> //memcpy
 #include <fstream>
@@ -28,10 +29,90 @@ RawDataSaverConsumerBase::RawDataSaverConsumerBase(std::string              supe
 {
 	// FILE *fp = fopen( "/home/otsdaq/tsave.txt","w");
 	// if(fp)fclose(fp);
+
+	ConfigurationTree consumerNode = theXDAQContextConfigTree.getNode(configurationPath);
+
+	bool         asyncWriterEnabled = false;
+	unsigned int bufferSizeInMB     = 4;
+	unsigned int numberOfBuffers    = 2;
+	bool         directIO           = true;
+	try
+	{
+		asyncWriterEnabled = consumerNode.getNode("AsyncWriterEnabled").getValue<bool>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field, and write on the consumer thread
+	try
+	{
+		if(!consumerNode.getNode("AsyncWriterBufferSizeInMB").isDefaultValue())
+			bufferSizeInMB = consumerNode.getNode("AsyncWriterBufferSizeInMB").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field
+	try
+	{
+		if(!consumerNode.getNode("AsyncWriterNumberOfBuffers").isDefaultValue())
+			numberOfBuffers = consumerNode.getNode("AsyncWriterNumberOfBuffers").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field
+	try
+	{
+		directIO = consumerNode.getNode("AsyncWriterDirectIO").getValue<bool>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field
+
+	if(asyncWriterEnabled)
+	{
+		__CFG_COUT_INFO__ << "Raw data asynchronous writer turned On with " << numberOfBuffers << " buffers of " << bufferSizeInMB << " MB"
+		                  << (directIO ? ", O_DIRECT if possible." : ".") << __E__;
+		asyncWriter_.reset(new RawDataFileWriter(((size_t)bufferSizeInMB) << 20, numberOfBuffers, directIO));
+	}
+
+	bool         indexedFormatEnabled = false;
+	unsigned int blockSizeInKB        = 1024;
+	bool         compression          = true;
+	try
+	{
+		indexedFormatEnabled = consumerNode.getNode("IndexedFormatEnabled").getValue<bool>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field, and write flat file
+	try
+	{
+		if(!consumerNode.getNode("IndexedFormatBlockSizeInKB").isDefaultValue())
+			blockSizeInKB = consumerNode.getNode("IndexedFormatBlockSizeInKB").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field
+	try
+	{
+		compression = consumerNode.getNode("IndexedFormatCompression").getValue<bool>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field
+
+	if(indexedFormatEnabled)
+	{
+		__CFG_COUT_INFO__ << "Raw data indexed format turned On with blocks of " << blockSizeInKB << " kB" << (compression ? ", compressed." : ".") << __E__;
+		indexedWriter_.reset(new RawDataIndexedFileWriter(blockSizeInKB << 10, compression));
+	}
 }
 
 //==============================================================================
-RawDataSaverConsumerBase::~RawDataSaverConsumerBase(void) {}
+RawDataSaverConsumerBase::~RawDataSaverConsumerBase(void)
+{
+	if(asyncWriter_ || indexedWriter_)
+		outFile_.std::ios::rdbuf(outFile_.rdbuf());  // restore file buffer before the writer is destroyed
+}
 
 //==============================================================================
 void RawDataSaverConsumerBase::startProcessingData(std::string runNumber)
@@ -52,34 +133,109 @@ void RawDataSaverConsumerBase::stopProcessingData(void)
 }
 
 //==============================================================================
-void RawDataSaverConsumerBase::openFile(std::string runNumber)
+std::string RawDataSaverConsumerBase::getFileName(const std::string& runNumber, unsigned int subRunNumber) const
 {
-	currentRunNumber_ = runNumber;
 	//	std::string fileName =   "Run" + runNumber + "_" + processorUID_ + "_Raw.dat";
 	std::stringstream fileName;
 	fileName << filePath_ << "/" << fileRadix_ << "_Run" << runNumber;
 	// if split file is there then subrunnumber must be set!
 	if(maxFileSize_ > 0)
-		fileName << "_" << currentSubRunNumber_;
-	fileName << "_Raw.dat";
-	__CFG_COUT__ << "Saving file: " << fileName.str() << std::endl;
-	outFile_.open(fileName.str().c_str(), std::ios::out | std::ios::binary);
-	if(!outFile_.is_open())
+		fileName << "_" << subRunNumber;
+	fileName << "_Raw" << (indexedWriter_ ? RawDataIndexedFile::FILE_EXTENSION : ".dat");
+	return fileName.str();
+}  // end getFileName()
+
+//==============================================================================
+void RawDataSaverConsumerBase::openFile(std::string runNumber)
+{
+	currentRunNumber_    = runNumber;
+	std::string fileName = getFileName(runNumber, currentSubRunNumber_);
+	__CFG_COUT__ << "Saving file: " << fileName << std::endl;
+
+	if(asyncWriter_)
 	{
-		__CFG_SS__ << "Can't open file " << fileName.str() << std::endl;
-		__CFG_SS_THROW__;
+		try
+		{
+			asyncWriter_->open(fileName);
+		}
+		catch(const std::runtime_error& e)
+		{
+			__CFG_SS__ << "Can't open file " << fileName << ": " << e.what() << std::endl;
+			__CFG_SS_THROW__;
+		}
+		outFile_.std::ios::rdbuf(asyncWriter_.get());  // also clears the stream state
+	}
+	else
+	{
+		outFile_.open(fileName.c_str(), std::ios::out | std::ios::binary);
+		if(!outFile_.is_open())
+		{
+			__CFG_SS__ << "Can't open file " << fileName << std::endl;
+			__CFG_SS_THROW__;
+		}
+	}
+
+	if(indexedWriter_)
+	{
+		indexedWriter_->open(outFile_.std::ios::rdbuf());
+		outFile_.std::ios::rdbuf(indexedWriter_.get());
 	}
 
 	writeHeader();  // write start of file header
+
+	if(indexedWriter_)
+		indexedWriter_->endFileHeader();
 }
 
+//==============================================================================
+bool RawDataSaverConsumerBase::isFileOpen(void) const
+{
+	if(asyncWriter_)
+		return asyncWriter_->isOpen();
+	return outFile_.is_open();
+}  // end isFileOpen()
+
 //==============================================================================
 void RawDataSaverConsumerBase::closeFile(void)
 {
-	if(outFile_.is_open())
+	if(!isFileOpen())
+		return;
+
+	writeFooter();  // write end of file footer
+
+	std::string closeError;
+	if(indexedWriter_)
+	{
+		outFile_.std::ios::rdbuf(indexedWriter_->getOutput());
+		try
+		{
+			indexedWriter_->close();  // writes last block and block index
+		}
+		catch(const std::runtime_error& e)
+		{
+			closeError = e.what();
+		}
+	}
+
+	if(asyncWriter_)
 	{
-		writeFooter();  // write end of file footer
+		outFile_.std::ios::rdbuf(outFile_.rdbuf());  // back to the (closed) file buffer
+		try
+		{
+			asyncWriter_->close();  // waits for the I/O thread to finish writing and close the file
+		}
+		catch(const std::runtime_error& e)
+		{
+			closeError += e.what();
+		}
+	}
+	else
 		outFile_.close();
+
+	if(closeError != "")
+	{
+		__CFG_SS__ << "Error closing file: " << closeError << std::endl;
+		__CFG_SS_THROW__;
 	}
 }
 
@@ -138,11 +294,23 @@ void RawDataSaverConsumerBase::save(const std::string& data)
 			++currentSubRunNumber_;
 			openFile(currentRunNumber_);
 		}
+		else if(asyncWriter_ && length >= maxFileSize_ / 1000 * 9 / 10 && asyncWriter_->getPreOpenFilePath() == "")
+			asyncWriter_->preOpen(getFileName(currentRunNumber_, currentSubRunNumber_ + 1));  // open next file ahead of the split
 	}
 
 	writePacketHeader(data);  // write start of packet header
 	outFile_.write((char*)&data[0], data.length());
 	writePacketFooter(data);  // write start of packet footer
+
+	if(indexedWriter_)
+		indexedWriter_->endPacket(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+	if((asyncWriter_ || indexedWriter_) && outFile_.bad())
+	{
+		__CFG_SS__ << "Error writing file " << getFileName(currentRunNumber_, currentSubRunNumber_) << ": "
+		           << (asyncWriter_ ? asyncWriter_->getIOError() : "output stream failure") << std::endl;
+		__CFG_SS_THROW__;
+	}
 }
 
 //==============================================================================
@@ -3,12 +3,24 @@
 
 #include "otsdaq/Configurable/Configurable.h"
 #include "otsdaq/DataManager/DataConsumer.h"
+#include "otsdaq/DataManager/RawDataFileWriter.h"
+#include "otsdaq/DataManager/RawDataIndexedFile.h"
 
 #include <fstream>
+#include <memory>
 #include <string>
 
 namespace ots
 {
+// RawDataSaverConsumerBase
+//	Saves the buffer data to raw files, split in sub-run files of MaxFileSize MB.
+//	With AsyncWriterEnabled, outFile_ is redirected to a RawDataFileWriter so that
+//	disk writes happen on a dedicated I/O thread and the next sub-run file is
+//	pre-opened ahead of the split. In that mode outFile_.is_open() is false, so
+//	plugins should only write to outFile_ and use isFileOpen().
+//	With IndexedFormatEnabled, files are written in the RawDataIndexedFile format
+//	(compressed blocks of packets with a block index), readable with
+//	RawDataIndexedFileReader.
 class RawDataSaverConsumerBase : public DataConsumer, public Configurable
 {
   public:
@@ -22,6 +34,8 @@ class RawDataSaverConsumerBase : public DataConsumer, public Configurable
   protected:
 	virtual void openFile(std::string runNumber);
 	virtual void closeFile(void);
+	bool         isFileOpen(void) const;
+	std::string  getFileName(const std::string& runNumber, unsigned int subRunNumber) const;
 	virtual void save(const std::string& data);
 	virtual void writeHeader(void) { ; }
 	virtual void writeFooter(void) { ; }
@@ -50,6 +64,9 @@ class RawDataSaverConsumerBase : public DataConsumer, public Configurable
 	long         maxFileSize_;
 	std::string  currentRunNumber_;
 	unsigned int currentSubRunNumber_;
+
+	std::unique_ptr<RawDataFileWriter>        asyncWriter_;    // only if AsyncWriterEnabled
+	std::unique_ptr<RawDataIndexedFileWriter> indexedWriter_;  // only if IndexedFormatEnabled
 };
 
 }  // namespace ots
@@ -0,0 +1,416 @@
+#include "otsdaq/FECore/FESlowControlsArchive.h"
+#include "otsdaq/FECore/FESlowControlsChannel.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept> /*runtime_error*/
+
+using namespace ots;
+
+#undef __MF_SUBJECT__
+#define __MF_SUBJECT__ "SlowControlsArchive"
+
+const std::string FESlowControlsArchive::FILE_EXTENSION = ".sca";
+
+namespace
+{
+const char ARCHIVE_MAGIC[8]     = {'O', 'T', 'S', 'S', 'C', 'A', '1', '\0'};
+const char BLOCK_MAGIC[4]       = {'S', 'C', 'A', 'B'};
+const char BLOCK_INDEX_MAGIC[4] = {'S', 'C', 'A', 'I'};
+
+const size_t BLOCK_HEADER_SIZE  = sizeof(BLOCK_MAGIC) + sizeof(uint32_t) + 2 * sizeof(int64_t);
+const size_t INDEX_TRAILER_SIZE = sizeof(BLOCK_INDEX_MAGIC) + sizeof(uint32_t) + sizeof(uint64_t);
+}  // namespace
+
+static_assert(sizeof(FESlowControlsArchive::record_t) == 24, "Slow controls archive record must be 24 bytes.");
+static_assert(sizeof(FESlowControlsArchive::blockIndex_t) == 32, "Slow controls archive block index entry must be 32 bytes.");
+
+//==============================================================================
+FESlowControlsArchive::FESlowControlsArchive(const std::string&                               filePath,
+                                             const std::vector<const FESlowControlsChannel*>& channels,
+                                             unsigned int                                     recordsPerBlock,
+                                             unsigned int                                     maxBlockAgeSeconds)
+    : FESlowControlsArchive(filePath, getChannelInfo(channels), recordsPerBlock, maxBlockAgeSeconds)
+{
+	for(const auto& channel : channels)
+		channelIds_.emplace(channel, channelIds_.size());
+}  // end constructor()
+
+//==============================================================================
+FESlowControlsArchive::FESlowControlsArchive(const std::string&                filePath,
+                                             const std::vector<channelInfo_t>& channels,
+                                             unsigned int                      recordsPerBlock,
+                                             unsigned int                      maxBlockAgeSeconds)
+    : filePath_(filePath)
+    , fp_(0)
+    , numberOfChannels_(channels.size())
+    , recordsPerBlock_(recordsPerBlock ? recordsPerBlock : 1)
+    , maxBlockAgeMs_(maxBlockAgeSeconds * 1000LL)
+{
+	fp_ = fopen(filePath_.c_str(), "wb");
+	if(!fp_)
+	{
+		__SS__ << "Failed to open slow controls archive file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+
+	// write header with channel dictionary
+	bool     writeOk          = fwrite(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC), 1, fp_) == 1;
+	uint32_t numberOfChannels = numberOfChannels_;
+	writeOk                   = writeOk && fwrite(&numberOfChannels, sizeof(numberOfChannels), 1, fp_) == 1;
+
+	for(const auto& channel : channels)
+	{
+		uint16_t tmpSz = channel.name_.size();
+		writeOk        = writeOk && fwrite(&channel.sizeBytes_, 1, 1, fp_) == 1;  // size in bytes
+		writeOk        = writeOk && fwrite(&channel.sizeBits_, 1, 1, fp_) == 1;   // size in bits
+		writeOk        = writeOk && fwrite(&tmpSz, sizeof(tmpSz), 1, fp_) == 1;
+		writeOk        = writeOk && (!tmpSz || fwrite(channel.name_.c_str(), tmpSz, 1, fp_) == 1);
+
+		tmpSz   = channel.dataType_.size();
+		writeOk = writeOk && fwrite(&tmpSz, sizeof(tmpSz), 1, fp_) == 1;
+		writeOk = writeOk && (!tmpSz || fwrite(channel.dataType_.c_str(), tmpSz, 1, fp_) == 1);
+
+		if(channel.sizeBytes_ > MAX_RECORD_VALUE_SIZE)
+			__COUT_WARN__ << "Slow controls channel '" << channel.name_ << "' values are " << (unsigned int)channel.sizeBytes_ << "-bytes, only the first "
+			              << (unsigned int)MAX_RECORD_VALUE_SIZE << "-bytes will be archived." << __E__;
+	}
+
+	if(!writeOk || fflush(fp_))
+	{
+		fclose(fp_);
+		fp_ = 0;
+		__SS__ << "Failed to write the header of slow controls archive file: " << filePath_ << __E__;
+		__SS_THROW__;
+	}
+
+	block_.reserve(recordsPerBlock_);
+
+	__COUT__ << "Slow controls archive opened with " << numberOfChannels << " channels: " << filePath_ << __E__;
+}  // end constructor()
+
+//==============================================================================
+FESlowControlsArchive::~FESlowControlsArchive(void)
+{
+	if(!fp_)
+		return;
+
+	writeBlock();
+
+	// append block index
+	uint64_t indexOffset = ftell(fp_);
+	bool     writeOk     = !blockIndex_.size() || fwrite(&blockIndex_[0], sizeof(blockIndex_t), blockIndex_.size(), fp_) == blockIndex_.size();
+	writeOk              = writeOk && fwrite(BLOCK_INDEX_MAGIC, sizeof(BLOCK_INDEX_MAGIC), 1, fp_) == 1;
+	uint32_t numberOfBlocks = blockIndex_.size();
+	writeOk                 = writeOk && fwrite(&numberOfBlocks, sizeof(numberOfBlocks), 1, fp_) == 1;
+	writeOk                 = writeOk && fwrite(&indexOffset, sizeof(indexOffset), 1, fp_) == 1;
+
+	if(fclose(fp_) || !writeOk)
+		__COUT_ERR__ << "Failed to write the block index of slow controls archive file (readers will walk the block headers instead): " << filePath_
+		             << __E__;
+	else
+		__COUT__ << "Slow controls archive closed with " << numberOfBlocks << " blocks: " << filePath_ << __E__;
+}  // end destructor()
+
+//==============================================================================
+// getChannelInfo
+//	channel dictionary entries for slow controls channels
+std::vector<FESlowControlsArchive::channelInfo_t> FESlowControlsArchive::getChannelInfo(const std::vector<const FESlowControlsChannel*>& channels)
+{
+	std::vector<channelInfo_t> channelInfo(channels.size());
+	for(size_t i = 0; i < channels.size(); ++i)
+	{
+		channelInfo[i].name_      = channels[i]->fullChannelName;
+		channelInfo[i].dataType_  = channels[i]->dataType;
+		channelInfo[i].sizeBytes_ = (unsigned char)channels[i]->getDataTypeSizeBytes();
+		channelInfo[i].sizeBits_  = (unsigned char)channels[i]->getDataTypeSizeBits();
+	}
+	return channelInfo;
+}  // end getChannelInfo()
+
+//==============================================================================
+// addSample
+//	type is RECORD_TYPE_VALUE, or the alarm type with the alarm threshold as value
+void FESlowControlsArchive::addSample(const FESlowControlsChannel* channel, unsigned char type, const std::string& value)
+{
+	auto it = channelIds_.find(channel);
+	if(it == channelIds_.end())
+	{
+		__COUT_WARN__ << "Ignoring sample from slow controls channel '" << channel->fullChannelName << "' which is not in the archive dictionary." << __E__;
+		return;
+	}
+
+	addRecord(it->second, type, value, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}  // end addSample()
+
+//==============================================================================
+// addRecord
+//	channelId is the index in the archive dictionary, timeMs is ms since epoch
+void FESlowControlsArchive::addRecord(uint32_t channelId, unsigned char type, const std::string& value, int64_t timeMs)
+{
+	if(channelId >= numberOfChannels_)
+	{
+		__COUT_WARN__ << "Ignoring sample from slow controls channel id " << channelId << " which is not in the archive dictionary." << __E__;
+		return;
+	}
+
+	block_.emplace_back();
+	record_t& record  = block_.back();
+	record.channelId_ = channelId;
+	record.type_      = type;
+	memset(record.reserved_, 0, sizeof(record.reserved_));
+	record.timeMs_ = timeMs;
+	memset(record.value_, 0, sizeof(record.value_));
+	memcpy(record.value_, value.data(), value.size() < sizeof(record.value_) ? value.size() : sizeof(record.value_));
+
+	if(block_.size() >= recordsPerBlock_)
+		writeBlock();
+}  // end addRecord()
+
+//==============================================================================
+// flush
+//	write the pending block if it is older than the max block age (or forced),
+//	so that a partially filled block is not held in memory for too long
+void FESlowControlsArchive::flush(bool force)
+{
+	if(block_.empty())
+		return;
+
+	if(force ||
+	   std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count() - block_.front().timeMs_ >= maxBlockAgeMs_)
+		writeBlock();
+}  // end flush()
+
+//==============================================================================
+// writeBlock
+//	on write failure, the block is dropped and left out of the block index
+bool FESlowControlsArchive::writeBlock(void)
+{
+	if(block_.empty())
+		return true;
+
+	blockIndex_t blockIndex;
+	blockIndex.offset_          = ftell(fp_);
+	blockIndex.firstTimeMs_     = block_.front().timeMs_;
+	blockIndex.lastTimeMs_      = block_.back().timeMs_;
+	blockIndex.numberOfRecords_ = block_.size();
+	blockIndex.reserved_        = 0;
+
+	bool writeOk = fwrite(BLOCK_MAGIC, sizeof(BLOCK_MAGIC), 1, fp_) == 1;
+	writeOk      = writeOk && fwrite(&blockIndex.numberOfRecords_, sizeof(blockIndex.numberOfRecords_), 1, fp_) == 1;
+	writeOk      = writeOk && fwrite(&blockIndex.firstTimeMs_, sizeof(blockIndex.firstTimeMs_), 1, fp_) == 1;
+	writeOk      = writeOk && fwrite(&blockIndex.lastTimeMs_, sizeof(blockIndex.lastTimeMs_), 1, fp_) == 1;
+	writeOk      = writeOk && fwrite(&block_[0], sizeof(record_t), block_.size(), fp_) == block_.size();
+	writeOk      = fflush(fp_) == 0 && writeOk;
+
+	if(writeOk)
+		blockIndex_.push_back(blockIndex);
+	else
+		__COUT_ERR__ << "Failed to write block of " << block_.size() << " records to slow controls archive file: " << filePath_ << __E__;
+
+	block_.clear();
+	return writeOk;
+}  // end writeBlock()
+
+//==============================================================================
+// readIndex
+//	read the channel dictionary and the block index of an archive file.
+//	If there is no block index (file not closed cleanly), the block headers are walked.
+void FESlowControlsArchive::readIndex(const std::string& filePath, std::vector<channelInfo_t>& channels, std::vector<blockIndex_t>& blockIndex)
+{
+	channels.clear();
+	blockIndex.clear();
+
+	FILE* fp = fopen(filePath.c_str(), "rb");
+	if(!fp)
+	{
+		__SS__ << "Failed to open slow controls archive file: " << filePath << __E__;
+		__SS_THROW__;
+	}
+
+	try
+	{
+		char     magic[sizeof(ARCHIVE_MAGIC)];
+		uint32_t numberOfChannels;
+		if(fread(magic, sizeof(magic), 1, fp) != 1 || memcmp(magic, ARCHIVE_MAGIC, sizeof(magic)) ||
+		   fread(&numberOfChannels, sizeof(numberOfChannels), 1, fp) != 1)
+		{
+			__SS__ << "Invalid slow controls archive file header: " << filePath << __E__;
+			__SS_THROW__;
+		}
+
+		channels.resize(numberOfChannels);
+		for(auto& channel : channels)
+		{
+			uint16_t tmpSz;
+			if(fread(&channel.sizeBytes_, 1, 1, fp) != 1 || fread(&channel.sizeBits_, 1, 1, fp) != 1 || fread(&tmpSz, sizeof(tmpSz), 1, fp) != 1)
+			{
+				__SS__ << "Invalid slow controls archive channel dictionary: " << filePath << __E__;
+				__SS_THROW__;
+			}
+			channel.name_.resize(tmpSz);
+			if((tmpSz && fread(&channel.name_[0], tmpSz, 1, fp) != 1) || fread(&tmpSz, sizeof(tmpSz), 1, fp) != 1)
+			{
+				__SS__ << "Invalid slow controls archive channel dictionary: " << filePath << __E__;
+				__SS_THROW__;
+			}
+			channel.dataType_.resize(tmpSz);
+			if(tmpSz && fread(&channel.dataType_[0], tmpSz, 1, fp) != 1)
+			{
+				__SS__ << "Invalid slow controls archive channel dictionary: " << filePath << __E__;
+				__SS_THROW__;
+			}
+		}
+		uint64_t firstBlockOffset = ftell(fp);
+
+		fseek(fp, 0, SEEK_END);
+		uint64_t fileSize = ftell(fp);
+
+		// attempt to use block index at end of file
+		if(fileSize >= firstBlockOffset + INDEX_TRAILER_SIZE)
+		{
+			char     indexMagic[sizeof(BLOCK_INDEX_MAGIC)];
+			uint32_t numberOfBlocks;
+			uint64_t indexOffset;
+			fseek(fp, fileSize - INDEX_TRAILER_SIZE, SEEK_SET);
+			if(fread(indexMagic, sizeof(indexMagic), 1, fp) == 1 && memcmp(indexMagic, BLOCK_INDEX_MAGIC, sizeof(indexMagic)) == 0 &&
+			   fread(&numberOfBlocks, sizeof(numberOfBlocks), 1, fp) == 1 && fread(&indexOffset, sizeof(indexOffset), 1, fp) == 1 &&
+			   indexOffset + numberOfBlocks * sizeof(blockIndex_t) + INDEX_TRAILER_SIZE == fileSize)
+			{
+				blockIndex.resize(numberOfBlocks);
+				fseek(fp, indexOffset, SEEK_SET);
+				if(numberOfBlocks == 0 || fread(&blockIndex[0], sizeof(blockIndex_t), numberOfBlocks, fp) == numberOfBlocks)
+				{
+					fclose(fp);
+					return;
+				}
+				blockIndex.clear();
+			}
+		}
+
+		// no block index, so walk block headers
+		__COUT__ << "No block index found, walking block headers of slow controls archive file: " << filePath << __E__;
+		uint64_t     offset = firstBlockOffset;
+		char         blockMagic[sizeof(BLOCK_MAGIC)];
+		blockIndex_t block;
+		block.reserved_ = 0;
+		while(offset + BLOCK_HEADER_SIZE <= fileSize)
+		{
+			fseek(fp, offset, SEEK_SET);
+			if(fread(blockMagic, sizeof(blockMagic), 1, fp) != 1 || memcmp(blockMagic, BLOCK_MAGIC, sizeof(blockMagic)) ||
+			   fread(&block.numberOfRecords_, sizeof(block.numberOfRecords_), 1, fp) != 1 ||
+			   fread(&block.firstTimeMs_, sizeof(block.firstTimeMs_), 1, fp) != 1 || fread(&block.lastTimeMs_, sizeof(block.lastTimeMs_), 1, fp) != 1 ||
+			   offset + BLOCK_HEADER_SIZE + block.numberOfRecords_ * sizeof(record_t) > fileSize)
+				break;  // end of complete blocks
+
+			block.offset_ = offset;
+			blockIndex.push_back(block);
+			offset += BLOCK_HEADER_SIZE + block.numberOfRecords_ * sizeof(record_t);
+		}
+	}
+	catch(...)
+	{
+		fclose(fp);
+		throw;
+	}
+	fclose(fp);
+}  // end readIndex()
+
+//==============================================================================
+// extract
+//	calls recordHandler for each record of the channel (or all channels if empty name)
+//	in the time range [startTimeMs, endTimeMs], reading only the blocks that overlap the range.
+void FESlowControlsArchive::extract(const std::string&                                         filePath,
+                                    const std::string&                                         channelName,
+                                    int64_t                                                    startTimeMs,
+                                    int64_t                                                    endTimeMs,
+                                    std::function<void(const channelInfo_t&, const record_t&)> recordHandler)
+{
+	std::vector<channelInfo_t> channels;
+	std::vector<blockIndex_t>  blockIndex;
+	readIndex(filePath, channels, blockIndex);
+
+	uint32_t channelId = -1;
+	if(channelName != "")
+	{
+		for(channelId = 0; channelId < channels.size(); ++channelId)
+			if(channels[channelId].name_ == channelName)
+				break;
+		if(channelId == channels.size())
+		{
+			__SS__ << "Slow controls channel '" << channelName << "' not found in archive file: " << filePath << __E__;
+			__SS_THROW__;
+		}
+	}
+
+	FILE* fp = fopen(filePath.c_str(), "rb");
+	if(!fp)
+	{
+		__SS__ << "Failed to open slow controls archive file: " << filePath << __E__;
+		__SS_THROW__;
+	}
+
+	std::vector<record_t> records;
+	for(const auto& block : blockIndex)
+	{
+		if(block.lastTimeMs_ < startTimeMs || block.firstTimeMs_ > endTimeMs)
+			continue;  // skip blocks outside time range
+
+		records.resize(block.numberOfRecords_);
+		fseek(fp, block.offset_ + BLOCK_HEADER_SIZE, SEEK_SET);
+		if(records.size() && fread(&records[0], sizeof(record_t), records.size(), fp) != records.size())
+		{
+			fclose(fp);
+			__SS__ << "Failed to read block at offset " << block.offset_ << " of slow controls archive file: " << filePath << __E__;
+			__SS_THROW__;
+		}
+
+		for(const auto& record : records)
+			if(record.timeMs_ >= startTimeMs && record.timeMs_ <= endTimeMs && (channelName == "" || record.channelId_ == channelId) &&
+			   record.channelId_ < channels.size())
+				recordHandler(channels[record.channelId_], record);
+	}
+	fclose(fp);
+}  // end extract()
+
+//==============================================================================
+// valueToString
+//	interpret record value based on the channel data type (same as aggregate text format)
+std::string FESlowControlsArchive::valueToString(const channelInfo_t& channelInfo, const record_t& record)
+{
+	const std::string& dataType = channelInfo.dataType_;
+	std::stringstream  ss;
+
+	if(dataType.size() && dataType[dataType.size() - 1] == 'b')  // if ends in 'b' then take that many bits
+	{
+		unsigned int sz = channelInfo.sizeBytes_ < sizeof(record.value_) ? channelInfo.sizeBytes_ : sizeof(record.value_);
+		ss << "0x";
+		for(unsigned int i = 0; i < sz; ++i)
+			ss << std::hex << (int)((record.value_[i] >> 4) & 0xF) << (int)((record.value_[i]) & 0xF) << std::dec;
+	}
+	else if(dataType == "char")
+		ss << (int)*((char*)(&record.value_[0]));
+	else if(dataType == "unsigned char")
+		ss << (unsigned int)*((unsigned char*)(&record.value_[0]));
+	else if(dataType == "short")
+		ss << *((short*)(&record.value_[0]));
+	else if(dataType == "unsigned short")
+		ss << *((unsigned short*)(&record.value_[0]));
+	else if(dataType == "int")
+		ss << *((int*)(&record.value_[0]));
+	else if(dataType == "unsigned int")
+		ss << *((unsigned int*)(&record.value_[0]));
+	else if(dataType == "long long")
+		ss << *((long long*)(&record.value_[0]));
+	else if(dataType == "unsigned long long")
+		ss << *((unsigned long long*)(&record.value_[0]));
+	else if(dataType == "float")
+		ss << *((float*)(&record.value_[0]));
+	else if(dataType == "double")
+		ss << *((double*)(&record.value_[0]));
+
+	return ss.str();
+}  // end valueToString()
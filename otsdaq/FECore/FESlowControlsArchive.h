@@ -0,0 +1,116 @@
+#ifndef _ots_FESlowControlsArchive_h_
+#define _ots_FESlowControlsArchive_h_
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ots
+{
+class FESlowControlsChannel;
+
+// FESlowControlsArchive
+//	Compact, indexed binary format for the slow controls aggregate file.
+//	The channel dictionary is written once in the file header, samples are
+//	fixed-size records buffered into blocks, and each block header carries the
+//	time range of its records. On close, a block index is appended so that a
+//	reader can extract a channel/time range by reading only the overlapping blocks.
+//	If the file was not closed cleanly, the reader walks the block headers instead.
+//
+//	File Format:
+//		header:
+//			8B magic "OTSSCA1\0"
+//			4B number of channels
+//			per channel (channel id is the dictionary index):
+//				1B sz of value in bytes, 1B sz of value in bits
+//				2B sz of name, name
+//				2B sz of data type, data type
+//		blocks:
+//			4B magic "SCAB"
+//			4B number of records
+//			8B first record time (ms since epoch)
+//			8B last record time (ms since epoch)
+//			records (record_t, 24B each)
+//		block index (only if closed cleanly):
+//			blockIndex_t per block (32B each)
+//			4B magic "SCAI"
+//			4B number of blocks
+//			8B file offset of block index
+class FESlowControlsArchive
+{
+	// clang-format off
+  public:
+	static const std::string FILE_EXTENSION;
+
+	enum
+	{
+		RECORD_TYPE_VALUE = 0, //alarm types 1: loloalarm, 2: loalarm, 3: hioalarm, 4: hihialarm, with alarm threshold as value
+		MAX_RECORD_VALUE_SIZE = 8,
+	};
+
+	struct record_t
+	{
+		uint32_t 	channelId_;
+		uint8_t 	type_;
+		uint8_t 	reserved_[3];
+		int64_t 	timeMs_;  // ms since epoch
+		uint8_t 	value_[MAX_RECORD_VALUE_SIZE];  // little-endian, zero padded
+	};
+
+	struct channelInfo_t
+	{
+		std::string 	name_;
+		std::string 	dataType_;
+		unsigned char 	sizeBytes_;
+		unsigned char 	sizeBits_;
+	};
+
+	struct blockIndex_t
+	{
+		uint64_t 	offset_;  // file offset of block header
+		int64_t 	firstTimeMs_;
+		int64_t 	lastTimeMs_;
+		uint32_t 	numberOfRecords_;
+		uint32_t 	reserved_;
+	};
+
+	// writer
+	FESlowControlsArchive(const std::string& filePath, const std::vector<const FESlowControlsChannel*>& channels, unsigned int recordsPerBlock = 4096, unsigned int maxBlockAgeSeconds = 10);
+	FESlowControlsArchive(const std::string& filePath, const std::vector<channelInfo_t>& channels, unsigned int recordsPerBlock = 4096, unsigned int maxBlockAgeSeconds = 10);  // channel id is the index in channels
+	~FESlowControlsArchive(void);  // writes remaining block and block index
+
+	void					addSample				(const FESlowControlsChannel* channel, unsigned char type, const std::string& value);
+	void					addRecord				(uint32_t channelId, unsigned char type, const std::string& value, int64_t timeMs);
+	void					flush					(bool force = false);  // writes block if full, too old, or forced
+
+	const std::string&		getFilePath				(void) const { return filePath_; }
+
+	// reader
+	static void				readIndex				(const std::string& filePath, std::vector<channelInfo_t>& channels, std::vector<blockIndex_t>& blockIndex);
+	static void				extract					(const std::string& filePath, const std::string& channelName /* empty for all */,
+													int64_t startTimeMs, int64_t endTimeMs,
+													std::function<void(const channelInfo_t&, const record_t&)> recordHandler);
+	static std::string		valueToString			(const channelInfo_t& channelInfo, const record_t& record);
+
+  private:
+	static std::vector<channelInfo_t> getChannelInfo	(const std::vector<const FESlowControlsChannel*>& channels);
+	bool					writeBlock				(void);  // returns false on write failure
+
+	const std::string 										filePath_;
+	FILE* 													fp_;
+	const uint32_t 											numberOfChannels_;
+	std::unordered_map<const FESlowControlsChannel*,
+		uint32_t>											channelIds_;
+	std::vector<record_t> 									block_;
+	const unsigned int 										recordsPerBlock_;
+	const int64_t 											maxBlockAgeMs_;
+	std::vector<blockIndex_t> 								blockIndex_;
+	// clang-format on
+};
+
+}  // namespace ots
+
+#endif
@@ -1,8 +1,14 @@
 #include "otsdaq/FECore/FESlowControlsChannel.h"
+#include "otsdaq/FECore/FESlowControlsArchive.h"
+#include "otsdaq/FECore/FESlowControlsTxPacket.h"
 #include "otsdaq/Macros/BinaryStringMacros.h"
 #include "otsdaq/Macros/CoutMacros.h"
 #include "otsdaq/FECore/FEVInterface.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <stdexcept> /*runtime_error*/
@@ -26,6 +32,9 @@ using namespace ots;
 //				1B sz of value in bits
 //				value or alarm threshold value
 //
+//		or, if the FE enables packed tx format (SlowControlsTxPackedFormat),
+//		multi-sample packets keyed by channel id (see FESlowControlsTxPacket.h)
+//
 ////////////////////////////////////
 
 //==============================================================================
@@ -39,7 +48,7 @@ FESlowControlsChannel::FESlowControlsChannel(FEVInterface* interface,
                                              bool               writeAccess,
                                              bool               monitoringEnabledIn,
                                              bool               recordChangesOnly,
-                                             time_t             delayBetweenSamples,
+                                             double             delayBetweenSamples,
                                              bool               saveEnabled,
                                              const std::string& savePath,
                                              const std::string& saveFileRadix,
@@ -61,7 +70,7 @@ FESlowControlsChannel::FESlowControlsChannel(FEVInterface* interface,
     , writeAccess_(writeAccess)
     , monitoringEnabled(monitoringEnabledIn)
     , recordChangesOnly_(recordChangesOnly)
-    , delayBetweenSamples_(delayBetweenSamples < 1 ? 1 : delayBetweenSamples)  // units of seconds, with 1 minimum
+    , delayBetweenSamples_(delayBetweenSamples <= 0 ? 1 : (delayBetweenSamples < 0.001 ? 0.001 : delayBetweenSamples))  // units of seconds, 1 ms minimum, default to 1 s
     , saveEnabled_(saveEnabled)
     , savePath_(savePath)
     , saveFileRadix_(saveFileRadix)
@@ -73,6 +82,11 @@ FESlowControlsChannel::FESlowControlsChannel(FEVInterface* interface,
     , loAlarmed_(false)
     , hiAlarmed_(false)
     , hihiAlarmed_(false)
+    , deadbandAbsolute_(0)
+    , deadbandRelative_(0)
+    , maxSilenceSeconds_(0)
+    , lastPublishedValue_(0)
+    , txPackedChannelId_(-1)
     , saveFullFileName_(savePath_ + "/" + saveFileRadix_ + "-" + underscoreString(fullChannelName) + "-" + std::to_string(time(0)) +
                         (saveBinaryFormat_ ? ".dat" : ".txt"))
 {
@@ -403,7 +417,11 @@ void FESlowControlsChannel::convertStringToBuffer(const std::string& inString, s
 //==============================================================================
 // handleSample
 //	adds to txBuffer if sample should be sent to monitor server
-void FESlowControlsChannel::handleSample(const std::string& universalReadValue, std::string& txBuffer, FILE* fpAggregate, bool aggregateIsBinaryFormat, bool txBufferUsed)
+//
+//	returns true if the sample passed the publishing filter,
+//	i.e. was sent to the monitor server and should be sent to the metric manager
+bool FESlowControlsChannel::handleSample(
+    const std::string& universalReadValue, std::string& txBuffer, FILE* fpAggregate, bool aggregateIsBinaryFormat, bool txBufferUsed, FESlowControlsArchive* aggregateArchive)
 {
 	// __GEN_COUT__ << "txBuffer size=" << txBuffer.size() << __E__;
 
@@ -418,80 +436,58 @@ void FESlowControlsChannel::handleSample(const std::string& universalReadValue,
 	//			return
 	//
 	//	for interesting value
-	//		if monitoringEnabled
-	//			add packet to buffer
-	//			if alarmsEnabled
-	//				for each alarm add packet to buffer
+	//		if publishing filter passes (first value, heartbeat due, or change outside deadband)
+	//			if monitoringEnabled
+	//				add packet to buffer
+	//		if alarmsEnabled
+	//			for each alarm add packet to buffer
 	//		if localSavingEnabled
 	//			append to file
 
 	//////////////////////////////////////////////////
 
 	lastSampleTime_ = time(0);
-	
-	if(recordChangesOnly_)
+
+	if(recordChangesOnly_ && lastSample_ == sample_)
 	{
-		if(lastSampleTime_ && lastSample_ == sample_)
-		{
-			__GEN_COUT__ << "no change." << __E__;
-			return;  // no change
-		}
+		__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "no change." << __E__;
+		return false;  // no change
 	}
 
-	__GEN_COUT__ << "new value!" << __E__;
+	__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "new value!" << __E__;
 
 	// else we have an interesting value!
-	lastSample_     = sample_;
+	lastSample_ = sample_;
+
+	// publishing filter only limits traffic to the monitor server and metric manager,
+	//	alarms and local saving still see every interesting value
+	double                                sampleValue;
+	bool                                  sampleIsNumber = getSampleAsDouble(sampleValue);
+	std::chrono::steady_clock::time_point now            = std::chrono::steady_clock::now();
+	bool                                  publish        = true;
+
+	if(lastPublishTime_ != std::chrono::steady_clock::time_point() &&  // first value is always published
+	   (maxSilenceSeconds_ <= 0 || now - lastPublishTime_ < std::chrono::duration<double>(maxSilenceSeconds_)) &&  // heartbeat is not due
+	   sampleIsNumber && (deadbandAbsolute_ > 0 || deadbandRelative_ > 0) &&
+	   fabs(sampleValue - lastPublishedValue_) <= std::max(deadbandAbsolute_, deadbandRelative_ * fabs(lastPublishedValue_)))
+	{
+		__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "change within deadband, not publishing." << __E__;
+		publish = false;  // insignificant change
+	}
+	else
+	{
+		lastPublishTime_ = now;
+		if(sampleIsNumber)
+			lastPublishedValue_ = sampleValue;
+	}
 
 	char alarmMask = 0;
 
 	/////////////////////////////////////////////
 	/////////////////////////////////////////////
 	/////////////////////////////////////////////
-	if(monitoringEnabled && txBufferUsed)
-	{
-		// create value packet:
-		//  1B type (0: value, 1: loloalarm, 2: loalarm, 3: hioalarm, 4: hihialarm)
-		//	1B sequence count from channel
-		//	8B time
-		//	4B sz of name
-		//	name
-		//	1B sz of value in bytes
-		//	1B sz of value in bits
-		//	value
-
-		__GEN_COUT__ << "before txBuffer sz=" << txBuffer.size() << __E__;
-		txBuffer.push_back(0);                          // value type
-		txBuffer.push_back(txPacketSequenceNumber_++);  // sequence counter and increment
-
-		txBuffer.resize(txBuffer.size() + sizeof(lastSampleTime_));
-		memcpy(&txBuffer[txBuffer.size() - sizeof(lastSampleTime_)] /*dest*/, &lastSampleTime_ /*src*/, sizeof(lastSampleTime_));
-
-		unsigned int tmpSz = fullChannelName.size();
-
-		txBuffer.resize(txBuffer.size() + sizeof(tmpSz));
-		memcpy(&txBuffer[txBuffer.size() - sizeof(tmpSz)] /*dest*/, &tmpSz /*src*/, sizeof(tmpSz));
-
-		txBuffer += fullChannelName;
-
-		txBuffer.push_back((unsigned char)sample_.size());       // size in bytes
-		txBuffer.push_back((unsigned char)sizeOfDataTypeBits_);  // size in bits
-
-		txBuffer += sample_;
-		__GEN_COUT__ << "after txBuffer sz=" << txBuffer.size() << __E__;
-
-		{  // print
-			__GEN_SS__ << "txBuffer: \n";
-			for(unsigned int i = 0; i < txBuffer.size(); ++i)
-			{
-				ss << std::hex << (int)((txBuffer[i] >> 4) & 0xF) << (int)((txBuffer[i]) & 0xF) << " " << std::dec;
-				if(i % 8 == 7)
-					ss << __E__;
-			}
-			ss << __E__;
-			__GEN_COUT__ << "\n" << ss.str();
-		}
-	}
+	if(publish && monitoringEnabled && txBufferUsed)
+		appendTxRecord(txBuffer, 0 /* value type */, sample_);
 
 	// check alarms
 	if(alarmsEnabled_ && txBufferUsed)
@@ -500,6 +496,23 @@ void FESlowControlsChannel::handleSample(const std::string& universalReadValue,
 	// create array helper for saving
 	std::string* alarmValueArray[] = {&lolo_, &lo_, &hi_, &hihi_};
 
+	/////////////////////////////////////////////
+	/////////////////////////////////////////////
+	/////////////////////////////////////////////
+	if(aggregateArchive)  // aggregate archive means saving enabled at FE level
+	{
+		aggregateArchive->addSample(this, FESlowControlsArchive::RECORD_TYPE_VALUE, sample_);
+
+		// save any alarms as records of type 1, 2, 3, 4 with the alarm threshold as value
+		if(alarmMask)  // if any alarms
+		{
+			char checkMask = 1;  // use mask to maintain alarm mask
+			for(unsigned char i = 1; i < 5; ++i, checkMask <<= 1)
+				if(alarmMask & checkMask)
+					aggregateArchive->addSample(this, i, *alarmValueArray[i - 1]);
+		}
+	}
+
 	/////////////////////////////////////////////
 	/////////////////////////////////////////////
 	/////////////////////////////////////////////
@@ -655,7 +668,7 @@ void FESlowControlsChannel::handleSample(const std::string& universalReadValue,
 		if(!fp)
 		{
 			__GEN_COUT_ERR__ << "Failed to open slow controls channel file: " << saveFullFileName_ << __E__;
-			return;
+			return publish;  // sample was still handled for the monitor server
 		}
 
 		// append to file
@@ -752,7 +765,124 @@ void FESlowControlsChannel::handleSample(const std::string& universalReadValue,
 
 		fclose(fp);
 	}
-}
+
+	return publish;
+}  // end handleSample()
+
+//==============================================================================
+// setPublishingFilter
+//	A sample is only published (sent to monitor server and metric manager) if it differs from
+//	the last published value by more than max(deadbandAbsolute, deadbandRelative * |last published value|),
+//	unless maxSilenceSeconds have passed since the last published value (heartbeat).
+//	Alarm checks and local saving are not filtered.
+//	Deadbands only apply to numeric samples up to 8 bytes; zero disables.
+void FESlowControlsChannel::setPublishingFilter(double deadbandAbsolute, double deadbandRelative, double maxSilenceSeconds)
+{
+	deadbandAbsolute_  = deadbandAbsolute < 0 ? 0 : deadbandAbsolute;
+	deadbandRelative_  = deadbandRelative < 0 ? 0 : deadbandRelative;
+	maxSilenceSeconds_ = maxSilenceSeconds < 0 ? 0 : maxSilenceSeconds;
+
+	__GEN_COUT__ << "Publishing filter for " << fullChannelName << ": deadbandAbsolute=" << deadbandAbsolute_ << " deadbandRelative=" << deadbandRelative_
+	             << " maxSilenceSeconds=" << maxSilenceSeconds_ << __E__;
+}  // end setPublishingFilter()
+
+//==============================================================================
+// getSampleAsDouble
+//	interpret sample_ as a number based on dataType
+//	returns false if sample is not a number that fits in 8 bytes
+bool FESlowControlsChannel::getSampleAsDouble(double& value) const
+{
+	if(sample_.size() == 0 || sample_.size() > sizeof(unsigned long long))
+		return false;
+
+	if(dataType == "float" && sample_.size() == sizeof(float))
+	{
+		float tmp;
+		memcpy(&tmp, &sample_[0], sizeof(tmp));
+		value = tmp;
+		return true;
+	}
+	if(dataType == "double" && sample_.size() == sizeof(double))
+	{
+		memcpy(&value, &sample_[0], sizeof(value));
+		return true;
+	}
+
+	unsigned long long tmp = 0;
+	memcpy(&tmp, &sample_[0], sample_.size());  // little-endian
+
+	if(sample_.size() < sizeof(tmp) &&
+	   (dataType == "char" || dataType == "short" || dataType == "int" || dataType == "long long") &&
+	   (tmp >> (sample_.size() * 8 - 1)) & 1)  // sign extend
+		tmp |= (~0ULL) << (sample_.size() * 8);
+
+	if(dataType == "char" || dataType == "short" || dataType == "int" || dataType == "long long")
+		value = (long long)tmp;
+	else
+		value = tmp;
+	return true;
+}  // end getSampleAsDouble()
+
+//==============================================================================
+// appendTxRecord
+//	add value or alarm record to txBuffer, in legacy format or,
+//	if channel has a packed channel id, in packed format (see Packet Types above)
+void FESlowControlsChannel::appendTxRecord(std::string& txBuffer, unsigned char type, const std::string& value)
+{
+	__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "before txBuffer sz=" << txBuffer.size() << __E__;
+
+	if(txPackedChannelId_ >= 0)
+	{
+		FESlowControlsTxPacket::appendRecord(txBuffer, txPackedChannelId_, type, value);
+
+		__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "after txBuffer sz=" << txBuffer.size() << __E__;
+		return;
+	}
+
+	// create legacy packet:
+	//  1B type (0: value, 1: loloalarm, 2: loalarm, 3: hioalarm, 4: hihialarm)
+	//	1B sequence count from channel
+	//	8B time
+	//	4B sz of name
+	//	name
+	//	1B sz of value in bytes
+	//	1B sz of value in bits
+	//	value
+
+	txBuffer.push_back(type);
+	txBuffer.push_back(txPacketSequenceNumber_++);  // sequence counter and increment
+
+	txBuffer.resize(txBuffer.size() + sizeof(lastSampleTime_));
+	memcpy(&txBuffer[txBuffer.size() - sizeof(lastSampleTime_)] /*dest*/, &lastSampleTime_ /*src*/, sizeof(lastSampleTime_));
+
+	unsigned int tmpSz = fullChannelName.size();
+
+	txBuffer.resize(txBuffer.size() + sizeof(tmpSz));
+	memcpy(&txBuffer[txBuffer.size() - sizeof(tmpSz)] /*dest*/, &tmpSz /*src*/, sizeof(tmpSz));
+
+	txBuffer += fullChannelName;
+
+	txBuffer.push_back((unsigned char)value.size());         // size in bytes
+	txBuffer.push_back((unsigned char)sizeOfDataTypeBits_);  // size in bits
+
+	txBuffer += value;
+	__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "after txBuffer sz=" << txBuffer.size() << __E__;
+
+	__GEN_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << "txBuffer: " << BinaryStringMacros::binaryNumberToHexString(txBuffer, "0x", " ") << __E__;
+}  // end appendTxRecord()
+
+//==============================================================================
+// appendTxPackedDictionaryEntry
+//	add channel id to name mapping for packed tx format (see FESlowControlsTxPacket.h)
+void FESlowControlsChannel::appendTxPackedDictionaryEntry(std::string& txBuffer) const
+{
+	FESlowControlsTxPacket::channelInfo_t channelInfo;
+	channelInfo.name_      = fullChannelName;
+	channelInfo.sizeBytes_ = (unsigned char)((sizeOfDataTypeBits_ + 7) / 8);
+	channelInfo.sizeBits_  = (unsigned char)sizeOfDataTypeBits_;
+
+	FESlowControlsTxPacket::appendDictionaryEntry(txBuffer, txPackedChannelId_, channelInfo);
+}  // end appendTxPackedDictionaryEntry()
 
 //==============================================================================
 // extractSample
@@ -967,50 +1097,8 @@ char FESlowControlsChannel::checkAlarms(std::string& txBuffer)
 		for(int i = 0; i < 4; ++i, checkMask <<= 1)
 			if(createPacketMask & checkMask)
 			{
-				// create alarm packet:
-				//  1B type (0: value, 1: loloalarm, 2: loalarm, 3: hioalarm, 4:
-				//  hihialarm)
-				//	1B sequence count from channel
-				//	8B time
-				//	4B sz of name
-				//	name
-				//	1B sz of alarm value in bytes
-				//	1B sz of alarm value in bits
-				//	alarm value
-
 				__GEN_COUT__ << "Create packet type " << i + 1 << " alarm value = " << *alarmValueArray[i] << __E__;
-
-				__GEN_COUT__ << "before txBuffer sz=" << txBuffer.size() << __E__;
-				txBuffer.push_back(i + 1);                      // alarm packet type
-				txBuffer.push_back(txPacketSequenceNumber_++);  // sequence counter and increment
-
-				txBuffer.resize(txBuffer.size() + sizeof(lastSampleTime_));
-				memcpy(&txBuffer[txBuffer.size() - sizeof(lastSampleTime_)] /*dest*/, &lastSampleTime_ /*src*/, sizeof(lastSampleTime_));
-
-				unsigned int tmpSz = fullChannelName.size();
-
-				txBuffer.resize(txBuffer.size() + sizeof(tmpSz));
-				memcpy(&txBuffer[txBuffer.size() - sizeof(tmpSz)] /*dest*/, &tmpSz /*src*/, sizeof(tmpSz));
-
-				txBuffer += fullChannelName;
-
-				txBuffer.push_back((unsigned char)(*alarmValueArray[i]).size());  // size in bytes
-				txBuffer.push_back((unsigned char)sizeOfDataTypeBits_);           // size in bits
-
-				txBuffer += (*alarmValueArray[i]);
-				__GEN_COUT__ << "after txBuffer sz=" << txBuffer.size() << __E__;
-
-				{  // print
-					__GEN_SS__ << "txBuffer: \n";
-					for(unsigned int i = 0; i < txBuffer.size(); ++i)
-					{
-						ss << std::hex << (int)((txBuffer[i] >> 4) & 0xF) << (int)((txBuffer[i]) & 0xF) << " " << std::dec;
-						if(i % 8 == 7)
-							ss << __E__;
-					}
-					ss << __E__;
-					__GEN_COUT__ << "\n" << ss.str();
-				}
+				appendTxRecord(txBuffer, i + 1 /* alarm type */, *alarmValueArray[i]);
 			}
 	}
 
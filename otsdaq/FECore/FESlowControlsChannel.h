@@ -1,12 +1,15 @@
 #ifndef _ots_FESlowControlsChannel_h_
 #define _ots_FESlowControlsChannel_h_
 
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
 namespace ots
 {
 class FEVInterface;
+class FESlowControlsArchive;
 
 class FESlowControlsChannel
 {
@@ -22,7 +25,7 @@ class FESlowControlsChannel
 	                      bool               writeAccess,
 	                      bool               monitoringEnabled,
 	                      bool               recordChangesOnly,
-	                      time_t             delayBetweenSamples,
+	                      double             delayBetweenSamples /* seconds */,
 	                      bool               saveEnabled,
 	                      const std::string& savePath,
 	                      const std::string& saveFileRadix,
@@ -36,15 +39,19 @@ class FESlowControlsChannel
 
 	~FESlowControlsChannel();
 
-
 	void					print						(std::ostream& out = std::cout) const;
 
 	const std::string&		getUniversalAddress			() const { return universalAddress_; };	
 	unsigned int			getReadSizeBytes 			() const { return sizeOfReadBytes_; }
+	unsigned int			getDataTypeSizeBits 		() const { return sizeOfDataTypeBits_; }
+	unsigned int			getDataTypeSizeBytes 		() const { return sizeOfDataTypeBytes_; }
 	time_t					getLastSampleTime 			() const { return lastSampleTime_; }
 	void					doRead						(std::string& readValue);	
 	const std::string&     	getSample                	() const { return sample_; }
-	void  					handleSample				(const std::string& universalReadValue, std::string& txBuffer, FILE* fpAggregate = 0, bool aggregateIsBinaryFormat = false, bool txBufferUsed = true);
+	bool  					handleSample				(const std::string& universalReadValue, std::string& txBuffer, FILE* fpAggregate = 0, bool aggregateIsBinaryFormat = false, bool txBufferUsed = true, FESlowControlsArchive* aggregateArchive = 0);  // returns true if sample was published
+	void					setPublishingFilter			(double deadbandAbsolute, double deadbandRelative, double maxSilenceSeconds);
+	void					setTxPackedChannelId		(int channelId) { txPackedChannelId_ = channelId; }  // -1 for legacy tx packets, see FESlowControlsTxPacket
+	void					appendTxPackedDictionaryEntry(std::string& txBuffer) const;
 	const std::string&		getLastSampleReadValue		() const { return universalReadValue_; };	
 	void  					clearAlarms					(int targetAlarm = -1);  // default to all
 
@@ -53,6 +60,8 @@ class FESlowControlsChannel
   private:
 	void 					extractSample				();
 	char 					checkAlarms					(std::string& txBuffer);
+	void 					appendTxRecord				(std::string& txBuffer, unsigned char type, const std::string& value);
+	bool 					getSampleAsDouble			(double& value) const;
 	void 					convertStringToBuffer		(const std::string& inString, std::string& buffer, bool useDataType = false);
 
 	FEVInterface* 			interface_;
@@ -75,7 +84,7 @@ class FESlowControlsChannel
   public:
 	const bool   			readAccess_, writeAccess_, monitoringEnabled;
 	const bool   			recordChangesOnly_;
-	const time_t 			delayBetweenSamples_;
+	const double 			delayBetweenSamples_;  // units of seconds, with millisecond resolution
 
 	const bool        		saveEnabled_;
 	const std::string 		savePath_;
@@ -93,6 +102,13 @@ class FESlowControlsChannel
 	time_t      			lastSampleTime_;
 	bool        			loloAlarmed_, loAlarmed_, hiAlarmed_, hihiAlarmed_;
 
+	// publishing filter, applied to monitor server and metric manager traffic only
+	double 					deadbandAbsolute_, deadbandRelative_;  // publish only if change exceeds max(absolute, relative * |last published value|)
+	double 					maxSilenceSeconds_;  // heartbeat: publish at least this often, even without change
+	double 					lastPublishedValue_;
+	std::chrono::steady_clock::time_point lastPublishTime_;  // default (epoch) until first publish
+	int 					txPackedChannelId_;
+
 	const std::string 		saveFullFileName_;
 
 	// clang-format on
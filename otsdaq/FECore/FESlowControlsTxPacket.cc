@@ -0,0 +1,146 @@
+#include "otsdaq/FECore/FESlowControlsTxPacket.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept> /*runtime_error*/
+
+using namespace ots;
+
+#undef __MF_SUBJECT__
+#define __MF_SUBJECT__ "SlowControlsTxPacket"
+
+//==============================================================================
+// appendHeader
+//	start a packed tx packet
+void FESlowControlsTxPacket::appendHeader(std::string& txBuffer, unsigned char packetType, uint32_t sequenceNumber, int64_t timeMs)
+{
+	txBuffer.push_back(packetType);
+	txBuffer.push_back(VERSION);
+	txBuffer.push_back(0);  // reserved
+	txBuffer.push_back(0);  // reserved
+	txBuffer.append((const char*)&sequenceNumber, sizeof(sequenceNumber));
+	txBuffer.append((const char*)&timeMs, sizeof(timeMs));
+}  // end appendHeader()
+
+//==============================================================================
+void FESlowControlsTxPacket::appendHeader(std::string& txBuffer, unsigned char packetType, uint32_t sequenceNumber)
+{
+	appendHeader(txBuffer,
+	             packetType,
+	             sequenceNumber,
+	             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}  // end appendHeader()
+
+//==============================================================================
+// appendDictionaryEntry
+//	add channel id to channel info mapping, for a dictionary packet
+void FESlowControlsTxPacket::appendDictionaryEntry(std::string& txBuffer, uint16_t channelId, const channelInfo_t& channelInfo)
+{
+	uint16_t nameSz = channelInfo.name_.size();
+
+	txBuffer.append((const char*)&channelId, sizeof(channelId));
+	txBuffer.push_back(channelInfo.sizeBytes_);  // size in bytes
+	txBuffer.push_back(channelInfo.sizeBits_);   // size in bits
+	txBuffer.append((const char*)&nameSz, sizeof(nameSz));
+	txBuffer.append(channelInfo.name_, 0, nameSz);
+}  // end appendDictionaryEntry()
+
+//==============================================================================
+// appendRecord
+//	add value or alarm record, for a samples packet
+void FESlowControlsTxPacket::appendRecord(std::string& txBuffer, uint16_t channelId, unsigned char type, const std::string& value)
+{
+	unsigned char valueSz = value.size() < 0xFF ? value.size() : 0xFF;
+
+	txBuffer.push_back(type);
+	txBuffer.push_back(valueSz);  // size in bytes
+	txBuffer.append((const char*)&channelId, sizeof(channelId));
+	txBuffer.append(value, 0, valueSz);
+}  // end appendRecord()
+
+//==============================================================================
+// isPacked
+//	returns true if packet is in packed format (legacy packets start with record type 0-4)
+bool FESlowControlsTxPacket::isPacked(const std::string& packet)
+{
+	return packet.size() && ((unsigned char)packet[0] == SAMPLES_PACKET_TYPE || (unsigned char)packet[0] == DICTIONARY_PACKET_TYPE);
+}  // end isPacked()
+
+//==============================================================================
+// decode
+//	For a dictionary packet, the entries are added to dictionary.
+//	For a samples packet, the records are appended to records.
+//		Records of channel ids not (yet) in the dictionary are still returned,
+//		the receiver may drop them until the next dictionary packet.
+//	Returns the packet header.
+FESlowControlsTxPacket::header_t FESlowControlsTxPacket::decode(const std::string&                 packet,
+                                                                std::map<uint16_t, channelInfo_t>& dictionary,
+                                                                std::vector<record_t>&             records)
+{
+	if(!isPacked(packet) || packet.size() < HEADER_SIZE)
+	{
+		__SS__ << "Invalid packed slow controls packet of size " << packet.size() << "." << __E__;
+		__SS_THROW__;
+	}
+
+	header_t header;
+	header.packetType_ = packet[0];
+	header.version_    = packet[1];
+	memcpy(&header.sequenceNumber_, &packet[4], sizeof(header.sequenceNumber_));
+	memcpy(&header.timeMs_, &packet[8], sizeof(header.timeMs_));
+
+	if(header.version_ != VERSION)
+	{
+		__SS__ << "Unsupported packed slow controls packet version " << (unsigned int)header.version_ << " (expected " << (unsigned int)VERSION << ")."
+		       << __E__;
+		__SS_THROW__;
+	}
+
+	size_t   i = HEADER_SIZE;
+	uint16_t channelId;
+	if(header.packetType_ == DICTIONARY_PACKET_TYPE)
+	{
+		while(i < packet.size())
+		{
+			uint16_t nameSz;
+			if(i + 6 > packet.size())
+			{
+				__SS__ << "Truncated dictionary entry at byte " << i << " of packed slow controls packet." << __E__;
+				__SS_THROW__;
+			}
+			memcpy(&channelId, &packet[i], sizeof(channelId));
+			memcpy(&nameSz, &packet[i + 4], sizeof(nameSz));
+			if(i + 6 + nameSz > packet.size())
+			{
+				__SS__ << "Truncated dictionary entry name at byte " << i << " of packed slow controls packet." << __E__;
+				__SS_THROW__;
+			}
+
+			channelInfo_t& channelInfo = dictionary[channelId];
+			channelInfo.sizeBytes_     = packet[i + 2];
+			channelInfo.sizeBits_      = packet[i + 3];
+			channelInfo.name_          = packet.substr(i + 6, nameSz);
+			i += 6 + nameSz;
+		}
+		return header;
+	}
+
+	// samples packet
+	while(i < packet.size())
+	{
+		if(i + 4 > packet.size() || i + 4 + (unsigned char)packet[i + 1] > packet.size())
+		{
+			__SS__ << "Truncated record at byte " << i << " of packed slow controls packet." << __E__;
+			__SS_THROW__;
+		}
+
+		records.emplace_back();
+		record_t& record = records.back();
+		record.type_     = packet[i];
+		memcpy(&record.channelId_, &packet[i + 2], sizeof(record.channelId_));
+		record.value_ = packet.substr(i + 4, (unsigned char)packet[i + 1]);
+		i += 4 + record.value_.size();
+	}
+	return header;
+}  // end decode()
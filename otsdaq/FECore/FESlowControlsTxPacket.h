@@ -0,0 +1,83 @@
+#ifndef _ots_FESlowControlsTxPacket_h_
+#define _ots_FESlowControlsTxPacket_h_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ots
+{
+// FESlowControlsTxPacket
+//	Packed multi-sample UDP packet format for slow controls monitor server traffic,
+//	used when the FE enables SlowControlsTxPackedFormat.
+//	Legacy per-record packets start with record type 0-4, so a receiver can
+//	tell the formats apart by the first byte.
+//
+//	Packet Format:
+//		header (16B):
+//			1B packet type (0xF0: packed samples, 0xF1: channel dictionary)
+//			1B format version
+//			2B reserved
+//			4B packet sequence count from FE
+//			8B time (ms since epoch)
+//		followed by packed records (for 0xF0):
+//			1B type (0: value, 1: loloalarm, 2: loalarm, 3: hioalarm, 4: hihialarm)
+//			1B sz of value in bytes
+//			2B channel id
+//			value or alarm threshold value
+//		or dictionary entries (for 0xF1):
+//			2B channel id
+//			1B sz of value in bytes
+//			1B sz of value in bits
+//			2B sz of name
+//			name
+class FESlowControlsTxPacket
+{
+	// clang-format off
+  public:
+	enum
+	{
+		SAMPLES_PACKET_TYPE = 0xF0,
+		DICTIONARY_PACKET_TYPE = 0xF1,
+		VERSION = 1,
+		HEADER_SIZE = 16,
+	};
+
+	struct header_t
+	{
+		unsigned char 	packetType_;
+		unsigned char 	version_;
+		uint32_t 		sequenceNumber_;
+		int64_t 		timeMs_;  // ms since epoch
+	};
+
+	struct channelInfo_t
+	{
+		std::string 	name_;
+		unsigned char 	sizeBytes_;
+		unsigned char 	sizeBits_;
+	};
+
+	struct record_t
+	{
+		unsigned char 	type_;
+		uint16_t 		channelId_;
+		std::string 	value_;
+	};
+
+	// encoder
+	static void				appendHeader			(std::string& txBuffer, unsigned char packetType, uint32_t sequenceNumber, int64_t timeMs);
+	static void				appendHeader			(std::string& txBuffer, unsigned char packetType, uint32_t sequenceNumber);  // time is now
+	static void				appendDictionaryEntry	(std::string& txBuffer, uint16_t channelId, const channelInfo_t& channelInfo);
+	static void				appendRecord			(std::string& txBuffer, uint16_t channelId, unsigned char type, const std::string& value);
+
+	// decoder
+	static bool				isPacked				(const std::string& packet);
+	static header_t			decode					(const std::string& packet, std::map<uint16_t /*channel id*/, channelInfo_t>& dictionary, std::vector<record_t>& records);  // throws on malformed packet
+	// clang-format on
+};
+
+}  // namespace ots
+
+#endif
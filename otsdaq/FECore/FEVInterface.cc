@@ -1,12 +1,17 @@
 #include "otsdaq/FECore/FEVInterface.h"
 #include "otsdaq/CoreSupervisors/CoreSupervisorBase.h"
 #include "otsdaq/FECore/FEVInterfacesManager.h"
+#include "otsdaq/FECore/FESlowControlsArchive.h"
+#include "otsdaq/FECore/FESlowControlsTxPacket.h"
 #include "otsdaq/NetworkUtilities/UDPDataStreamerBase.h"
 #include "otsdaq/Macros/BinaryStringMacros.h"
 
 #include <TFormula.h>
 
 #define TRACE_NAME "FEVInterface"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <thread>  //for std::thread
@@ -26,6 +31,21 @@ FEVInterface::FEVInterface(const std::string& interfaceUID, const ConfigurationT
 	// base class versions of function (e.g. getInterfaceType) are called because the
 	// derived class has not been instantiate yet!
 	// Instead use __GEN_COUT__ which decorates using mfSubject_
+
+	// check if consecutive macro accesses may be combined into block reads/writes
+	//	(opt-in, since the address step between data words depends on the hardware addressing)
+	try
+	{
+		universalBlockAccessBytesPerAddress_ =
+		    theXDAQContextConfigTree_.getBackNode(theConfigurationPath_).getNode("UniversalBlockAccessBytesPerAddress").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+		universalBlockAccessBytesPerAddress_ = 0;  // no block access if not configured
+	}
+	if(universalBlockAccessBytesPerAddress_)
+		__GEN_COUT_INFO__ << "Universal block access turned On, bytes per address=" << universalBlockAccessBytesPerAddress_ << __E__;
+
 	__GEN_COUT__ << "Constructed." << __E__;
 }  // end constructor()
 
@@ -92,6 +112,7 @@ try
 		
 	}
 
+	compileSlowControlsTransformations();
 }  // end configureSlowControls()
 catch(const std::runtime_error& e)
 {
@@ -110,6 +131,45 @@ catch(...)
 	__SS_THROW__;
 }
 
+//==============================================================================
+// compileSlowControlsTransformations
+//	Compile each unique transformation formula of the monitored slow controls channels once,
+//	so that the slow controls workloop only evaluates the prebuilt TFormula per sample.
+void FEVInterface::compileSlowControlsTransformations(void)
+{
+	slowControlsTransformations_.clear();
+
+	FESlowControlsChannel* channel;
+	resetSlowControlsChannelIterator();
+	while((channel = getNextSlowControlsChannel()) != nullptr)
+		if(channel->monitoringEnabled && channel->transformation.size() > 1)
+			getSlowControlsTransformation(channel->transformation);
+
+	__COUT__ << "Compiled " << slowControlsTransformations_.size() << " unique slow controls transformation formula(s)." << __E__;
+}  // end compileSlowControlsTransformations()
+
+//==============================================================================
+// getSlowControlsTransformation
+//	returns compiled formula from cache, compiling on first use
+TFormula* FEVInterface::getSlowControlsTransformation(const std::string& formula)
+{
+	auto it = slowControlsTransformations_.find(formula);
+	if(it != slowControlsTransformations_.end())
+		return it->second.get();
+
+	// do not add to ROOT global list of functions, so same-named formulas of other FEs are not replaced
+	std::shared_ptr<TFormula> transformationFormula(new TFormula("transformationFormula", formula.c_str(), false /*addToGlobList*/));
+	if(!transformationFormula->IsValid())
+	{
+		__SS__ << "Invalid slow controls transformation formula '" << formula << "'" << __E__;
+		__SS_THROW__;
+	}
+
+	__COUT__ << "Compiled slow controls transformation formula = " << formula << __E__;
+	slowControlsTransformations_.emplace(formula, transformationFormula);
+	return transformationFormula.get();
+}  // end getSlowControlsTransformation()
+
 //==============================================================================
 // addSlowControlsChannels
 //	Usually subInterfaceID = "" and mapOfSlowControlsChannels =
@@ -143,7 +203,20 @@ void FEVInterface::addSlowControlsChannels(ConfigurationTree
 			__FE_COUT__ << "Slow controls 'Transformation' setting not found." << __E__;
 		}
 
-		mapOfSlowControlsChannels->insert(std::pair<std::string, FESlowControlsChannel>(
+		// Publishing filter
+		double deadbandAbsolute = 0, deadbandRelative = 0, maxSilenceSeconds = 0;
+		try
+		{
+			deadbandAbsolute  = groupLinkChild.second.getNode("DeadbandAbsolute").getValue<double>();
+			deadbandRelative  = groupLinkChild.second.getNode("DeadbandRelative").getValue<double>();
+			maxSilenceSeconds = groupLinkChild.second.getNode("MaxSilencePeriodInSeconds").getValue<double>();
+		}
+		catch(...)
+		{
+			__FE_COUT__ << "Slow controls publishing filter settings not found." << __E__;
+		}
+
+		auto insertResult = mapOfSlowControlsChannels->insert(std::pair<std::string, FESlowControlsChannel>(
 		    groupLinkChild.first,
 		    FESlowControlsChannel(this,
 		                          groupLinkChild.first,
@@ -155,7 +228,7 @@ void FEVInterface::addSlowControlsChannels(ConfigurationTree
 		                          groupLinkChild.second.getNode("WriteAccess").getValue<bool>(),
 		                          groupLinkChild.second.getNode("MonitoringEnabled").getValue<bool>(),
 		                          groupLinkChild.second.getNode("RecordChangesOnly").getValue<bool>(),
-		                          groupLinkChild.second.getNode("DelayBetweenSamplesInSeconds").getValue<time_t>(),
+		                          groupLinkChild.second.getNode("DelayBetweenSamplesInSeconds").getValue<double>(),
 		                          groupLinkChild.second.getNode("LocalSavingEnabled").getValue<bool>(),
 		                          groupLinkChild.second.getNode("LocalFilePath").getValue<std::string>(),
 		                          groupLinkChild.second.getNode("RadixFileName").getValue<std::string>(),
@@ -166,6 +239,7 @@ void FEVInterface::addSlowControlsChannels(ConfigurationTree
 		                          groupLinkChild.second.getNode("LowThreshold").getValue<std::string>(),
 		                          groupLinkChild.second.getNode("HighThreshold").getValue<std::string>(),
 		                          groupLinkChild.second.getNode("HighHighThreshold").getValue<std::string>())));
+		insertResult.first->second.setPublishingFilter(deadbandAbsolute, deadbandRelative, maxSilenceSeconds);
 	}
 	__FE_COUT__ << "Added " << mapOfSlowControlsChannels->size() << " slow controls channels." << __E__;
 
@@ -192,6 +266,164 @@ FESlowControlsChannel* FEVInterface::getNextSlowControlsChannel(void)
 // virtual in case channels are handled in multiple maps, for example
 unsigned int FEVInterface::getSlowControlsChannelCount(void) { return mapOfSlowControlsChannels_.size(); }  // end getSlowControlsChannelCount()
 
+//==============================================================================
+// prepareSlowControlsSampling
+//	Builds the sampling schedule from the (virtual) channel iterator:
+//		read groups - one per unique (universal address, read size), read once per due tick
+//		period buckets - one per unique delayBetweenSamples_, visited only when due
+//	Returns the number of channels with read access.
+unsigned int FEVInterface::prepareSlowControlsSampling(void)
+{
+	slowControlsReadGroups_.clear();
+	slowControlsPeriodBuckets_.clear();
+
+	std::map<std::pair<std::string /*address*/, unsigned int /*size*/>, size_t /*read group index*/> readGroupIndexMap;
+	std::map<long long /*period ms*/, size_t /*bucket index*/>                                      periodBucketIndexMap;
+
+	unsigned int                                numOfReadAccessChannels = 0;
+	FESlowControlsChannel*                      channel;
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	resetSlowControlsChannelIterator();
+	while((channel = getNextSlowControlsChannel()) != nullptr)
+	{
+		// skip if no read access
+		if(!channel->readAccess_)
+			continue;
+		++numOfReadAccessChannels;
+
+		auto readGroupIt = readGroupIndexMap.emplace(std::make_pair(channel->getUniversalAddress(), channel->getReadSizeBytes()), slowControlsReadGroups_.size());
+		if(readGroupIt.second)  // new unique address read
+		{
+			uint64_t addressValue = 0;
+			if(universalAddressSize_ <= 8)  // little-endian address bytes
+				for(size_t ii = 0; ii < channel->getUniversalAddress().size(); ++ii)
+					addressValue |= (uint64_t)(uint8_t)channel->getUniversalAddress()[ii] << (ii * 8);
+
+			slowControlsReadGroups_.push_back(
+			    slowControlsReadGroup_t{channel->getUniversalAddress(), addressValue, channel->getReadSizeBytes(), channel, ""});
+		}
+
+		long long periodMs       = llround(channel->delayBetweenSamples_ * 1000.);
+		auto      periodBucketIt = periodBucketIndexMap.emplace(periodMs, slowControlsPeriodBuckets_.size());
+		if(periodBucketIt.second)  // new sampling period, with first sample one period from now
+			slowControlsPeriodBuckets_.push_back(slowControlsPeriodBucket_t{
+			    std::chrono::milliseconds(periodMs), startTime + std::chrono::milliseconds(periodMs), {}});
+
+		slowControlsPeriodBuckets_[periodBucketIt.first->second].channels_.push_back(std::make_pair(readGroupIt.first->second, channel));
+	}
+
+	// sort read groups by address, so that ascending read group indices are ascending addresses
+	{
+		std::vector<size_t> sortedOrder(slowControlsReadGroups_.size());
+		for(size_t i = 0; i < sortedOrder.size(); ++i)
+			sortedOrder[i] = i;
+		std::stable_sort(sortedOrder.begin(), sortedOrder.end(), [this](size_t a, size_t b) {
+			return slowControlsReadGroups_[a].addressValue_ < slowControlsReadGroups_[b].addressValue_;
+		});
+
+		std::vector<size_t>                  newIndex(sortedOrder.size());
+		std::vector<slowControlsReadGroup_t> sortedReadGroups;
+		sortedReadGroups.reserve(sortedOrder.size());
+		for(size_t i = 0; i < sortedOrder.size(); ++i)
+		{
+			newIndex[sortedOrder[i]] = i;
+			sortedReadGroups.push_back(slowControlsReadGroups_[sortedOrder[i]]);
+		}
+		slowControlsReadGroups_.swap(sortedReadGroups);
+
+		for(auto& periodBucket : slowControlsPeriodBuckets_)
+			for(auto& bucketChannel : periodBucket.channels_)
+				bucketChannel.first = newIndex[bucketChannel.first];
+	}
+
+	// sort bucket channels by read group, so that same-address channels are handled together
+	for(auto& periodBucket : slowControlsPeriodBuckets_)
+		std::stable_sort(periodBucket.channels_.begin(),
+		                 periodBucket.channels_.end(),
+		                 [](const std::pair<size_t, FESlowControlsChannel*>& a, const std::pair<size_t, FESlowControlsChannel*>& b) { return a.first < b.first; });
+
+	for(const auto& periodBucket : slowControlsPeriodBuckets_)
+		__FE_COUT__ << "Slow controls sampling period " << periodBucket.period_.count() << " ms has " << periodBucket.channels_.size() << " channel(s)." << __E__;
+
+	return numOfReadAccessChannels;
+}  // end prepareSlowControlsSampling()
+
+//==============================================================================
+// readSlowControlsGroups
+//	Reads the value of each indicated read group (indices must be ascending, i.e. ascending address).
+//	If block read coalescing is enabled, due addresses within slowControlsBlockReadMaxGapBytes_
+//	of each other are merged into universalBlockRead spans of at most slowControlsBlockReadMaxSpanBytes_,
+//	and the span is demultiplexed into each read group value.
+//	If the FE plugin does not implement universalBlockRead, coalescing is disabled and single reads are used.
+void FEVInterface::readSlowControlsGroups(const std::vector<size_t>& readGroupIndices)
+{
+	const uint64_t bytesPerAddress = slowControlsBlockReadBytesPerAddress_ ? slowControlsBlockReadBytesPerAddress_ : universalDataSize_;
+	const bool     coalesce        = slowControlsBlockReadMaxSpanBytes_ && universalAddressSize_ <= 8 && bytesPerAddress;
+
+	std::string blockValue;
+	size_t      i = 0, j;
+	uint64_t    spanBytes, offset;
+	while(i < readGroupIndices.size())
+	{
+		slowControlsReadGroup_t& firstReadGroup = slowControlsReadGroups_[readGroupIndices[i]];
+
+		// find span of nearby addresses
+		spanBytes = std::max(firstReadGroup.readSizeBytes_, universalDataSize_);
+		for(j = i + 1; coalesce && j < readGroupIndices.size(); ++j)
+		{
+			const slowControlsReadGroup_t& readGroup = slowControlsReadGroups_[readGroupIndices[j]];
+
+			offset = (readGroup.addressValue_ - firstReadGroup.addressValue_) * bytesPerAddress;
+			if(offset > spanBytes + slowControlsBlockReadMaxGapBytes_ ||
+			   offset + std::max(readGroup.readSizeBytes_, universalDataSize_) > slowControlsBlockReadMaxSpanBytes_)
+				break;
+
+			spanBytes = std::max(spanBytes, offset + std::max(readGroup.readSizeBytes_, universalDataSize_));
+		}
+
+		if(j - i > 1)  // block read of span
+		{
+			try
+			{
+				__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Block reading " << j - i << " addresses in " << spanBytes << "-byte span at address:"
+				                                 << BinaryStringMacros::binaryNumberToHexString(firstReadGroup.universalAddress_, "0x", " ") << __E__;
+
+				blockValue.resize(spanBytes);
+				universalBlockRead(&firstReadGroup.universalAddress_[0], &blockValue[0], spanBytes);
+				universalBlockReadImplementationConfirmed = true;
+
+				// demultiplex span into read group values
+				for(; i < j; ++i)
+				{
+					slowControlsReadGroup_t& readGroup = slowControlsReadGroups_[readGroupIndices[i]];
+					offset = (readGroup.addressValue_ - firstReadGroup.addressValue_) * bytesPerAddress;
+					readGroup.readValue_.assign(blockValue, offset, std::max(readGroup.readSizeBytes_, universalDataSize_));
+				}
+				continue;
+			}
+			catch(const std::runtime_error& e)
+			{
+				if(strcmp(e.what(), "UNDEFINED BLOCK READ") != 0)
+					throw;
+
+				__FE_COUT_WARN__ << "This FE interface does not implement universalBlockRead(), so slow controls block read coalescing is disabled." << __E__;
+				slowControlsBlockReadMaxSpanBytes_ = 0;
+				// fall through to single reads for this span
+			}
+		}
+
+		for(; i < j; ++i)
+		{
+			slowControlsReadGroup_t& readGroup = slowControlsReadGroups_[readGroupIndices[i]];
+
+			__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Reading " << readGroup.readSizeBytes_ << "-byte value at address:"
+			                                 << BinaryStringMacros::binaryNumberToHexString(readGroup.universalAddress_, "0x", " ") << __E__;
+			readGroup.readChannel_->doRead(readGroup.readValue_);
+		}
+	}
+}  // end readSlowControlsGroups()
+
 //==============================================================================
 bool FEVInterface::slowControlsRunning(void)
 try
@@ -250,31 +482,65 @@ try
 		__FE_COUT__ << "Invalid Slow Controls socket parameters, so no socket made." << __E__;
 	}
 
+	// check if block read coalescing of nearby slow controls addresses
+	try
+	{
+		slowControlsBlockReadMaxSpanBytes_    = FEInterfaceNode.getNode("SlowControlsBlockReadMaxSpanBytes").getValue<unsigned int>();
+		slowControlsBlockReadMaxGapBytes_     = FEInterfaceNode.getNode("SlowControlsBlockReadMaxGapBytes").getValue<unsigned int>();
+		slowControlsBlockReadBytesPerAddress_ = FEInterfaceNode.getNode("SlowControlsBlockReadBytesPerAddress").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+		slowControlsBlockReadMaxSpanBytes_ = 0;  // no coalescing if not configured
+	}
+	if(slowControlsBlockReadMaxSpanBytes_)
+		__FE_COUT_INFO__ << "Slow Controls block read coalescing turned On, max span=" << slowControlsBlockReadMaxSpanBytes_
+		                 << " bytes, max gap=" << slowControlsBlockReadMaxGapBytes_ << " bytes, bytes per address="
+		                 << (slowControlsBlockReadBytesPerAddress_ ? slowControlsBlockReadBytesPerAddress_ : universalDataSize_) << __E__;
+
 	// check if aggregate saving
 
-	FILE* fp                          = 0;
-	bool  aggregateFileIsBinaryFormat = false;
+	FILE*                                  fp                          = 0;
+	bool                                   aggregateFileIsBinaryFormat = false;
+	std::unique_ptr<FESlowControlsArchive> aggregateArchive;
+	std::string                            aggregateArchiveFileName = "";
 	try
 	{
 		if(FEInterfaceNode.getNode("SlowControlsLocalAggregateSavingEnabled").getValue<bool>())
 		{
 			aggregateFileIsBinaryFormat = FEInterfaceNode.getNode("SlowControlsSaveBinaryFile").getValue<bool>();
 
-			__FE_COUT_INFO__ << "Slow Controls Aggregate Saving turned On BinaryFormat=" << aggregateFileIsBinaryFormat << __E__;
+			bool aggregateFileIsArchiveFormat = false;
+			try
+			{
+				aggregateFileIsArchiveFormat = FEInterfaceNode.getNode("SlowControlsSaveArchiveFile").getValue<bool>();
+			}
+			catch(...)
+			{
+			}  // ignore missing field, and use original formats
+
+			__FE_COUT_INFO__ << "Slow Controls Aggregate Saving turned On BinaryFormat=" << aggregateFileIsBinaryFormat
+			                 << " ArchiveFormat=" << aggregateFileIsArchiveFormat << __E__;
 
 			std::string saveFullFileName = FEInterfaceNode.getNode("SlowControlsLocalFilePath").getValue<std::string>() + "/" +
 			                               FEInterfaceNode.getNode("SlowControlsRadixFileName").getValue<std::string>() + "-" +
-			                               FESlowControlsChannel::underscoreString(getInterfaceUID()) + "-" + std::to_string(time(0)) +
-			                               (aggregateFileIsBinaryFormat ? ".dat" : ".txt");
+			                               FESlowControlsChannel::underscoreString(getInterfaceUID()) + "-" + std::to_string(time(0));
 
-			fp = fopen(saveFullFileName.c_str(), aggregateFileIsBinaryFormat ? "ab" : "a");
-			if(!fp)
+			if(aggregateFileIsArchiveFormat)  // archive is opened once the channel dictionary is known
+				aggregateArchiveFileName = saveFullFileName + FESlowControlsArchive::FILE_EXTENSION;
+			else
 			{
-				__FE_COUT_ERR__ << "Failed to open slow controls channel file: " << saveFullFileName << __E__;
-				// continue on, just nothing will be saved
+				saveFullFileName += (aggregateFileIsBinaryFormat ? ".dat" : ".txt");
+
+				fp = fopen(saveFullFileName.c_str(), aggregateFileIsBinaryFormat ? "ab" : "a");
+				if(!fp)
+				{
+					__FE_COUT_ERR__ << "Failed to open slow controls channel file: " << saveFullFileName << __E__;
+					// continue on, just nothing will be saved
+				}
+				else
+					__FE_COUT_INFO__ << "Slow controls aggregate file opened: " << saveFullFileName << __E__;
 			}
-			else
-				__FE_COUT_INFO__ << "Slow controls aggregate file opened: " << saveFullFileName << __E__;
 		}
 	}
 	catch(...)
@@ -284,107 +550,180 @@ try
 	if(!aggregateFileIsBinaryFormat)
 		__FE_COUT_INFO__ << "Slow Controls Aggregate Saving turned off." << __E__;
 
-	time_t timeCounter = 0;
-
-	unsigned int numOfReadAccessChannels = 0;
-	bool         firstTime               = true;
+	unsigned int numOfReadAccessChannels = prepareSlowControlsSampling();
+	if(numOfReadAccessChannels == 0)
+	{
+		__FE_COUT_WARN__ << "There are no slow controls channels with read access!" << __E__;
+		if(fp)
+			fclose(fp);
+		return false;
+	}
+	if(aggregateArchiveFileName != "")
+	{
+		std::vector<const FESlowControlsChannel*> archiveChannels;
+		for(const auto& periodBucket : slowControlsPeriodBuckets_)
+			for(const auto& bucketChannel : periodBucket.channels_)
+				archiveChannels.push_back(bucketChannel.second);
+		try
+		{
+			aggregateArchive.reset(new FESlowControlsArchive(aggregateArchiveFileName, archiveChannels));
+			__FE_COUT_INFO__ << "Slow controls aggregate archive opened: " << aggregateArchiveFileName << __E__;
+		}
+		catch(const std::runtime_error& e)
+		{
+			__FE_COUT_ERR__ << "Failed to open slow controls aggregate archive: " << e.what() << __E__;
+			// continue on, just nothing will be saved
+		}
+	}
 
-	while(slowControlsWorkLoop_.getContinueWorkLoop())
+	// check if packed multi-sample tx format (channel names are sent periodically in dictionary packets, samples refer to channel ids)
+	bool txPackedFormat = false;
+	try
 	{
-		// __FE_COUT__ << "..." << __E__;
+		txPackedFormat = FEInterfaceNode.getNode("SlowControlsTxPackedFormat").getValue<bool>();
+	}
+	catch(...)
+	{
+	}  // ignore missing field, and use legacy format
+	txPackedFormat = txPackedFormat && slowContrlolsTxSocket;
+
+	std::vector<FESlowControlsChannel*>   txPackedChannels;  // index is channel id
+	uint32_t                              txPacketSequenceNumber = 0;
+	std::chrono::steady_clock::time_point nextTxDictionaryTime   = std::chrono::steady_clock::now();
+	const std::chrono::seconds            txDictionaryPeriod(60);
+	const unsigned int                    txBufferEmptySize = txPackedFormat ? FESlowControlsTxPacket::HEADER_SIZE : 0;
+	if(txPackedFormat)
+	{
+		for(const auto& periodBucket : slowControlsPeriodBuckets_)
+			for(const auto& bucketChannel : periodBucket.channels_)
+			{
+				if(txPackedChannels.size() > 0xFFFF)
+				{
+					__FE_SS__ << "Too many slow controls channels for the packed tx format (max 65536). Disable 'SlowControlsTxPackedFormat' for this interface."
+					          << __E__;
+					__FE_SS_THROW__;
+				}
+				bucketChannel.second->setTxPackedChannelId(txPackedChannels.size());
+				txPackedChannels.push_back(bucketChannel.second);
+			}
+		__FE_COUT_INFO__ << "Slow Controls packed tx format turned On for " << txPackedChannels.size() << " channels." << __E__;
+	}
 
-		sleep(1);  // seconds
-		++timeCounter;
+	__FE_COUT__ << "There are " << getSlowControlsChannelCount() << " slow controls channels total. " << numOfReadAccessChannels
+	            << " with read access enabled, sampled with " << slowControlsReadGroups_.size() << " unique address reads in "
+	            << slowControlsPeriodBuckets_.size() << " sampling period(s)." << __E__;
 
-		if(txBuffer.size())
-			__FE_COUT__ << "txBuffer sz=" << txBuffer.size() << __E__;
+	std::vector<std::pair<size_t /*read group index*/, FESlowControlsChannel*>> dueChannels;
+	std::vector<size_t>                                                        dueReadGroups;
+	std::chrono::steady_clock::time_point                                      now, nextSampleTime;
 
-		txBuffer.resize(0);  // clear buffer a la txBuffer = "";
+	while(slowControlsWorkLoop_.getContinueWorkLoop())
+	{
+		// __FE_COUT__ << "..." << __E__;
 
-		//__FE_COUT__ << "timeCounter=" << timeCounter << __E__;
-		//__FE_COUT__ << "txBuffer sz=" << txBuffer.size() << __E__;
+		// sleep until the next sampling deadline (at most 1 s, to remain responsive to workloop stop)
+		nextSampleTime = slowControlsPeriodBuckets_[0].nextSampleTime_;
+		for(const auto& periodBucket : slowControlsPeriodBuckets_)
+			if(periodBucket.nextSampleTime_ < nextSampleTime)
+				nextSampleTime = periodBucket.nextSampleTime_;
 
-		resetSlowControlsChannelIterator();
-		while((channel = getNextSlowControlsChannel()) != nullptr)
+		now = std::chrono::steady_clock::now();
+		if(now < nextSampleTime)
 		{
-			// skip if no read access
-			if(!channel->readAccess_)
-				continue;
-
-			if(firstTime)
-				++numOfReadAccessChannels;
-
-			// skip if not a sampling moment in time for channel
-			if(timeCounter % channel->delayBetweenSamples_)
+			std::this_thread::sleep_until(std::min(nextSampleTime, now + std::chrono::seconds(1)));
+			now = std::chrono::steady_clock::now();
+			if(now < nextSampleTime)
 				continue;
+		}
 
-			__FE_COUT__ << "Reading Channel:" << channel->fullChannelName << " at t=" << time(0) << __E__;
+		// send channel dictionary at start and periodically, so a late-starting receiver can decode the packed samples
+		if(txPackedFormat && now >= nextTxDictionaryTime)
+		{
+			nextTxDictionaryTime = now + txDictionaryPeriod;
 
-			//check if can use buffered value
-			resetSlowControlsChannelIterator();
-			FESlowControlsChannel* channelToCopy;
-			bool usingBufferedValue = false;
-			while((channelToCopy = getNextSlowControlsChannel()) != channel)
+			txBuffer.resize(0);
+			for(const auto& txPackedChannel : txPackedChannels)
 			{
-			    __FE_COUT_TYPE__(TLVL_DEBUG+8) << "Looking for buffered value at " << 					
-					BinaryStringMacros::binaryNumberToHexString(channelToCopy->getUniversalAddress(), "0x", " ") << " "  << 
-					channelToCopy->getReadSizeBytes() << " " <<
-					time(0) - channelToCopy->getLastSampleTime() << __E__;
-
-				if(!usingBufferedValue && 	
-					BinaryStringMacros::binaryNumberToHexString(channelToCopy->getUniversalAddress(), "0x", " ") == 
-					BinaryStringMacros::binaryNumberToHexString(channel->getUniversalAddress(), "0x", " ") && 
-					channelToCopy->getReadSizeBytes() == channel->getReadSizeBytes() && 
-					time(0) - channelToCopy->getLastSampleTime() < 2 /* within 2 seconds, then re-use buffer */)
+				if(txBuffer.size() == 0)
+					FESlowControlsTxPacket::appendHeader(txBuffer, FESlowControlsTxPacket::DICTIONARY_PACKET_TYPE, txPacketSequenceNumber++);
+				txPackedChannel->appendTxPackedDictionaryEntry(txBuffer);
+				if(txBuffer.size() > txBufferFullThreshold)
 				{
-					usingBufferedValue = true;
-					__FE_COUT__ << "Using buffered " << channelToCopy->getReadSizeBytes() << 
-						"-byte value at address:" << 
-						BinaryStringMacros::binaryNumberToHexString(channelToCopy->getUniversalAddress(), "0x", " ") << __E__;
+					slowContrlolsTxSocket->send(txBuffer);
+					txBuffer.resize(0);
+				}
+			}
+			if(txBuffer.size())
+				slowContrlolsTxSocket->send(txBuffer);
+		}
 
-					__FE_COUT__ << "Copying: " << BinaryStringMacros::binaryNumberToHexString(channelToCopy->getLastSampleReadValue(), "0x", " ") << " at t=" << time(0) << __E__;
-					channel->handleSample(channelToCopy->getLastSampleReadValue(), txBuffer, fp, aggregateFileIsBinaryFormat, txBufferUsed);
-					__FE_COUT__ << "Copied: " << BinaryStringMacros::binaryNumberToHexString(channel->getSample(), "0x", " ") << " at t=" << time(0) << __E__;
+		txBuffer.resize(0);  // clear buffer a la txBuffer = "";
+		if(txPackedFormat)
+			FESlowControlsTxPacket::appendHeader(txBuffer, FESlowControlsTxPacket::SAMPLES_PACKET_TYPE, txPacketSequenceNumber);
 
-					//can NOT break; from while loop... must take iterator back to starting point channel iterator
-				}
-			} //end while loop
+		// collect channels of the sampling periods that are due
+		//	deadlines advance by exactly one period to avoid drift, unless a deadline was missed entirely
+		dueChannels.clear();
+		for(auto& periodBucket : slowControlsPeriodBuckets_)
+		{
+			if(now < periodBucket.nextSampleTime_)
+				continue;
 
-			//get and handle sample if not already handled using buffered value
-			if(!usingBufferedValue)
+			periodBucket.nextSampleTime_ += periodBucket.period_;
+			if(periodBucket.nextSampleTime_ <= now)
 			{
-				std::string readValInst;
-				std::string& readVal = readValInst;
-				readVal.resize(universalDataSize_);  // size to data in advance
-				channel->doRead(readVal);
-				channel->handleSample(readVal, txBuffer, fp, aggregateFileIsBinaryFormat, txBufferUsed);
-				__FE_COUT__ << "Have: " << BinaryStringMacros::binaryNumberToHexString(channel->getSample(), "0x", " ") << " at t=" << time(0) << __E__;
+				__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Slow controls sampling is overrunning the " << periodBucket.period_.count()
+				                                 << " ms sampling period, skipping missed samples." << __E__;
+				periodBucket.nextSampleTime_ = now + periodBucket.period_;
 			}
-								
+			dueChannels.insert(dueChannels.end(), periodBucket.channels_.begin(), periodBucket.channels_.end());
+		}
 
-			if(txBuffer.size())
-				__FE_COUT__ << "txBuffer sz=" << txBuffer.size() << __E__;
+		// order by read group (each bucket is already sorted), so each unique address is read once this tick
+		if(slowControlsPeriodBuckets_.size() > 1)
+			std::stable_sort(dueChannels.begin(),
+			                 dueChannels.end(),
+			                 [](const std::pair<size_t, FESlowControlsChannel*>& a, const std::pair<size_t, FESlowControlsChannel*>& b) {
+				                 return a.first < b.first;
+			                 });
+
+		// read each due unique address once (possibly coalesced into block reads)
+		dueReadGroups.clear();
+		for(const auto& dueChannel : dueChannels)
+			if(dueReadGroups.empty() || dueReadGroups.back() != dueChannel.first)
+				dueReadGroups.push_back(dueChannel.first);
+		readSlowControlsGroups(dueReadGroups);
+
+		for(auto& dueChannel : dueChannels)
+		{
+			channel = dueChannel.second;
+
+			bool published = channel->handleSample(
+			    slowControlsReadGroups_[dueChannel.first].readValue_, txBuffer, fp, aggregateFileIsBinaryFormat, txBufferUsed, aggregateArchive.get());
+			__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Have: " << channel->fullChannelName << " = "
+			                                 << BinaryStringMacros::binaryNumberToHexString(channel->getSample(), "0x", " ") << " at t=" << time(0) << __E__;
+
+			if(txBuffer.size() > txBufferEmptySize)
+				__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "txBuffer sz=" << txBuffer.size() << __E__;
 
 
-			// Use artdaq Metric Manager if available,
-			if(channel->monitoringEnabled && metricMan && metricMan->Running() && universalAddressSize_ <= 8) 
+			// Use artdaq Metric Manager if available, for samples that passed the channel publishing filter
+			if(published && channel->monitoringEnabled && metricMan && metricMan->Running() && universalAddressSize_ <= 8) 
 			{
 				uint64_t val = 0;  // 64 bits!
-				for(size_t ii = 0; ii < channel->getSample().size(); ++ii)
-					val += (uint8_t)channel->getSample()[ii] << (ii * 8);
+				for(size_t ii = 0; ii < channel->getSample().size() && ii < sizeof(val); ++ii)
+					val += (uint64_t)(uint8_t)channel->getSample()[ii] << (ii * 8);
 
 				// Unit transforms
 				if((channel->transformation).size() > 1) // Execute transformation if a formula is present
 				{ 
-					__FE_COUT__ << "Transformation formula = " << channel->transformation << __E__;
-                
-					TFormula transformationFormula("transformationFormula", (channel->transformation).c_str());
-					double transformedVal = transformationFormula.Eval(val);
+					// formula is compiled once at configure (or on first use), only evaluate here
+					double transformedVal = getSlowControlsTransformation(channel->transformation)->Eval(val);
 
 					if(!std::isnan(transformedVal)) 
 					{
-						__FE_COUT__ << "Transformed " << val << " into " << transformedVal << __E__;
-						__FE_COUT__ << "Sending \"" << channel->fullChannelName << "\" transformed sample to Metric Manager..." << __E__;
+						__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Transformed " << val << " into " << transformedVal << " with formula = " << channel->transformation << __E__;
+						__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Sending \"" << channel->fullChannelName << "\" transformed sample to Metric Manager..." << __E__;
 						metricMan->sendMetric(channel->fullChannelName, transformedVal, "", 3, artdaq::MetricMode::LastPoint);
 					}
 					else
@@ -395,14 +734,14 @@ try
 				} 
 				else 
 				{
-					__FE_COUT__ << "Sending \"" << channel->fullChannelName << "\" sample to Metric Manager..." << __E__;					
+					__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Sending \"" << channel->fullChannelName << "\" sample to Metric Manager..." << __E__;					
 					metricMan->sendMetric(channel->fullChannelName, val, "", 3, artdaq::MetricMode::LastPoint);
 				}
 			} 
 			else 
 			{ 
-				__FE_COUT__ << "Skipping  \"" << channel->fullChannelName << "\" sample to Metric Manager... "
-					<< " channel->monitoringEnabled=" << channel->monitoringEnabled << " metricMan=" << metricMan
+				__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Skipping  \"" << channel->fullChannelName << "\" sample to Metric Manager... "
+					<< " published=" << published << " channel->monitoringEnabled=" << channel->monitoringEnabled << " metricMan=" << metricMan
 					<< " metricMan->Running()=" << (metricMan && metricMan->Running()) << __E__;
 			}
 
@@ -419,37 +758,30 @@ try
 			// send early if threshold reached
 			if(slowContrlolsTxSocket && txBuffer.size() > txBufferFullThreshold)
 			{
-				__FE_COUT__ << "Sending now! txBufferFullThreshold=" << txBufferFullThreshold << __E__;
+				__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Sending now! txBufferFullThreshold=" << txBufferFullThreshold << __E__;
 				slowContrlolsTxSocket->send(txBuffer);
 				txBuffer.resize(0);  // clear buffer a la txBuffer = "";
+				if(txPackedFormat)
+					FESlowControlsTxPacket::appendHeader(txBuffer, FESlowControlsTxPacket::SAMPLES_PACKET_TYPE, ++txPacketSequenceNumber);
 			}
 		}
 
-		if(txBuffer.size())
-			__FE_COUT__ << "txBuffer sz=" << txBuffer.size() << __E__;
+		if(txBuffer.size() > txBufferEmptySize)
+			__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "txBuffer sz=" << txBuffer.size() << __E__;
 
 		// send anything left
-		if(slowContrlolsTxSocket && txBuffer.size())
+		if(slowContrlolsTxSocket && txBuffer.size() > txBufferEmptySize)
 		{
-			__FE_COUT__ << "Sending now!" << __E__;
+			__FE_COUT_TYPE__(TLVL_DEBUG + 8) << "Sending now!" << __E__;
 			slowContrlolsTxSocket->send(txBuffer);
+			if(txPackedFormat)
+				++txPacketSequenceNumber;
 		}
 
 		if(fp)
 			fflush(fp);  // flush anything in aggregate file for reading ease
-
-		if(firstTime)
-		{
-			if(numOfReadAccessChannels == 0)
-			{
-				__FE_COUT_WARN__ << "There are no slow controls channels with read access!" << __E__;
-				break;
-			}
-			else
-				__FE_COUT__ << "There are " << getSlowControlsChannelCount() << " slow controls channels total. " << numOfReadAccessChannels
-				         << " with read access enabled." << __E__;
-		}
-		firstTime = false;
+		if(aggregateArchive)
+			aggregateArchive->flush();  // write block if it is getting old
 	}  // end main slow controls loop
 
 	if(fp)
@@ -965,71 +1297,82 @@ void FEVInterface::runFrontEndMacro(const std::string&
 
 }  // end runFrontEndMacro()
 
+//==============================================================================
+// sendToFrontEndInProcess
+//	If the target interface is hosted by the same FEVInterfacesManager,
+//	deliver the value directly to its receive buffer (waking any waiting receiver)
+//	and return true. Otherwise return false, and the caller falls back to SOAP.
+bool FEVInterface::sendToFrontEndInProcess(const std::string& targetInterfaceID, const std::string& value) const
+{
+	if(!parentInterfaceManager_ || !parentInterfaceManager_->hasFEInterface(targetInterfaceID))
+		return false;
+
+	__FE_COUT__ << "Delivering FE communication in-process to '" << targetInterfaceID << "'" << __E__;
+	parentInterfaceManager_->deliverFrontEndCommunication(targetInterfaceID, FEVInterface::interfaceUID_, value);
+	return true;
+}  // end sendToFrontEndInProcess()
+
 //==============================================================================
 // receiveFromFrontEnd
 //	specialized template function for T=std::string
 //
+//	Waits on the interface manager receive condition, so that a value delivered
+//	in-process (or by FESupervisor for remote senders) is picked up immediately.
+//
 //	Note: requester can be a wildcard string as defined in StringMacros
 void FEVInterface::receiveFromFrontEnd(const std::string& requester, std::string& retValue, unsigned int timeoutInSeconds) const
 {
 	__FE_COUTV__(requester);
 	__FE_COUTV__(parentSupervisor_);
 
-	std::string data = "0";
-	// bool        found = false;
+	const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeoutInSeconds);
+
+	std::unique_lock<std::mutex> lock(parentInterfaceManager_->frontEndCommunicationReceiveMutex_);
 	while(1)
 	{
-		// mutex scope
+		auto receiveBuffersForTargetIt = parentInterfaceManager_->frontEndCommunicationReceiveBuffer_.find(FEVInterface::interfaceUID_);
+		if(receiveBuffersForTargetIt != parentInterfaceManager_->frontEndCommunicationReceiveBuffer_.end())
 		{
-			std::lock_guard<std::mutex> lock(parentInterfaceManager_->frontEndCommunicationReceiveMutex_);
+			__FE_COUT_TYPE__(TLVL_DEBUG + 5) << __COUT_HDR__ << "Number of source buffers found for front-end '" << FEVInterface::interfaceUID_
+			                                 << "': " << receiveBuffersForTargetIt->second.size() << __E__;
 
-			auto receiveBuffersForTargetIt = parentInterfaceManager_->frontEndCommunicationReceiveBuffer_.find(FEVInterface::interfaceUID_);
-			if(receiveBuffersForTargetIt != parentInterfaceManager_->frontEndCommunicationReceiveBuffer_.end())
+			try
 			{
-				__FE_COUT__ << "Number of source buffers found for front-end '" << FEVInterface::interfaceUID_
-				            << "': " << receiveBuffersForTargetIt->second.size() << __E__;
-
-				for(auto& buffPair : receiveBuffersForTargetIt->second)
-					__FE_COUTV__(buffPair.first);
-
 				// match requester to map of buffers
 				std::string                        sourceBufferId = "";
 				std::queue<std::string /*value*/>& sourceBuffer =
 				    StringMacros::getWildCardMatchFromMap(requester, receiveBuffersForTargetIt->second, &sourceBufferId);
 
-				__FE_COUT__ << "Found source buffer '" << sourceBufferId << "' with size " << sourceBuffer.size() << __E__;
-
 				if(sourceBuffer.size())
 				{
-					__FE_COUT__ << "Found a value in queue of size " << sourceBuffer.size() << __E__;
+					__FE_COUT__ << "Found a value from source buffer '" << sourceBufferId << "' in queue of size " << sourceBuffer.size() << __E__;
 
 					// remove from receive buffer
 					retValue = sourceBuffer.front();
 					sourceBuffer.pop();
 					return;
 				}
-				else
-					__FE_COUT__ << "Source buffer empty for '" << requester << "'" << __E__;
 			}
-
-			// else, not found...
-
-			// if out of time, throw error
-			if(!timeoutInSeconds)
+			catch(const std::runtime_error&)
 			{
-				__FE_SS__ << "Timeout (" << timeoutInSeconds << " s) waiting for front-end communication from " << requester << "." << __E__;
-				__FE_SS_THROW__;
+				// no matching source buffer yet
 			}
-			// else, there is still hope
+		}
 
-		}  // end mutex scope
+		// else, not found...
 
-		// else try again in a sec
-		__FE_COUT__ << "Waiting for front-end communication from " << requester << " for " << timeoutInSeconds << " more seconds..." << __E__;
+		// if out of time, throw error
+		if(std::chrono::steady_clock::now() >= deadline)
+		{
+			__FE_SS__ << "Timeout (" << timeoutInSeconds << " s) waiting for front-end communication from " << requester << "." << __E__;
+			__FE_SS_THROW__;
+		}
+		// else, there is still hope
 
-		--timeoutInSeconds;
-		sleep(1);  // wait a sec
-	}              // end timeout loop
+		// wait for next delivery (releases mutex while waiting)
+		__FE_COUT_TYPE__(TLVL_DEBUG + 5) << __COUT_HDR__ << "Waiting for front-end communication from " << requester << "..." << __E__;
+		parentInterfaceManager_->frontEndCommunicationReceiveCondition_.wait_until(lock, deadline);
+	}  // end timeout loop
 
 	// should never get here
 }  // end receiveFromFrontEnd()
@@ -1305,86 +1648,336 @@ FEVInterface::macroStruct_t::macroStruct_t(const std::string& macroString)
 	for(const auto& outputArg : namesOfOutputArguments_)
 		__COUT__ << "\t" << outputArg << __E__;
 
+	compile();
 }  // end macroStruct_t constructor
 
 //==============================================================================
-// runMacro
-void FEVInterface::runMacro(FEVInterface::macroStruct_t& macro, std::map<std::string /*name*/, uint64_t /*value*/>& variableMap)
+// macroStruct_t::compile
+//	Flatten operations into compiledOps_, resolving variable names to slot indices.
+void FEVInterface::macroStruct_t::compile(void)
 {
-	// Similar to FEVInterface::runSequenceOfCommands()
-
-	__FE_COUT__ << "Running Macro '" << macro.macroName_ << "' of " << macro.operations_.size() << " operations." << __E__;
-
-	for(auto& op : macro.operations_)
+	compiledOps_.clear();
+	variableNames_.clear();
+	outputSlots_.clear();
+
+	std::map<std::string /*name*/, int /*slot*/> slotMap;
+	auto localGetSlot = [&slotMap, this](const std::string& name) -> int {
+		auto it = slotMap.emplace(name, variableNames_.size());
+		if(it.second)  // new variable
+			variableNames_.push_back(name);
+		return it.first->second;
+	};  // end local lambda localGetSlot()
+
+	compiledOps_.reserve(operations_.size());
+	for(const auto& op : operations_)
 	{
-		if(op.first == macroStruct_t::OP_TYPE_READ)
+		compiledOps_.push_back(compiledOp_t{op.first, 0, -1, 0, -1});
+		compiledOp_t& compiledOp = compiledOps_.back();
+
+		if(op.first == OP_TYPE_READ)
 		{
-			__FE_COUT__ << "Doing read op..." << __E__;
-			macroStruct_t::readOp_t& readOp = macro.readOps_[op.second];
+			const readOp_t& readOp = readOps_[op.second];
 			if(readOp.addressIsVar_)
-			{
-				__FE_COUTV__(readOp.addressVarName_);
-				readOp.address_ = variableMap.at(readOp.addressVarName_);
-			}
+				compiledOp.valueSlot_ = localGetSlot(readOp.addressVarName_);
+			else
+				compiledOp.value_ = readOp.address_;
+			if(readOp.dataIsVar_)
+				compiledOp.dataSlot_ = localGetSlot(readOp.dataVarName_);
+		}
+		else if(op.first == OP_TYPE_WRITE)
+		{
+			const writeOp_t& writeOp = writeOps_[op.second];
+			if(writeOp.addressIsVar_)
+				compiledOp.valueSlot_ = localGetSlot(writeOp.addressVarName_);
+			else
+				compiledOp.value_ = writeOp.address_;
+			if(writeOp.dataIsVar_)
+				compiledOp.dataSlot_ = localGetSlot(writeOp.dataVarName_);
+			else
+				compiledOp.data_ = writeOp.data_;
+		}
+		else if(op.first == OP_TYPE_DELAY)
+		{
+			const delayOp_t& delayOp = delayOps_[op.second];
+			if(delayOp.delayIsVar_)
+				compiledOp.valueSlot_ = localGetSlot(delayOp.delayVarName_);
+			else
+				compiledOp.value_ = delayOp.delay_;
+		}
+		else  // invalid type
+		{
+			__SS__ << "Invalid command type '" << op.first << "!'" << __E__;
+			__SS_THROW__;
+		}
+	}  // end operations loop
 
-			uint64_t dataValue = 0;
+	for(const auto& outputArg : namesOfOutputArguments_)
+		outputSlots_.push_back(localGetSlot(outputArg));
 
-			__FE_COUT__ << std::hex << "Read address: \t 0x" << readOp.address_ << __E__ << std::dec;
+	TLOG_DEBUG(20) << __COUT_HDR__ << "Macro compiled to " << compiledOps_.size() << " operations with " << variableNames_.size() << " variables." << __E__;
+}  // end macroStruct_t::compile()
 
-			universalRead((char*)&readOp.address_, (char*)&dataValue);
+//==============================================================================
+// getUniversalBlockAccessAddressIncrement
+//	Consecutive data words are universalDataSize_ / UniversalBlockAccessBytesPerAddress
+//	addresses apart (e.g. 1 for word addressing, universalDataSize_ for byte addressing).
+//	Returns 0 if block access is not configured, or the data size is not a
+//	multiple of the bytes per address.
+uint64_t FEVInterface::getUniversalBlockAccessAddressIncrement(void) const
+{
+	if(!universalBlockAccessBytesPerAddress_ || !universalDataSize_ || universalDataSize_ % universalBlockAccessBytesPerAddress_)
+		return 0;
+	return universalDataSize_ / universalBlockAccessBytesPerAddress_;
+}  // end getUniversalBlockAccessAddressIncrement()
+
+//==============================================================================
+// universalBulkAccess
+//	Executes the accesses in order. If UniversalBlockAccessBytesPerAddress is
+//	configured, runs of adjacent reads (or writes) to consecutive addresses are
+//	done with one universalBlockRead (or Write), falling back to single accesses
+//	if the FE plugin does not implement them.
+//	Errors are recorded per access in error_, so that one failure does not
+//	lose the results of the other accesses.
+void FEVInterface::universalBulkAccess(std::vector<universalAccess_t*>& accesses)
+{
+	__FE_COUT__ << "Bulk access of " << accesses.size() << " operations." << __E__;
 
-			__FE_COUT__ << std::hex << "Read data: \t 0x" << dataValue << __E__ << std::dec;
+	const uint64_t addressIncrement = universalAddressSize_ <= sizeof(uint64_t) ? getUniversalBlockAccessAddressIncrement() : 0;
+	std::string    blockValue;
+	uint64_t       address, nextAddress;
 
-			if(readOp.dataIsVar_)
+	for(size_t i = 0; i < accesses.size();)
+	{
+		universalAccess_t& access = *accesses[i];
+		access.address_.resize(universalAddressSize_, 0);
+		if(access.isWrite_)
+			access.data_.resize(universalDataSize_, 0);
+		else
+			access.data_.assign(universalDataSize_, 0);
+
+		// find run of same type at consecutive addresses
+		size_t blockCount = 1;
+		if(addressIncrement && !(access.isWrite_ ? universalBlockWriteUnavailable_ : universalBlockReadUnavailable_))
+		{
+			address = 0;
+			memcpy(&address, &access.address_[0], universalAddressSize_);
+			for(nextAddress = address + addressIncrement; i + blockCount < accesses.size(); ++blockCount, nextAddress += addressIncrement)
 			{
-				__FE_COUTV__(readOp.dataVarName_);
-				variableMap.at(readOp.dataVarName_) = dataValue;
+				const universalAccess_t& nextAccess = *accesses[i + blockCount];
+				if(nextAccess.isWrite_ != access.isWrite_ || nextAccess.address_.size() > universalAddressSize_)
+					break;
+				uint64_t nextAccessAddress = 0;
+				memcpy(&nextAccessAddress, &nextAccess.address_[0], nextAccess.address_.size());
+				if(nextAccessAddress != nextAddress)
+					break;
 			}
+		}
 
-		}  // end read op
-		else if(op.first == macroStruct_t::OP_TYPE_WRITE)
+		if(blockCount > 1)
 		{
-			__FE_COUT__ << "Doing write op..." << __E__;
-			macroStruct_t::writeOp_t& writeOp = macro.writeOps_[op.second];
-			if(writeOp.addressIsVar_)
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << __COUT_HDR__ << std::hex << "Block " << (access.isWrite_ ? "write" : "read") << " address: \t 0x" << address
+			                                  << std::dec << " count: " << blockCount << __E__;
+
+			blockValue.assign(blockCount * universalDataSize_, 0);
+			if(access.isWrite_)
+				for(size_t j = 0; j < blockCount; ++j)
+					memcpy(&blockValue[j * universalDataSize_],
+					       accesses[i + j]->data_.data(),
+					       std::min((size_t)universalDataSize_, accesses[i + j]->data_.size()));
+			try
 			{
-				__FE_COUTV__(writeOp.addressVarName_);
-				writeOp.address_ = variableMap.at(writeOp.addressVarName_);
+				if(access.isWrite_)
+					universalBlockWrite(&access.address_[0], &blockValue[0], blockValue.size());
+				else
+				{
+					universalBlockRead(&access.address_[0], &blockValue[0], blockValue.size());
+					for(size_t j = 0; j < blockCount; ++j)
+						accesses[i + j]->data_.assign(blockValue, j * universalDataSize_, universalDataSize_);
+				}
+				i += blockCount;
+				continue;
 			}
-			if(writeOp.dataIsVar_)
+			catch(const std::runtime_error& e)
 			{
-				__FE_COUTV__(writeOp.dataVarName_);
-				writeOp.data_ = variableMap.at(writeOp.dataVarName_);
+				if(strcmp(e.what(), access.isWrite_ ? "UNDEFINED BLOCK WRITE" : "UNDEFINED BLOCK READ") != 0)
+				{
+					for(size_t j = 0; j < blockCount; ++j)
+						accesses[i + j]->error_ = e.what();
+					i += blockCount;
+					continue;
+				}
+
+				if(access.isWrite_)
+				{
+					__FE_COUT__ << "This FE interface does not implement universalBlockWrite(), so bulk writes will not be combined." << __E__;
+					universalBlockWriteUnavailable_ = true;
+				}
+				else
+				{
+					__FE_COUT__ << "This FE interface does not implement universalBlockRead(), so bulk reads will not be combined." << __E__;
+					universalBlockReadUnavailable_ = true;
+				}
 			}
+		}  // end block access
+
+		// single access
+		try
+		{
+			if(access.isWrite_)
+				universalWrite(&access.address_[0], &access.data_[0]);
+			else
+				universalRead(&access.address_[0], &access.data_[0]);
+		}
+		catch(const std::runtime_error& e)
+		{
+			access.error_ = e.what();
+		}
+		catch(...)
+		{
+			access.error_ = "Unknown error during universal " + std::string(access.isWrite_ ? "write." : "read.");
+		}
+		++i;
+	}  // end access loop
+}  // end universalBulkAccess()
+
+//==============================================================================
+// runMacro
+//	Executes the compiled operations of the macro. Variables are copied from the
+//	variableMap into slots once, and output variables are copied back at the end.
+//	If UniversalBlockAccessBytesPerAddress is configured, runs of reads (or writes) to
+//	consecutive literal addresses are done with universalBlockRead (or Write),
+//	falling back to single accesses if the FE plugin does not implement them.
+void FEVInterface::runMacro(FEVInterface::macroStruct_t& macro, std::map<std::string /*name*/, uint64_t /*value*/>& variableMap)
+{
+	// Similar to FEVInterface::runSequenceOfCommands()
 
-			__FE_COUT__ << std::hex << "Write address: \t 0x" << writeOp.address_ << __E__ << std::dec;
-			__FE_COUT__ << std::hex << "Write data: \t 0x" << writeOp.data_ << __E__ << std::dec;
+	__FE_COUT_TYPE__(TLVL_DEBUG + 20) << "Running Macro '" << macro.macroName_ << "' of " << macro.compiledOps_.size() << " operations." << __E__;
 
-			universalWrite((char*)&writeOp.address_, (char*)&writeOp.data_);
+	std::vector<uint64_t> variables(macro.variableNames_.size());
+	for(size_t i = 0; i < variables.size(); ++i)
+		variables[i] = variableMap.at(macro.variableNames_[i]);
 
-		}  // end write op
-		else if(op.first == macroStruct_t::OP_TYPE_DELAY)
+	const uint64_t addressIncrement = universalDataSize_ <= sizeof(uint64_t) ? getUniversalBlockAccessAddressIncrement() : 0;
+	std::string    blockValue;
+	uint64_t       address, dataValue;
+	unsigned int   blockCount;
+
+	// number of ops starting at i of the same type at consecutive literal addresses
+	auto localGetBlockCount = [&macro, addressIncrement](size_t i) -> unsigned int {
+		const macroStruct_t::compiledOp_t& op    = macro.compiledOps_[i];
+		unsigned int                       count = 1;
+		if(!addressIncrement || op.valueSlot_ != -1)
+			return count;
+		for(size_t j = i + 1; j < macro.compiledOps_.size(); ++j, ++count)
 		{
-			__FE_COUT__ << "Doing delay op..." << __E__;
+			const macroStruct_t::compiledOp_t& nextOp = macro.compiledOps_[j];
+			if(nextOp.type_ != op.type_ || nextOp.valueSlot_ != -1 || nextOp.value_ != op.value_ + count * addressIncrement)
+				break;
+		}
+		return count;
+	};  // end local lambda localGetBlockCount()
 
-			macroStruct_t::delayOp_t& delayOp = macro.delayOps_[op.second];
-			if(delayOp.delayIsVar_)
+	for(size_t i = 0; i < macro.compiledOps_.size();)
+	{
+		const macroStruct_t::compiledOp_t& op = macro.compiledOps_[i];
+
+		if(op.type_ == macroStruct_t::OP_TYPE_READ)
+		{
+			blockCount = universalBlockReadUnavailable_ ? 1 : localGetBlockCount(i);
+			if(blockCount > 1)
+			{
+				__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Block read address: \t 0x" << op.value_ << std::dec << " count: " << blockCount << __E__;
+
+				blockValue.resize(blockCount * universalDataSize_);
+				address = op.value_;
+				try
+				{
+					universalBlockRead((char*)&address, &blockValue[0], blockValue.size());
+					for(unsigned int j = 0; j < blockCount; ++j, ++i)
+						if(macro.compiledOps_[i].dataSlot_ != -1)
+						{
+							dataValue = 0;
+							memcpy(&dataValue, &blockValue[j * universalDataSize_], universalDataSize_);
+							variables[macro.compiledOps_[i].dataSlot_] = dataValue;
+						}
+					continue;
+				}
+				catch(const std::runtime_error& e)
+				{
+					if(strcmp(e.what(), "UNDEFINED BLOCK READ") != 0)
+						throw;
+					__FE_COUT__ << "This FE interface does not implement universalBlockRead(), so macro reads will not be combined." << __E__;
+					universalBlockReadUnavailable_ = true;
+				}
+			}
+
+			address   = op.valueSlot_ == -1 ? op.value_ : variables[op.valueSlot_];
+			dataValue = 0;
+
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Read address: \t 0x" << address << __E__ << std::dec;
+
+			universalRead((char*)&address, (char*)&dataValue);
+
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Read data: \t 0x" << dataValue << __E__ << std::dec;
+
+			if(op.dataSlot_ != -1)
+				variables[op.dataSlot_] = dataValue;
+		}  // end read op
+		else if(op.type_ == macroStruct_t::OP_TYPE_WRITE)
+		{
+			blockCount = universalBlockWriteUnavailable_ ? 1 : localGetBlockCount(i);
+			if(blockCount > 1)
 			{
-				__FE_COUTV__(delayOp.delayVarName_);
-				delayOp.delay_ = variableMap.at(delayOp.delayVarName_);
+				__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Block write address: \t 0x" << op.value_ << std::dec << " count: " << blockCount << __E__;
+
+				blockValue.resize(blockCount * universalDataSize_);
+				for(unsigned int j = 0; j < blockCount; ++j)
+				{
+					const macroStruct_t::compiledOp_t& blockOp = macro.compiledOps_[i + j];
+					dataValue = blockOp.dataSlot_ == -1 ? blockOp.data_ : variables[blockOp.dataSlot_];
+					memcpy(&blockValue[j * universalDataSize_], &dataValue, universalDataSize_);
+				}
+				address = op.value_;
+				try
+				{
+					universalBlockWrite((char*)&address, &blockValue[0], blockValue.size());
+					i += blockCount;
+					continue;
+				}
+				catch(const std::runtime_error& e)
+				{
+					if(strcmp(e.what(), "UNDEFINED BLOCK WRITE") != 0)
+						throw;
+					__FE_COUT__ << "This FE interface does not implement universalBlockWrite(), so macro writes will not be combined." << __E__;
+					universalBlockWriteUnavailable_ = true;
+				}
 			}
 
-			__FE_COUT__ << std::dec << "Delay ms: \t " << delayOp.delay_ << __E__;
+			address   = op.valueSlot_ == -1 ? op.value_ : variables[op.valueSlot_];
+			dataValue = op.dataSlot_ == -1 ? op.data_ : variables[op.dataSlot_];
+
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Write address: \t 0x" << address << __E__ << std::dec;
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::hex << "Write data: \t 0x" << dataValue << __E__ << std::dec;
+
+			universalWrite((char*)&address, (char*)&dataValue);
+		}  // end write op
+		else if(op.type_ == macroStruct_t::OP_TYPE_DELAY)
+		{
+			dataValue = op.valueSlot_ == -1 ? op.value_ : variables[op.valueSlot_];
 
-			usleep(delayOp.delay_ /*ms*/ * 1000);
+			__FE_COUT_TYPE__(TLVL_DEBUG + 20) << std::dec << "Delay ms: \t " << dataValue << __E__;
 
+			usleep(dataValue /*ms*/ * 1000);
 		}     // end delay op
 		else  // invalid type
 		{
-			__FE_SS__ << "Invalid command type '" << op.first << "!'" << __E__;
+			__FE_SS__ << "Invalid command type '" << op.type_ << "!'" << __E__;
 			__FE_SS_THROW__;
 		}
-
+		++i;
 	}  // end operations loop
 
+	for(const auto& outputSlot : macro.outputSlots_)
+		variableMap.at(macro.variableNames_[outputSlot]) = variables[outputSlot];
+
 }  // end runMacro
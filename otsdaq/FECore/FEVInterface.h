@@ -17,7 +17,10 @@
 #include "otsdaq/SOAPUtilities/SOAPMessenger.h"  //for xdaq::ApplicationDescriptor communication
 
 #include <array>
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,6 +41,8 @@
 #define __SET_ARG_IN__(X, Y) FEVInterface::emplaceFEMacroArgumentValue(argsIn, X, Y)
 #define __SET_ARG_OUT__(X, Y) FEVInterface::setFEMacroArgumentValue(argsOut, X, Y)
 
+class TFormula;  // ROOT, for slow controls transformations
+
 namespace ots
 {
 class FEVInterfacesManager;
@@ -83,6 +88,15 @@ class FEVInterface : public WorkLoop, public Configurable, public VStateMachine
 	virtual void 						universalBlockRead			(char* address, char* returnValue, unsigned int numberOfBytes) { throw std::runtime_error("UNDEFINED BLOCK READ"); /* to make compiler happy, use params */ __COUTV__((void*)address); __COUTV__((void*)returnValue); __COUTV__(numberOfBytes); }
 	bool 								universalBlockReadImplementationConfirmed = false; //is confirmed by slow controls handling (for example) that universalBlockRead is implemented by the FE plugin
 	virtual void        				universalBlockWrite			(char* address, char* writeValue, unsigned int numberOfBytes) { throw std::runtime_error("UNDEFINED BLOCK WRITE"); /* to make compiler happy, use params */ __COUTV__((void*)address); __COUTV__((void*)writeValue); __COUTV__(numberOfBytes); }
+
+	struct universalAccess_t
+	{
+		bool 								isWrite_;
+		std::string 						address_;  // universalAddressSize_ bytes, little-endian
+		std::string 						data_;     // universalDataSize_ bytes, value to write or value read
+		std::string 						error_;    // empty on success
+	};
+	void 								universalBulkAccess			(std::vector<universalAccess_t*>& accesses);  // in order, consecutive addresses combined into block reads/writes if configured
 	
 
 	void 								runSequenceOfCommands		(const std::string& treeLinkName);
@@ -132,6 +146,39 @@ class FEVInterface : public WorkLoop, public Configurable, public VStateMachine
 	std::map<std::string,
 		FESlowControlsChannel>::iterator			slowControlsChannelsIterator_;
 	FESlowControlsWorkLoop                       	slowControlsWorkLoop_;
+
+	// Slow Controls sampling schedule, built from the channel iterator when the slow controls workloop starts
+	//	Channels are grouped by unique (address, read size), so that each is read only once per due tick,
+	//	and by sampling period, so that only due channels are visited each tick.
+	//	Read groups are sorted by address, so that nearby due addresses can be coalesced into block reads.
+	struct slowControlsReadGroup_t
+	{
+		std::string 								universalAddress_;
+		uint64_t 									addressValue_;  // numeric address, if universalAddressSize_ <= 8
+		unsigned int 								readSizeBytes_;
+		FESlowControlsChannel* 						readChannel_;  // any channel of the group, to do the read
+		std::string 								readValue_;  // latest read value
+	};
+	struct slowControlsPeriodBucket_t
+	{
+		std::chrono::milliseconds 					period_;
+		std::chrono::steady_clock::time_point 		nextSampleTime_;
+		std::vector<std::pair<size_t /*read group index*/,
+			FESlowControlsChannel*>> 				channels_;  // sorted by read group index
+	};
+	std::vector<slowControlsReadGroup_t> 			slowControlsReadGroups_;
+	std::vector<slowControlsPeriodBucket_t> 		slowControlsPeriodBuckets_;
+	unsigned int 									slowControlsBlockReadMaxSpanBytes_    = 0;  // 0 := no block read coalescing
+	unsigned int 									slowControlsBlockReadMaxGapBytes_     = 0;
+	unsigned int 									slowControlsBlockReadBytesPerAddress_ = 0;  // 0 := universalDataSize_
+
+	std::map<std::string /*formula*/,
+		std::shared_ptr<TFormula>> 					slowControlsTransformations_;  // compiled once per unique transformation formula
+
+	unsigned int 						prepareSlowControlsSampling	(void);  // returns number of read access channels
+	void 								compileSlowControlsTransformations	(void);
+	TFormula* 							getSlowControlsTransformation		(const std::string& formula);
+	void 								readSlowControlsGroups		(const std::vector<size_t>& readGroupIndices);  // indices must be ascending
 	// end Slow Controls
 	/////////
 
@@ -230,11 +277,35 @@ class FEVInterface : public WorkLoop, public Configurable, public VStateMachine
 		std::vector<macroStruct_t::delayOp_t> 	delayOps_;
 		std::set<std::string> 					namesOfInputArguments_, namesOfOutputArguments_;
 		bool                  					lsbf_;  // least significant byte first
+
+		// compiled form of the operations, built once at construction:
+		//	a flat op array with variables resolved to slot indices
+		struct compiledOp_t
+		{
+			unsigned int 	type_;  // OP_TYPE_READ, OP_TYPE_WRITE, OP_TYPE_DELAY
+			uint64_t     	value_;  // address, or delay [ms]
+			int          	valueSlot_;  // variable slot of address or delay, -1 if literal
+			uint64_t     	data_;  // write data
+			int          	dataSlot_;  // variable slot of read or write data, -1 if none/literal
+		};  // end macroStruct_t::compiledOp_t declaration
+
+		std::vector<compiledOp_t> 				compiledOps_;
+		std::vector<std::string> 				variableNames_;  // slot index to variable name
+		std::vector<int> 						outputSlots_;
+
+	  private:
+		void 									compile(void);
 	}; // end macroStruct_t declaration
   protected:
 	void runMacro(FEVInterface::macroStruct_t&                        macro,
 	              std::map<std::string /*name*/, uint64_t /*value*/>& variableMap);
 
+	uint64_t 							getUniversalBlockAccessAddressIncrement	(void) const;  // address step between consecutive data words, 0 if block access is off
+
+	unsigned int 						universalBlockAccessBytesPerAddress_ = 0;  // 0 := macro and bulk accesses are never combined into block reads/writes
+	bool 								universalBlockReadUnavailable_  = false;  // set when FE plugin throws UNDEFINED BLOCK READ, to stop attempting block reads
+	bool 								universalBlockWriteUnavailable_ = false;  // set when FE plugin throws UNDEFINED BLOCK WRITE, to stop attempting block writes
+
   public:
 	// end FE Macros
 	/////////
@@ -264,6 +335,9 @@ class FEVInterface : public WorkLoop, public Configurable, public VStateMachine
 	// end FE Communication helpers
 	/////////
 
+  private:
+	bool 							sendToFrontEndInProcess		(const std::string& targetInterfaceID, const std::string& value) const; //returns false if target is not hosted by the parent interface manager
+
   protected:
 	bool        					workLoopThread				(toolbox::task::WorkLoop* workLoop);
 	
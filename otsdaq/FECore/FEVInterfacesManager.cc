@@ -9,7 +9,9 @@
 #include "fhiclcpp/make_ParameterSet.h"
 #include "messagefacility/MessageLogger/MessageLogger.h"
 
+#include <chrono>
 #include <iostream>
+#include <set>
 #include <sstream>
 #include <thread>  //for std::thread
 
@@ -478,6 +480,31 @@ const FEVInterface& FEVInterfacesManager::getFEInterface(const std::string& inte
 	}
 }  // end getFEInterface()
 
+//==============================================================================
+// deliverFrontEndCommunication
+//	Places a value in the receive buffer of the target interface and wakes
+//	any front-end waiting in FEVInterface::receiveFromFrontEnd().
+//	Used directly by FEVInterface::sendToFrontEnd() when the target is hosted
+//	by this manager, and by FESupervisor for values arriving over SOAP.
+void FEVInterfacesManager::deliverFrontEndCommunication(const std::string& targetInterfaceID, const std::string& requester, const std::string& value)
+{
+	// test that the interface exists
+	getFEInterface(targetInterfaceID);
+
+	// mutex scope
+	{
+		std::lock_guard<std::mutex> lock(frontEndCommunicationReceiveMutex_);
+
+		auto& sourceBuffer = frontEndCommunicationReceiveBuffer_[targetInterfaceID][requester];
+		sourceBuffer.emplace(value);
+
+		__CFG_COUT_TYPE__(TLVL_DEBUG + 5) << __COUT_HDR__ << "Target interface ID '" << targetInterfaceID << "' has " << sourceBuffer.size()
+		                                  << " value(s) received from source interface ID '" << requester << "'" << __E__;
+	}  // end mutex scope
+
+	frontEndCommunicationReceiveCondition_.notify_all();
+}  // end deliverFrontEndCommunication()
+
 //==============================================================================
 // universalRead
 //	used by MacroMaker
@@ -487,6 +514,35 @@ void FEVInterfacesManager::universalRead(const std::string& interfaceID, char* a
 	getFEInterfaceP(interfaceID)->universalRead(address, returnValue);
 }  // end universalRead()
 
+//==============================================================================
+// universalBulkAccess
+//	used by MacroMaker
+//	Accesses are grouped by interface (keeping their order within each interface)
+//		and each group is executed by FEVInterface::universalBulkAccess().
+//	Errors are returned per access in error_, and do not throw.
+void FEVInterfacesManager::universalBulkAccess(std::vector<std::pair<std::string /*interfaceID*/, FEVInterface::universalAccess_t> >& accesses)
+{
+	std::map<std::string /*interfaceID*/, std::vector<FEVInterface::universalAccess_t*> > interfaceAccesses;
+	for(auto& access : accesses)
+		interfaceAccesses[access.first].push_back(&access.second);
+
+	__CFG_COUT__ << "Bulk access of " << accesses.size() << " operations on " << interfaceAccesses.size() << " interface(s)." << __E__;
+
+	for(auto& interfaceAccessPair : interfaceAccesses)
+	{
+		try
+		{
+			getFEInterfaceP(interfaceAccessPair.first)->universalBulkAccess(interfaceAccessPair.second);
+		}
+		catch(const std::runtime_error& e)
+		{
+			for(auto& access : interfaceAccessPair.second)
+				if(access->error_ == "")
+					access->error_ = e.what();
+		}
+	}
+}  // end universalBulkAccess()
+
 //==============================================================================
 // getInterfaceUniversalAddressSize
 //	used by MacroMaker
@@ -531,8 +587,8 @@ std::string FEVInterfacesManager::getFEListString(const std::string& supervisorL
 
 //==============================================================================
 // startMacroMultiDimensional
-//	Launches a thread that manages the multi-dimensional loop
-//		running the Macro on the specified FE interface.
+//	Launches a scan that manages the multi-dimensional loop
+//		running the Macro on the specified FE interfaces.
 //	Called by iterator (for now).
 //
 //	Note: no output arguments are returned, but outputs are
@@ -540,6 +596,8 @@ std::string FEVInterfacesManager::getFEListString(const std::string& supervisorL
 //
 //
 //	inputs:
+//		- interfaceID: one interface, or a comma-separated list of interfaces
+//			to scan concurrently (results go to one output file)
 //		- inputArgs: dimensional semi-colon-separated,
 //			comma separated: dimension iterations and arguments (colon-separated
 // name/value/stepsize sets)
@@ -561,479 +619,35 @@ void FEVInterfacesManager::startMacroMultiDimensional(const std::string& request
 		__CFG_SS_THROW__;
 	}
 
-	__CFG_COUT__ << "Starting multi-dimensional Macro '" << macroName << "' for interface '" << interfaceID << ".'" << __E__;
+	__CFG_COUT__ << "Starting multi-dimensional Macro '" << macroName << "' for interface(s) '" << interfaceID << ".'" << __E__;
 
 	__CFG_COUTV__(macroString);
 
 	__CFG_COUTV__(inputArgs);
 
-	// mark active(only one Macro per interface active at any time, for now)
-	{  // lock mutex scope
-		std::lock_guard<std::mutex> lock(macroMultiDimensionalDoneMutex_);
-		// mark active
-		if(macroMultiDimensionalStatusMap_.find(interfaceID) != macroMultiDimensionalStatusMap_.end())
-		{
-			__SS__ << "Failed to start multi-dimensional Macro '" << macroName << "' for interface '" << interfaceID
-			       << "' - this interface already has an active Macro launch!" << __E__;
-			__SS_THROW__;
-		}
-		macroMultiDimensionalStatusMap_.emplace(std::make_pair(interfaceID, "Active"));
-	}  // unlock mutex scope
+	std::shared_ptr<macroMultiDimensionalScan_t> scan = std::make_shared<macroMultiDimensionalScan_t>();
+	scan->macroName_                                  = macroName;
+	scan->macroString_                                = macroString;
+	scan->isFEMacro_                                  = false;
+	StringMacros::getVectorFromString(interfaceID, scan->interfaceIDs_, {','} /*delimeter set*/);
 
-	// start thread
-	std::thread(
-	    [](FEVInterfacesManager* feMgr,
-	       const std::string     interfaceID,
-	       const std::string     macroName,
-	       const std::string     macroString,
-	       const bool            enableSavingOutput,
-	       const std::string     outputFilePath,
-	       const std::string     outputFileRadix,
-	       const std::string     inputArgsStr) {
-		    // create local message facility subject
-		    std::string mfSubject_ = "threadMultiD-" + macroName;
-		    __GEN_COUT__ << "Thread started." << __E__;
-
-		    std::string statusResult = "Done";
-
-		    try
-		    {
-			    //-------------------------------
-			    // check for interfaceID
-			    FEVInterface* fe = feMgr->getFEInterfaceP(interfaceID);
-
-			    //-------------------------------
-			    // extract macro object
-			    FEVInterface::macroStruct_t macro(macroString);
-
-			    //-------------------------------
-			    // create output file pointer
-			    FILE* outputFilePointer = 0;
-			    if(enableSavingOutput)
-			    {
-				    std::string filename = outputFilePath + "/" + outputFileRadix + macroName + "_" + std::to_string(time(0)) + ".txt";
-				    __GEN_COUT__ << "Opening file... " << filename << __E__;
-
-				    outputFilePointer = fopen(filename.c_str(), "w");
-				    if(!outputFilePointer)
-				    {
-					    __GEN_SS__ << "Failed to open output file: " << filename << __E__;
-					    __GEN_SS_THROW__;
-				    }
-			    }  // at this point output file pointer is valid or null
-
-			    //-------------------------------
-			    // setup Macro arguments
-			    __GEN_COUTV__(inputArgsStr);
-
-			    //	inputs:
-			    //		- inputArgs: dimensional semi-colon-separated,
-			    //			comma separated: dimension iterations and arguments
-			    //(colon-separated name/value/stepsize sets)
-
-			    // need to extract input arguments
-			    //	by dimension (by priority)
-			    //
-			    //	two vector by dimension <map of params>
-			    //		one vector for long and for double
-			    //
-			    //	map of params :=
-			    //		name => {
-			    //			<long/double current value>
-			    //			<long/double init value>
-			    //			<long/double step size>
-			    //		}
-
-			    std::vector<unsigned long /*dimension iterations*/> dimensionIterations, dimensionIterationCnt;
-
-			    using longParamMap_t =
-			        std::map<std::string /*name*/, std::pair<long /*current value*/, std::pair<long /*initial value*/, long /*step value*/>>>;
-
-			    std::vector<longParamMap_t> longDimensionParameters;
-			    // Note: double parameters not allowed for Macro (allowed in FE Macros)
-
-			    // instead of strict inputs and outputs, make a map
-			    //	and populate with all input and output names
-			    std::map<std::string /*name*/, uint64_t /*value*/> variableMap;
-
-			    // std::vector<FEVInterface::frontEndMacroArg_t> argsIn;
-			    // std::vector<FEVInterface::frontEndMacroArg_t> argsOut;
-
-			    for(const auto& inputArgName : macro.namesOfInputArguments_)
-				    variableMap.emplace(  // do not care about input arg value
-				        std::pair<std::string /*name*/, uint64_t /*value*/>(inputArgName, 0));
-			    for(const auto& outputArgName : macro.namesOfOutputArguments_)
-				    variableMap.emplace(  // do not care about output arg value
-				        std::pair<std::string /*name*/, uint64_t /*value*/>(outputArgName, 0));
-
-			    if(0)  // example
-			    {
-				    // inputArgsStr = "2,fisrD:3:2,fD2:4:1;4,myOtherArg:5:2,sD:10f:1.3";
-
-				    dimensionIterations.push_back(2);
-				    dimensionIterations.push_back(4);
-
-				    longDimensionParameters.push_back(longParamMap_t());
-				    longDimensionParameters.push_back(longParamMap_t());
-
-				    longDimensionParameters.back().emplace(
-				        std::make_pair("myOtherArg", std::make_pair(3 /*current value*/, std::make_pair(3 /*initial value*/, 4 /*step value*/))));
-			    }  // end example
-
-			    std::vector<std::string> dimensionArgs;
-			    StringMacros::getVectorFromString(inputArgsStr, dimensionArgs, {';'} /*delimeter set*/);
-
-			    __GEN_COUTV__(dimensionArgs.size());
-			    //__GEN_COUTV__(StringMacros::vectorToString(dimensionArgs));
-
-			    if(dimensionArgs.size() == 0)
-			    {
-				    // just call Macro once!
-				    //	create dimension with 1 iteration
-				    //		and no arguments
-				    dimensionIterations.push_back(1);
-				    longDimensionParameters.push_back(longParamMap_t());
-			    }
-			    else
-				    for(unsigned int d = 0; d < dimensionArgs.size(); ++d)
-				    {
-					    // for each dimension
-					    //	get argument and classify as long or double
-
-					    std::vector<std::string> args;
-					    StringMacros::getVectorFromString(dimensionArgs[d], args, {','} /*delimeter set*/);
-
-					    //__GEN_COUTV__(args.size());
-					    //__GEN_COUTV__(StringMacros::vectorToString(args));
-
-					    // require first value for number of iterations
-					    if(args.size() == 0)
-					    {
-						    __GEN_SS__ << "Invalid dimensional arguments! "
-						               << "Need number of iterations at dimension " << d << __E__;
-						    __GEN_SS_THROW__;
-					    }
-
-					    unsigned long numOfIterations;
-					    StringMacros::getNumber(args[0], numOfIterations);
-					    __GEN_COUT__ << "Dimension " << d << " numOfIterations=" << numOfIterations << __E__;
-
-					    // create dimension!
-					    {
-						    dimensionIterations.push_back(numOfIterations);
-						    longDimensionParameters.push_back(longParamMap_t());
-					    }
-
-					    // skip iteration value, start at index 1
-					    for(unsigned int a = 1; a < args.size(); ++a)
-					    {
-						    std::vector<std::string> argPieces;
-						    StringMacros::getVectorFromString(args[a], argPieces, {':'} /*delimeter set*/);
-
-						    __GEN_COUTV__(StringMacros::vectorToString(argPieces));
-
-						    // check pieces and determine if arg is long or double
-						    // 3 pieces := name, init value, step value
-						    if(argPieces.size() != 3)
-						    {
-							    __GEN_SS__ << "Invalid argument pieces! Should be size "
-							                  "3, but is "
-							               << argPieces.size() << __E__;
-							    ss << StringMacros::vectorToString(argPieces);
-							    __GEN_SS_THROW__;
-						    }
-
-						    // check piece 1 and 2 for double hint
-						    //	a la Iterator::startCommandModifyActive()
-						    if((argPieces[1].size() && (argPieces[1][argPieces[1].size() - 1] == 'f' || argPieces[1].find('.') != std::string::npos)) ||
-						       (argPieces[2].size() && (argPieces[2][argPieces[2].size() - 1] == 'f' || argPieces[2].find('.') != std::string::npos)))
-						    {
-							    // handle as double
-
-							    double startValue = strtod(argPieces[1].c_str(), 0);
-							    double stepSize   = strtod(argPieces[2].c_str(), 0);
-
-							    __GEN_COUTV__(startValue);
-							    __GEN_COUTV__(stepSize);
-
-							    __GEN_SS__ << "Error! Only integer aruments allowed for Macros. "
-							               << "Double style arugment found: " << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
-							    __GEN_SS_THROW__;
-							    //							doubleDimensionParameters.back().emplace(
-							    //									std::make_pair(argPieces[0],
-							    //											std::make_pair(
-							    // startValue
-							    ///*current value*/,
-							    //													std::make_pair(
-							    // startValue
-							    ///*initial value*/,
-							    //															stepSize
-							    ///*step  value*/))));
-						    }
-						    else
-						    {
-							    // handle as long
-							    //__GEN_COUT__ << "Long found" << __E__;
-
-							    long int startValue;
-							    long int stepSize;
-
-							    StringMacros::getNumber(argPieces[1], startValue);
-							    StringMacros::getNumber(argPieces[2], stepSize);
-
-							    __GEN_COUTV__(startValue);
-							    __GEN_COUTV__(stepSize);
-
-							    __GEN_COUT__ << "Creating long argument '" << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
-
-							    longDimensionParameters.back().emplace(std::make_pair(
-							        argPieces[0],
-							        std::make_pair(startValue /*current value*/, std::make_pair(startValue /*initial value*/, stepSize /*step value*/))));
-						    }
-
-					    }  // end dimensional argument loop
-
-				    }  // end dimensions loop
-
-			    if(dimensionIterations.size() != longDimensionParameters.size())
-			    {
-				    __GEN_SS__ << "Impossible vector size mismatch! " << dimensionIterations.size() << " - " << longDimensionParameters.size() << __E__;
-				    __GEN_SS_THROW__;
-			    }
-
-			    // output header
-			    {
-				    std::stringstream outSS;
-				    {
-					    outSS << "\n==========================\n" << __E__;
-					    outSS << "Macro '" << macro.macroName_ << "' multi-dimensional scan..." << __E__;
-					    outSS << "\t" << StringMacros::getTimestampString() << __E__;
-					    outSS << "\t" << dimensionIterations.size() << " dimensions defined." << __E__;
-					    for(unsigned int i = 0; i < dimensionIterations.size(); ++i)
-					    {
-						    outSS << "\t\t"
-						          << "dimension[" << i << "] has " << dimensionIterations[i] << " iterations and " << (longDimensionParameters[i].size())
-						          << " arguments." << __E__;
-
-						    for(auto& param : longDimensionParameters[i])
-							    outSS << "\t\t\t"
-							          << "'" << param.first << "' of type long with "
-							          << "initial value and step value [decimal] = "
-							          << "\t" << param.second.second.first << " & " << param.second.second.second << __E__;
-					    }
-
-					    outSS << "\nInput argument names:" << __E__;
-					    for(const auto& inputArgName : macro.namesOfInputArguments_)
-						    outSS << "\t" << inputArgName << __E__;
-					    outSS << "\nOutput argument names:" << __E__;
-					    for(const auto& outputArgName : macro.namesOfOutputArguments_)
-						    outSS << "\t" << outputArgName << __E__;
-
-					    outSS << "\n==========================\n" << __E__;
-				    }  // end outputs stringstream results
-
-				    // if enabled to save to file, do it.
-				    __GEN_COUT__ << "\n" << outSS.str();
-				    if(outputFilePointer)
-					    fprintf(outputFilePointer, "%s", outSS.str().c_str());
-			    }  // end output header
-
-			    unsigned int iterationCount = 0;
-
-			    // Use lambda recursive function to do arbitrary dimensions
-			    //
-			    // Note: can not do lambda recursive function if using auto to declare the
-			    // function, 	and must capture reference to the function. Also, must
-			    // capture specialFolders 	reference for use internally (const values
-			    // already are captured).
-			    std::function<void(const unsigned int /*dimension*/
-			                       )>
-			        localRecurse = [&dimensionIterations,
-			                        &dimensionIterationCnt,
-			                        &iterationCount,
-			                        &longDimensionParameters,
-			                        &fe,
-			                        &macro,
-			                        &variableMap,
-			                        &outputFilePointer,
-			                        &localRecurse](const unsigned int dimension) {
-				        // create local message facility subject
-				        std::string mfSubject_ = "multiD-" + std::to_string(dimension) + "-" + macro.macroName_;
-				        __GEN_COUTV__(dimension);
-
-				        if(dimension >= dimensionIterations.size())
-				        {
-					        __GEN_COUT__ << "Iteration count: " << iterationCount++ << __E__;
-					        __GEN_COUT__ << "Launching Macro '" << macro.macroName_ << "' ..." << __E__;
-
-					        // set argsIn to current value
-					        {
-						        // scan all dimension parameter objects
-						        //	note: Although conflicts should not be allowed
-						        //		at this point, lower dimensions will have priority
-						        // over higher dimension 		with same name argument..
-						        // and longs will have priority over doubles
-
-						        for(unsigned int j = 0; j < dimensionIterations.size(); ++j)
-						        {
-							        for(auto& longParam : longDimensionParameters[j])
-							        {
-								        __GEN_COUT__ << "Assigning argIn '" << longParam.first << "' to current long value '" << longParam.second.first
-								                     << "' from dimension " << j << " parameter." << __E__;
-								        variableMap.at(longParam.first) = longParam.second.first;
-							        }
-						        }  // end long loop
-
-					        }  // done building argsIn
-
-					        // output inputs
-					        {
-						        std::stringstream outSS;
-						        {
-							        outSS << "\n---------------\n" << __E__;
-							        outSS << "Macro '" << macro.macroName_ << "' execution..." << __E__;
-							        outSS << "\t"
-							              << "iteration " << iterationCount << __E__;
-							        for(unsigned int i = 0; i < dimensionIterationCnt.size(); ++i)
-								        outSS << "\t"
-								              << "dimension[" << i << "] index := " << dimensionIterationCnt[i] << __E__;
-
-							        outSS << "\n"
-							              << "\t"
-							              << "Input arguments (count: " << macro.namesOfInputArguments_.size() << "):" << __E__;
-							        for(auto& argIn : macro.namesOfInputArguments_)
-								        outSS << "\t\t" << argIn << " = " << variableMap.at(argIn) << __E__;
-
-						        }  // end outputs stringstream results
-
-						        // if enabled to save to file, do it.
-						        __GEN_COUT__ << "\n" << outSS.str();
-						        if(outputFilePointer)
-							        fprintf(outputFilePointer, "%s", outSS.str().c_str());
-					        }  // end output inputs
-
-					        // have FE and Macro structure, so run it
-					        fe->runMacro(macro, variableMap);
-
-					        __GEN_COUT__ << "Macro complete!" << __E__;
-
-					        // output results
-					        {
-						        std::stringstream outSS;
-						        {
-							        outSS << "\n"
-							              << "\t"
-							              << "Output arguments (count: " << macro.namesOfOutputArguments_.size() << "):" << __E__;
-							        for(auto& argOut : macro.namesOfOutputArguments_)
-								        outSS << "\t\t" << argOut << " = " << variableMap.at(argOut) << __E__;
-						        }  // end outputs stringstream results
-
-						        // if enabled to save to file, do it.
-						        __GEN_COUT__ << "\n" << outSS.str();
-						        if(outputFilePointer)
-							        fprintf(outputFilePointer, "%s", outSS.str().c_str());
-					        }  // end output results
-
-					        return;
-				        }
-
-				        // init dimension index
-				        if(dimension >= dimensionIterationCnt.size())
-					        dimensionIterationCnt.push_back(0);
-
-				        // if enabled to save to file, do it.
-				        __GEN_COUT__ << "\n"
-				                     << "======================================" << __E__ << "dimension[" << dimension
-				                     << "] number of iterations := " << dimensionIterations[dimension] << __E__;
-
-				        // update current value to initial value for this dimension's
-				        // parameters
-				        {
-					        for(auto& longPair : longDimensionParameters[dimension])
-					        {
-						        longPair.second.first =  // reset to initial value
-						            longPair.second.second.first;
-						        __GEN_COUT__ << "arg '" << longPair.first << "' current value: " << longPair.second.first << __E__;
-					        }  // end long loop
-
-				        }  // end update current value to initial value for all
-				           // dimensional parameters
-
-				        for(dimensionIterationCnt[dimension] = 0;  // reset each time through dimension loop
-				            dimensionIterationCnt[dimension] < dimensionIterations[dimension];
-				            ++dimensionIterationCnt[dimension])
-				        {
-					        __GEN_COUT__ << "dimension[" << dimension << "] index := " << dimensionIterationCnt[dimension] << __E__;
-
-					        localRecurse(dimension + 1);
-
-					        // update current value to next value for this dimension's
-					        // parameters
-					        {
-						        for(auto& longPair : longDimensionParameters[dimension])
-						        {
-							        longPair.second.first +=  // add step value
-							            longPair.second.second.second;
-							        __GEN_COUT__ << "arg '" << longPair.first << "' current value: " << longPair.second.first << __E__;
-						        }  // end long loop
-
-					        }  // end update current value to next value for all
-					           // dimensional parameters
-				        }
-				        __GEN_COUT__ << "Completed dimension[" << dimension << "] number of iterations := " << dimensionIterationCnt[dimension] << " of "
-				                     << dimensionIterations[dimension] << __E__;
-			        };  // end local lambda recursive function
-
-			    // launch multi-dimensional recursion
-			    localRecurse(0);
-
-			    // close output file
-			    if(outputFilePointer)
-				    fclose(outputFilePointer);
-		    }
-		    catch(const std::runtime_error& e)
-		    {
-			    __SS__ << "Error executing multi-dimensional Macro: " << e.what() << __E__;
-			    statusResult = ss.str();
-		    }
-		    catch(...)
-		    {
-			    __SS__ << "Unknown error executing multi-dimensional Macro. " << __E__;
-				try	{ throw; } //one more try to printout extra info
-				catch(const std::exception &e)
-				{
-					ss << "Exception message: " << e.what();
-				}
-				catch(...){}
-			    statusResult = ss.str();
-		    }
-
-		    __COUTV__(statusResult);
-
-		    {  // lock mutex scope
-			    std::lock_guard<std::mutex> lock(feMgr->macroMultiDimensionalDoneMutex_);
-			    // change status at completion
-			    feMgr->macroMultiDimensionalStatusMap_[interfaceID] = statusResult;
-		    }
-	    },  // end thread()
-	    this,
-	    interfaceID,
-	    macroName,
-	    macroString,
-	    enableSavingOutput,
-	    outputFilePath,
-	    outputFileRadix,
-	    inputArgs)
-	    .detach();
-
-	__CFG_COUT__ << "Started multi-dimensional Macro '" << macroName << "' for interface '" << interfaceID << ".'" << __E__;
+	// extract macro object, to validate and get argument names
+	FEVInterface::macroStruct_t macro(macroString);
+	for(const auto& inputArgName : macro.namesOfInputArguments_)
+		scan->inputArgNames_.push_back(inputArgName);
+	for(const auto& outputArgName : macro.namesOfOutputArguments_)
+		scan->outputArgNames_.push_back(outputArgName);
+
+	startMacroMultiDimensionalScan(scan, inputArgs, enableSavingOutput, outputFilePath, outputFileRadix);
+
+	__CFG_COUT__ << "Started multi-dimensional Macro '" << macroName << "' for interface(s) '" << interfaceID << ".'" << __E__;
 
 }  // end startMacroMultiDimensional()
 
 //==============================================================================
 // startFEMacroMultiDimensional
-//	Launches a thread that manages the multi-dimensional loop
-//		running the FE Macro in the specified FE interface.
+//	Launches a scan that manages the multi-dimensional loop
+//		running the FE Macro in the specified FE interfaces.
 //	Called by iterator (for now).
 //
 //	Note: no output arguments are returned, but outputs are
@@ -1041,6 +655,8 @@ void FEVInterfacesManager::startMacroMultiDimensional(const std::string& request
 //
 //
 //	inputs:
+//		- interfaceID: one interface, or a comma-separated list of interfaces
+//			to scan concurrently (results go to one output file)
 //		- inputArgs: dimensional semi-colon-separated,
 //			comma separated: dimension iterations and arguments (colon-separated
 // name/value/stepsize sets)
@@ -1061,605 +677,729 @@ void FEVInterfacesManager::startFEMacroMultiDimensional(const std::string& reque
 		__CFG_SS_THROW__;
 	}
 
-	__CFG_COUT__ << "Starting multi-dimensional FE Macro '" << feMacroName << "' for interface '" << interfaceID << ".'" << __E__;
+	__CFG_COUT__ << "Starting multi-dimensional FE Macro '" << feMacroName << "' for interface(s) '" << interfaceID << ".'" << __E__;
 	__CFG_COUTV__(inputArgs);
 
-	// mark active(only one FE Macro per interface active at any time, for now)
+	std::shared_ptr<macroMultiDimensionalScan_t> scan = std::make_shared<macroMultiDimensionalScan_t>();
+	scan->macroName_                                  = feMacroName;
+	scan->isFEMacro_                                  = true;
+	StringMacros::getVectorFromString(interfaceID, scan->interfaceIDs_, {','} /*delimeter set*/);
+
+	// check for interfaces and macro before launching anything
+	for(const auto& scanInterfaceID : scan->interfaceIDs_)
+	{
+		FEVInterface* fe = getFEInterfaceP(scanInterfaceID);
+
+		// have pointer to virtual FEInterface, find Macro structure
+		auto FEMacroIt = fe->getMapOfFEMacroFunctions().find(feMacroName);
+		if(FEMacroIt == fe->getMapOfFEMacroFunctions().end())
+		{
+			__CFG_SS__ << "FE Macro '" << feMacroName << "' of interfaceID '" << scanInterfaceID << "' was not found!" << __E__;
+			__CFG_SS_THROW__;
+		}
+
+		if(scan->inputArgNames_.size() || scan->outputArgNames_.size())
+			continue;  // column names taken from first interface
+
+		for(const auto& inputArgName : FEMacroIt->second.namesOfInputArguments_)
+			scan->inputArgNames_.push_back(inputArgName);
+		for(const auto& outputArgName : FEMacroIt->second.namesOfOutputArguments_)
+			scan->outputArgNames_.push_back(outputArgName);
+	}
+
+	startMacroMultiDimensionalScan(scan, inputArgs, enableSavingOutput, outputFilePath, outputFileRadix);
+
+	__CFG_COUT__ << "Started multi-dimensional FE Macro '" << feMacroName << "' for interface(s) '" << interfaceID << ".'" << __E__;
+
+}  // end startFEMacroMultiDimensional()
+
+//==============================================================================
+// startMacroMultiDimensionalScan
+//	Parses the dimensional arguments, marks all scan interfaces active,
+//	opens the output file, and launches the bounded pool of scan threads.
+//
+//	inputs:
+//		- inputArgs: dimensional semi-colon-separated,
+//			comma separated: dimension iterations and arguments (colon-separated
+// name/value/stepsize sets)
+//			e.g. "2,fisrD:3:2,fD2:4:1;4,myOtherArg:5:2,sD:10f:1.3"
+void FEVInterfacesManager::startMacroMultiDimensionalScan(std::shared_ptr<macroMultiDimensionalScan_t> scan,
+                                                          const std::string&                           inputArgs,
+                                                          const bool                                   enableSavingOutput,
+                                                          const std::string&                           outputFilePath,
+                                                          const std::string&                           outputFileRadix)
+{
+	const std::string macroType = scan->isFEMacro_ ? "FE Macro" : "Macro";
+
+	if(scan->interfaceIDs_.size() == 0)
+	{
+		__CFG_SS__ << "No target interfaces given for multi-dimensional " << macroType << " '" << scan->macroName_ << ".'" << __E__;
+		__CFG_SS_THROW__;
+	}
+	if(std::set<std::string>(scan->interfaceIDs_.begin(), scan->interfaceIDs_.end()).size() != scan->interfaceIDs_.size())
+	{
+		__CFG_SS__ << "Duplicate target interfaces given for multi-dimensional " << macroType << " '" << scan->macroName_
+		           << "': " << StringMacros::vectorToString(scan->interfaceIDs_) << __E__;
+		__CFG_SS_THROW__;
+	}
+
+	//-------------------------------
+	// setup Macro arguments, by dimension
+	std::vector<std::string> dimensionArgs;
+	StringMacros::getVectorFromString(inputArgs, dimensionArgs, {';'} /*delimeter set*/);
+
+	__CFG_COUTV__(dimensionArgs.size());
+
+	if(dimensionArgs.size() == 0)
+	{
+		// just call Macro once!
+		//	create dimension with 1 iteration
+		//		and no arguments
+		dimensionArgs.push_back("1");
+	}
+
+	for(unsigned int d = 0; d < dimensionArgs.size(); ++d)
+	{
+		// for each dimension
+		//	get argument and classify as long, double, or string
+
+		std::vector<std::string> args;
+		StringMacros::getVectorFromString(dimensionArgs[d], args, {','} /*delimeter set*/);
+
+		// require first value for number of iterations
+		if(args.size() == 0)
+		{
+			__CFG_SS__ << "Invalid dimensional arguments! "
+			           << "Need number of iterations at dimension " << d << __E__;
+			__CFG_SS_THROW__;
+		}
+
+		unsigned long numOfIterations;
+		StringMacros::getNumber(args[0], numOfIterations);
+		__CFG_COUT__ << "Dimension " << d << " numOfIterations=" << numOfIterations << __E__;
+
+		// create dimension!
+		scan->dimensionIterations_.push_back(numOfIterations);
+		scan->longDimensionParameters_.push_back({});
+		scan->doubleDimensionParameters_.push_back({});
+		scan->stringDimensionParameters_.push_back({});
+		scan->iterationsPerInterface_ *= numOfIterations;
+
+		// skip iteration value, start at index 1
+		for(unsigned int a = 1; a < args.size(); ++a)
+		{
+			std::vector<std::string> argPieces;
+			StringMacros::getVectorFromString(args[a], argPieces, {':'} /*delimeter set*/);
+
+			// check pieces and determine if arg is long or double
+			// 3 pieces := name, init value, step value
+			if(argPieces.size() != 3)
+			{
+				__CFG_SS__ << "Invalid argument pieces! Should be size "
+				              "3, but is "
+				           << argPieces.size() << __E__;
+				ss << StringMacros::vectorToString(argPieces);
+				__CFG_SS_THROW__;
+			}
+
+			// check piece 1 and 2 for double hint
+			//	a la Iterator::startCommandModifyActive()
+			if(scan->isFEMacro_ && argPieces[2] == TableViewColumnInfo::DATATYPE_STRING_DEFAULT)
+			{
+				// if step size is default, considering value an unchanging string
+				__CFG_COUT__ << "Creating string argument '" << argPieces[0] << "' := " << argPieces[1] << __E__;
+
+				scan->stringDimensionParameters_.back().emplace(argPieces[0], argPieces[1]);
+			}
+			else if((argPieces[1].size() && (argPieces[1][argPieces[1].size() - 1] == 'f' || argPieces[1].find('.') != std::string::npos)) ||
+			        (argPieces[2].size() && (argPieces[2][argPieces[2].size() - 1] == 'f' || argPieces[2].find('.') != std::string::npos)))
+			{
+				// handle as double
+				double startValue = strtod(argPieces[1].c_str(), 0);
+				double stepSize   = strtod(argPieces[2].c_str(), 0);
+
+				if(!scan->isFEMacro_)
+				{
+					__CFG_SS__ << "Error! Only integer aruments allowed for Macros. "
+					           << "Double style arugment found: " << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
+					__CFG_SS_THROW__;
+				}
+
+				__CFG_COUT__ << "Creating double argument '" << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
+
+				scan->doubleDimensionParameters_.back().emplace(argPieces[0], std::make_pair(startValue /*initial value*/, stepSize /*step value*/));
+			}
+			else
+			{
+				// handle as long
+				long int startValue;
+				long int stepSize;
+
+				StringMacros::getNumber(argPieces[1], startValue);
+				StringMacros::getNumber(argPieces[2], stepSize);
+
+				__CFG_COUT__ << "Creating long argument '" << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
+
+				scan->longDimensionParameters_.back().emplace(argPieces[0], std::make_pair(startValue /*initial value*/, stepSize /*step value*/));
+			}
+
+		}  // end dimensional argument loop
+
+	}  // end dimensions loop
+
+	//-------------------------------
+	// mark active (only one launch per interface active at any time)
+	//	Note: an interface of an erased scan stays "Aborting" until its thread stops
 	{  // lock mutex scope
 		std::lock_guard<std::mutex> lock(macroMultiDimensionalDoneMutex_);
-		// mark active
-		if(macroMultiDimensionalStatusMap_.find(interfaceID) != macroMultiDimensionalStatusMap_.end())
+		for(const auto& interfaceID : scan->interfaceIDs_)
+		{
+			auto statusIt = macroMultiDimensionalStatusMap_.find(interfaceID);
+			if(statusIt != macroMultiDimensionalStatusMap_.end() && (statusIt->second == "Active" || statusIt->second == "Aborting"))
+			{
+				__CFG_SS__ << "Failed to start multi-dimensional " << macroType << " '" << scan->macroName_ << "' for interface '" << interfaceID
+				           << "' - this interface already has an active multi-dimensional launch (status = " << statusIt->second << ")!" << __E__;
+				__CFG_SS_THROW__;
+			}
+		}
+		for(const auto& interfaceID : scan->interfaceIDs_)
 		{
-			__SS__ << "Failed to start multi-dimensional FE Macro '" << feMacroName << "' for interface '" << interfaceID
-			       << "' - this interface already has an active FE Macro launch!" << __E__;
-			__SS_THROW__;
+			macroMultiDimensionalStatusMap_[interfaceID] = "Active";
+			macroMultiDimensionalScanMap_[interfaceID]   = scan;
 		}
-		macroMultiDimensionalStatusMap_.emplace(std::make_pair(interfaceID, "Active"));
+	}  // unlock mutex scope
+
+	// on any failure from here, release the interfaces and the output file of the scan
+	try
+	{
+		//-------------------------------
+		// create output file pointer
+		if(enableSavingOutput)
+		{
+			std::string filename = outputFilePath + "/" + outputFileRadix + scan->macroName_ + "_" + std::to_string(time(0)) + ".txt";
+			__CFG_COUT__ << "Opening file... " << filename << __E__;
+
+			scan->outputFilePointer_ = fopen(filename.c_str(), "w");
+			if(!scan->outputFilePointer_)
+			{
+				__CFG_SS__ << "Failed to open output file: " << filename << __E__;
+				__CFG_SS_THROW__;
+			}
+		}  // at this point output file pointer is valid or null
+
+		// output header, as comments above the column names
+		{
+			std::stringstream outSS;
+			outSS << "# " << macroType << " '" << scan->macroName_ << "' multi-dimensional scan..." << __E__;
+			outSS << "#\t" << StringMacros::getTimestampString() << __E__;
+			outSS << "#\t" << scan->interfaceIDs_.size() << " interface(s): " << StringMacros::vectorToString(scan->interfaceIDs_) << __E__;
+			outSS << "#\t" << scan->dimensionIterations_.size() << " dimensions defined." << __E__;
+			for(unsigned int i = 0; i < scan->dimensionIterations_.size(); ++i)
+			{
+				outSS << "#\t\t"
+				      << "dimension[" << i << "] has " << scan->dimensionIterations_[i] << " iterations and "
+				      << (scan->longDimensionParameters_[i].size() + scan->doubleDimensionParameters_[i].size() + scan->stringDimensionParameters_[i].size())
+				      << " arguments." << __E__;
+
+				for(auto& param : scan->longDimensionParameters_[i])
+					outSS << "#\t\t\t"
+					      << "'" << param.first << "' of type long with "
+					      << "initial value and step value [decimal] = "
+					      << "\t" << param.second.first << " & " << param.second.second << __E__;
+				for(auto& param : scan->doubleDimensionParameters_[i])
+					outSS << "#\t\t\t"
+					      << "'" << param.first << "' of type double with "
+					      << "initial value and step value = "
+					      << "\t" << param.second.first << " & " << param.second.second << __E__;
+				for(auto& param : scan->stringDimensionParameters_[i])
+					outSS << "#\t\t\t"
+					      << "'" << param.first << "' of type string with "
+					      << "value = "
+					      << "\t" << param.second << __E__;
+			}
+
+			// column names: one row per Macro execution
+			outSS << "interface\titeration";
+			for(unsigned int i = 0; i < scan->dimensionIterations_.size(); ++i)
+				outSS << "\tdimension[" << i << "]";
+			for(const auto& inputArgName : scan->inputArgNames_)
+				outSS << "\t" << inputArgName;
+			for(const auto& outputArgName : scan->outputArgNames_)
+				outSS << "\t" << outputArgName;
+			outSS << __E__;
+
+			__CFG_COUT__ << "\n" << outSS.str();
+			scan->writeOutput(outSS.str());
+		}  // end output header
+
+		//-------------------------------
+		// start bounded pool of threads, each takes the next interface until all are done
+		unsigned int numOfThreads = ConfigurationManager::PROCESSOR_COUNT / 2;
+		if(numOfThreads < 1)
+			numOfThreads = 1;
+		if(numOfThreads > scan->interfaceIDs_.size())
+			numOfThreads = scan->interfaceIDs_.size();
+
+		__CFG_COUT__ << "PROCESSOR_COUNT " << ConfigurationManager::PROCESSOR_COUNT << " ==> " << numOfThreads << " threads for multi-dimensional "
+		             << macroType << " '" << scan->macroName_ << "' on " << scan->interfaceIDs_.size() << " interface(s)." << __E__;
+
+		for(unsigned int i = 0; i < numOfThreads; ++i)
+			std::thread(&FEVInterfacesManager::macroMultiDimensionalScanThread, this, scan).detach();
+	}
+	catch(...)
+	{
+		std::lock_guard<std::mutex> lock(macroMultiDimensionalDoneMutex_);
+		eraseMacroMultiDimensionalScan(*scan);
+		throw;
 	}
+}  // end startMacroMultiDimensionalScan()
+
+//==============================================================================
+// macroMultiDimensionalScanThread
+//	Scan pool thread: runs the whole multi-dimensional loop for one interface
+//		at a time, taking the next interface of the scan until none remain.
+void FEVInterfacesManager::macroMultiDimensionalScanThread(FEVInterfacesManager* feMgr, std::shared_ptr<macroMultiDimensionalScan_t> scan)
+{
+	// create local message facility subject
+	std::string mfSubject_ = "threadMultiD-" + scan->macroName_;
+	__GEN_COUT__ << "Thread started." << __E__;
+
+	while(1)
+	{
+		size_t interfaceIndex;
+		{  // lock mutex scope
+			std::lock_guard<std::mutex> lock(feMgr->macroMultiDimensionalDoneMutex_);
+			if(scan->aborted_ || (interfaceIndex = scan->nextInterfaceIndex_++) >= scan->interfaceIDs_.size())
+				break;
+			scan->runningInterfaceIDs_.emplace(scan->interfaceIDs_[interfaceIndex]);
+		}  // unlock mutex scope
+
+		const std::string& interfaceID  = scan->interfaceIDs_[interfaceIndex];
+		std::string        statusResult = "Done";
+
+		try
+		{
+			runMacroMultiDimensionalScan(feMgr, *scan, interfaceID);
+		}
+		catch(const std::runtime_error& e)
+		{
+			__SS__ << "Error executing multi-dimensional " << (scan->isFEMacro_ ? "FE Macro" : "Macro") << " on interface '" << interfaceID
+			       << "': " << e.what() << __E__;
+			statusResult = ss.str();
+		}
+		catch(...)
+		{
+			__SS__ << "Unknown error executing multi-dimensional " << (scan->isFEMacro_ ? "FE Macro" : "Macro") << " on interface '" << interfaceID << ".' "
+			       << __E__;
+			try	{ throw; } //one more try to printout extra info
+			catch(const std::exception &e)
+			{
+				ss << "Exception message: " << e.what();
+			}
+			catch(...){}
+			statusResult = ss.str();
+		}
 
-	// start thread
-	std::thread(
-	    [](FEVInterfacesManager* feMgr,
-	       const std::string     interfaceID,
-	       const std::string     feMacroName,
-	       const bool            enableSavingOutput,
-	       const std::string     outputFilePath,
-	       const std::string     outputFileRadix,
-	       const std::string     inputArgsStr) {
-		    // create local message facility subject
-		    std::string mfSubject_ = "threadMultiD-" + feMacroName;
-		    __GEN_COUT__ << "Thread started." << __E__;
-
-		    std::string statusResult = "Done";
-
-		    try
-		    {
-			    //-------------------------------
-			    // check for interfaceID and macro
-			    FEVInterface* fe = feMgr->getFEInterfaceP(interfaceID);
-
-			    // have pointer to virtual FEInterface, find Macro structure
-			    auto FEMacroIt = fe->getMapOfFEMacroFunctions().find(feMacroName);
-			    if(FEMacroIt == fe->getMapOfFEMacroFunctions().end())
-			    {
-				    __GEN_SS__ << "FE Macro '" << feMacroName << "' of interfaceID '" << interfaceID << "' was not found!" << __E__;
-				    __GEN_SS_THROW__;
-			    }
-			    const FEVInterface::frontEndMacroStruct_t& feMacro = FEMacroIt->second;
-
-			    //-------------------------------
-			    // create output file pointer
-			    FILE* outputFilePointer = 0;
-			    if(enableSavingOutput)
-			    {
-				    std::string filename = outputFilePath + "/" + outputFileRadix + feMacroName + "_" + std::to_string(time(0)) + ".txt";
-				    __GEN_COUT__ << "Opening file... " << filename << __E__;
-
-				    outputFilePointer = fopen(filename.c_str(), "w");
-				    if(!outputFilePointer)
-				    {
-					    __GEN_SS__ << "Failed to open output file: " << filename << __E__;
-					    __GEN_SS_THROW__;
-				    }
-			    }  // at this point output file pointer is valid or null
-
-			    //-------------------------------
-			    // setup FE macro aruments
-			    __GEN_COUTV__(inputArgsStr);
-
-			    //	inputs:
-			    //		- inputArgs: dimensional semi-colon-separated,
-			    //			comma separated: dimension iterations and arguments
-			    //(colon-separated name/value/stepsize sets)
-
-			    // need to extract input arguments
-			    //	by dimension (by priority)
-			    //
-			    //	two vector by dimension <map of params>
-			    //		one vector for long and for double
-			    //
-			    //	map of params :=
-			    //		name => {
-			    //			<long/double current value>
-			    //			<long/double init value>
-			    //			<long/double step size>
-			    //		}
-
-			    std::vector<unsigned long /*dimension iterations*/> dimensionIterations, dimensionIterationCnt;
-
-			    using longParamMap_t =
-			        std::map<std::string /*name*/, std::pair<long /*current value*/, std::pair<long /*initial value*/, long /*step value*/>>>;
-			    using doubleParamMap_t =
-			        std::map<std::string /*name*/, std::pair<double /*current value*/, std::pair<double /*initial value*/, double /*step value*/>>>;
-			    using stringParamMap_t = std::map<std::string /*name*/, std::string /* value*/>;
-
-			    std::vector<longParamMap_t>   longDimensionParameters;
-			    std::vector<doubleParamMap_t> doubleDimensionParameters;
-			    std::vector<stringParamMap_t> stringDimensionParameters;
-
-			    std::vector<FEVInterface::frontEndMacroArg_t> argsIn;
-			    std::vector<FEVInterface::frontEndMacroArg_t> argsOut;
-
-			    for(unsigned int i = 0; i < feMacro.namesOfInputArguments_.size(); ++i)
-				    argsIn.push_back(std::make_pair(  // do not care about input arg value
-				        feMacro.namesOfInputArguments_[i],
-				        ""));
-			    for(unsigned int i = 0; i < feMacro.namesOfOutputArguments_.size(); ++i)
-				    argsOut.push_back(std::make_pair(  // do not care about output arg value
-				        feMacro.namesOfOutputArguments_[i],
-				        ""));
-
-			    if(0)  // example
-			    {
-				    // inputArgsStr = "2,fisrD:3:2,fD2:4:1;4,myOtherArg:5:2,sD:10f:1.3";
-
-				    argsIn.push_back(std::make_pair("myOtherArg", "3"));
-
-				    dimensionIterations.push_back(2);
-				    dimensionIterations.push_back(4);
-
-				    longDimensionParameters.push_back(longParamMap_t());
-				    longDimensionParameters.push_back(longParamMap_t());
-
-				    doubleDimensionParameters.push_back(doubleParamMap_t());
-				    doubleDimensionParameters.push_back(doubleParamMap_t());
-
-				    longDimensionParameters.back().emplace(
-				        std::make_pair("myOtherArg", std::make_pair(3 /*current value*/, std::make_pair(3 /*initial value*/, 4 /*step value*/))));
-			    }  // end example
-
-			    std::vector<std::string> dimensionArgs;
-			    StringMacros::getVectorFromString(inputArgsStr, dimensionArgs, {';'} /*delimeter set*/);
-
-			    __GEN_COUTV__(dimensionArgs.size());
-			    //__GEN_COUTV__(StringMacros::vectorToString(dimensionArgs));
-
-			    if(dimensionArgs.size() == 0)
-			    {
-				    // just call FE Macro once!
-				    //	create dimension with 1 iteration
-				    //		and no arguments
-				    dimensionIterations.push_back(1);
-				    longDimensionParameters.push_back(longParamMap_t());
-				    doubleDimensionParameters.push_back(doubleParamMap_t());
-				    stringDimensionParameters.push_back(stringParamMap_t());
-			    }
-			    else
-				    for(unsigned int d = 0; d < dimensionArgs.size(); ++d)
-				    {
-					    // for each dimension
-					    //	get argument and classify as long or double
-
-					    std::vector<std::string> args;
-					    StringMacros::getVectorFromString(dimensionArgs[d], args, {','} /*delimeter set*/);
-
-					    //__GEN_COUTV__(args.size());
-					    //__GEN_COUTV__(StringMacros::vectorToString(args));
-
-					    // require first value for number of iterations
-					    if(args.size() == 0)
-					    {
-						    __GEN_SS__ << "Invalid dimensional arguments! "
-						               << "Need number of iterations at dimension " << d << __E__;
-						    __GEN_SS_THROW__;
-					    }
-
-					    unsigned long numOfIterations;
-					    StringMacros::getNumber(args[0], numOfIterations);
-					    __GEN_COUT__ << "Dimension " << d << " numOfIterations=" << numOfIterations << __E__;
-
-					    // create dimension!
-					    {
-						    dimensionIterations.push_back(numOfIterations);
-						    longDimensionParameters.push_back(longParamMap_t());
-						    doubleDimensionParameters.push_back(doubleParamMap_t());
-						    stringDimensionParameters.push_back(stringParamMap_t());
-					    }
-
-					    // skip iteration value, start at index 1
-					    for(unsigned int a = 1; a < args.size(); ++a)
-					    {
-						    std::vector<std::string> argPieces;
-						    StringMacros::getVectorFromString(args[a], argPieces, {':'} /*delimeter set*/);
-
-						    __GEN_COUTV__(StringMacros::vectorToString(argPieces));
-
-						    // check pieces and determine if arg is long or double
-						    // 3 pieces := name, init value, step value
-						    if(argPieces.size() != 3)
-						    {
-							    __GEN_SS__ << "Invalid argument pieces! Should be size "
-							                  "3, but is "
-							               << argPieces.size() << __E__;
-							    ss << StringMacros::vectorToString(argPieces);
-							    __GEN_SS_THROW__;
-						    }
-
-						    // check piece 1 and 2 for double hint
-						    //	a la Iterator::startCommandModifyActive()
-						    if(argPieces[2] == TableViewColumnInfo::DATATYPE_STRING_DEFAULT)
-						    {
-							    // if step size is default, considering value an unchanging string
-
-							    __GEN_COUT__ << "Creating string argument '" << argPieces[0] << "' := " << argPieces[1] << __E__;
-
-							    stringDimensionParameters.back().emplace(std::make_pair(argPieces[0], argPieces[1]));
-						    }
-						    else if((argPieces[1].size() && (argPieces[1][argPieces[1].size() - 1] == 'f' || argPieces[1].find('.') != std::string::npos)) ||
-						            (argPieces[2].size() && (argPieces[2][argPieces[2].size() - 1] == 'f' || argPieces[2].find('.') != std::string::npos)))
-						    {
-							    // handle as double
-							    //__GEN_COUT__ << "Double found" << __E__;
-
-							    double startValue = strtod(argPieces[1].c_str(), 0);
-							    double stepSize   = strtod(argPieces[2].c_str(), 0);
-
-							    __GEN_COUTV__(startValue);
-							    __GEN_COUTV__(stepSize);
-
-							    __GEN_COUT__ << "Creating double argument '" << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
-
-							    doubleDimensionParameters.back().emplace(std::make_pair(
-							        argPieces[0],
-							        std::make_pair(startValue /*current value*/, std::make_pair(startValue /*initial value*/, stepSize /*step value*/))));
-						    }
-						    else
-						    {
-							    // handle as long
-							    //__GEN_COUT__ << "Long found" << __E__;
-
-							    long int startValue;
-							    long int stepSize;
-
-							    StringMacros::getNumber(argPieces[1], startValue);
-							    StringMacros::getNumber(argPieces[2], stepSize);
-
-							    __GEN_COUTV__(startValue);
-							    __GEN_COUTV__(stepSize);
-
-							    __GEN_COUT__ << "Creating long argument '" << argPieces[0] << "' := " << startValue << ", " << stepSize << __E__;
-
-							    longDimensionParameters.back().emplace(std::make_pair(
-							        argPieces[0],
-							        std::make_pair(startValue /*current value*/, std::make_pair(startValue /*initial value*/, stepSize /*step value*/))));
-						    }
-
-					    }  // end dimensional argument loop
-
-				    }  // end dimensions loop
-
-			    if(dimensionIterations.size() != longDimensionParameters.size() || dimensionIterations.size() != doubleDimensionParameters.size() ||
-			       dimensionIterations.size() != stringDimensionParameters.size())
-			    {
-				    __GEN_SS__ << "Impossible vector size mismatch! " << dimensionIterations.size() << " - " << longDimensionParameters.size() << " - "
-				               << doubleDimensionParameters.size() << " - " << stringDimensionParameters.size() << __E__;
-				    __GEN_SS_THROW__;
-			    }
-
-			    // output header
-			    {
-				    std::stringstream outSS;
-				    {
-					    outSS << "\n==========================\n" << __E__;
-					    outSS << "FEMacro '" << feMacro.feMacroName_ << "' multi-dimensional scan..." << __E__;
-					    outSS << "\t" << StringMacros::getTimestampString() << __E__;
-					    outSS << "\t" << dimensionIterations.size() << " dimensions defined." << __E__;
-					    for(unsigned int i = 0; i < dimensionIterations.size(); ++i)
-					    {
-						    outSS << "\t\t"
-						          << "dimension[" << i << "] has " << dimensionIterations[i] << " iterations and "
-						          << (longDimensionParameters[i].size() + doubleDimensionParameters[i].size() + stringDimensionParameters[i].size())
-						          << " arguments." << __E__;
-
-						    for(auto& param : longDimensionParameters[i])
-							    outSS << "\t\t\t"
-							          << "'" << param.first << "' of type long with "
-							          << "initial value and step value [decimal] = "
-							          << "\t" << param.second.second.first << " & " << param.second.second.second << __E__;
-
-						    for(auto& param : doubleDimensionParameters[i])
-							    outSS << "\t\t\t"
-							          << "'" << param.first << "' of type double with "
-							          << "initial value and step value = "
-							          << "\t" << param.second.second.first << " & " << param.second.second.second << __E__;
-
-						    for(auto& param : stringDimensionParameters[i])
-							    outSS << "\t\t\t"
-							          << "'" << param.first << "' of type string with "
-							          << "value = "
-							          << "\t" << param.second << __E__;
-					    }
-
-					    outSS << "\nHere are the identified input arguments:" << __E__;
-					    for(unsigned int i = 0; i < feMacro.namesOfInputArguments_.size(); ++i)
-						    outSS << "\t" << feMacro.namesOfInputArguments_[i] << __E__;
-					    outSS << "\nHere are the identified input arguments:" << __E__;
-					    for(unsigned int i = 0; i < feMacro.namesOfOutputArguments_.size(); ++i)
-						    outSS << "\t" << feMacro.namesOfOutputArguments_[i] << __E__;
-
-					    outSS << "\n==========================\n" << __E__;
-				    }  // end outputs stringstream results
-
-				    // if enabled to save to file, do it.
-				    __GEN_COUT__ << "\n" << outSS.str();
-				    if(outputFilePointer)
-					    fprintf(outputFilePointer, "%s", outSS.str().c_str());
-			    }  // end output header
-
-			    unsigned int iterationCount = 0;
-
-			    // Use lambda recursive function to do arbitrary dimensions
-			    //
-			    // Note: can not do lambda recursive function if using auto to declare the
-			    // function, 	and must capture reference to the function. Also, must
-			    // capture specialFolders 	reference for use internally (const values
-			    // already are captured).
-			    std::function<void(const unsigned int /*dimension*/
-			                       )>
-			        localRecurse = [&dimensionIterations,
-			                        &dimensionIterationCnt,
-			                        &iterationCount,
-			                        &longDimensionParameters,
-			                        &doubleDimensionParameters,
-			                        &stringDimensionParameters,
-			                        &fe,
-			                        &feMacro,
-			                        &outputFilePointer,
-			                        &argsIn,
-			                        &argsOut,
-			                        &localRecurse](const unsigned int dimension) {
-				        // create local message facility subject
-				        std::string mfSubject_ = "multiD-" + std::to_string(dimension) + "-" + feMacro.feMacroName_;
-				        __GEN_COUTV__(dimension);
-
-				        if(dimension >= dimensionIterations.size())
-				        {
-					        __GEN_COUT__ << "Iteration count: " << iterationCount++ << __E__;
-					        __GEN_COUT__ << "Launching FE Macro '" << feMacro.feMacroName_ << "' ..." << __E__;
-
-					        // set argsIn to current value
-
-					        // scan all dimension parameter objects
-					        //	note: Although conflicts should not be allowed
-					        //		at this point, lower dimensions will have priority
-					        // over  higher dimension 		with same name argument.. and
-					        // longs will have priority  over doubles
-
-					        bool foundAsLong;
-					        for(unsigned int i = 0; i < argsIn.size(); ++i)
-					        {
-						        foundAsLong = false;
-						        for(unsigned int j = 0; j < dimensionIterations.size(); ++j)
-						        {
-							        auto longIt = longDimensionParameters[j].find(argsIn[i].first);
-							        if(longIt == longDimensionParameters[j].end())
-								        continue;
-
-							        // else found long!
-							        __GEN_COUT__ << "Assigning argIn '" << argsIn[i].first << "' to current long value '" << longIt->second.first
-							                     << "' from dimension " << j << " parameter." << __E__;
-							        argsIn[i].second = std::to_string(longIt->second.first);
-							        foundAsLong      = true;
-							        break;
-						        }  // end long loop
-
-						        if(foundAsLong)
-						        {
-							        continue;  // skip double check
-						        }
-
-						        for(unsigned int j = 0; j < dimensionIterations.size(); ++j)
-						        {
-							        auto doubleIt = doubleDimensionParameters[j].find(argsIn[i].first);
-							        if(doubleIt == doubleDimensionParameters[j].end())
-								        continue;
-
-							        // else found long!
-							        __GEN_COUT__ << "Assigning argIn '" << argsIn[i].first << "' to current double value '" << doubleIt->second.first
-							                     << "' from dimension " << j << " parameter." << __E__;
-							        argsIn[i].second = std::to_string(doubleIt->second.first);
-							        foundAsLong      = true;
-							        break;
-						        }  // end double loop
-
-						        if(foundAsLong)
-						        {
-							        continue;  // skip double check
-						        }
-
-						        for(unsigned int j = 0; j < dimensionIterations.size(); ++j)
-						        {
-							        auto stringIt = stringDimensionParameters[j].find(argsIn[i].first);
-							        if(stringIt == stringDimensionParameters[j].end())
-								        continue;
-
-							        // else found long!
-							        __GEN_COUT__ << "Assigning argIn '" << argsIn[i].first << "' to current string value '" << stringIt->second
-							                     << "' from dimension " << j << " parameter." << __E__;
-							        argsIn[i].second = stringIt->second;
-							        foundAsLong      = true;
-							        break;
-						        }  // end double loop
-
-						        if(foundAsLong)
-						        {
-							        continue;  // skip double check
-						        }
-
-						        __GEN_SS__ << "ArgIn '" << argsIn[i].first << "' was not assigned a value "
-						                   << "by any dimensional loop parameter sets. "
-						                      "This is illegal. FEMacro '"
-						                   << feMacro.feMacroName_ << "' requires '" << argsIn[i].first
-						                   << "' as an input argument. Either remove the "
-						                      "input argument from this FEMacro, "
-						                   << "or define a value as a dimensional loop "
-						                      "parameter."
-						                   << __E__;
-						        __GEN_SS_THROW__;
-					        }  // done building argsIn
-
-					        // have pointer to Macro structure, so run it
-					        (fe->*(feMacro.macroFunction_))(feMacro, argsIn, argsOut);
-
-					        __GEN_COUT__ << "FE Macro complete!" << __E__;
-
-					        // output results
-					        {
-						        std::stringstream outSS;
-						        {
-							        outSS << "\n---------------\n" << __E__;
-							        outSS << "FEMacro '" << feMacro.feMacroName_ << "' execution..." << __E__;
-							        outSS << "\t"
-							              << "iteration " << iterationCount << __E__;
-							        for(unsigned int i = 0; i < dimensionIterationCnt.size(); ++i)
-								        outSS << "\t"
-								              << "dimension[" << i << "] index := " << dimensionIterationCnt[i] << __E__;
-
-							        outSS << "\n"
-							              << "\t"
-							              << "Input arguments (count: " << argsIn.size() << "):" << __E__;
-							        for(auto& argIn : argsIn)
-								        outSS << "\t\t" << argIn.first << " = " << argIn.second << __E__;
-
-							        outSS << "\n"
-							              << "\t"
-							              << "Output arguments (count: " << argsOut.size() << "):" << __E__;
-							        for(auto& argOut : argsOut)
-								        outSS << "\t\t" << argOut.first << " = " << argOut.second << __E__;
-						        }  // end outputs stringstream results
-
-						        // if enabled to save to file, do it.
-						        __GEN_COUT__ << "\n" << outSS.str();
-						        if(outputFilePointer)
-							        fprintf(outputFilePointer, "%s", outSS.str().c_str());
-					        }  // end output results
-
-					        return;
-				        }
-
-				        // init dimension index
-				        if(dimension >= dimensionIterationCnt.size())
-					        dimensionIterationCnt.push_back(0);
-
-				        // if enabled to save to file, do it.
-				        __GEN_COUT__ << "\n"
-				                     << "======================================" << __E__ << "dimension[" << dimension
-				                     << "] number of iterations := " << dimensionIterations[dimension] << __E__;
-
-				        // update current value to initial value for this dimension's
-				        // parameters
-				        {
-					        for(auto& longPair : longDimensionParameters[dimension])
-					        {
-						        longPair.second.first =  // reset to initial value
-						            longPair.second.second.first;
-						        __GEN_COUT__ << "arg '" << longPair.first << "' current value: " << longPair.second.first << __E__;
-					        }  // end long loop
-
-					        for(auto& doublePair : doubleDimensionParameters[dimension])
-					        {
-						        doublePair.second.first =  // reset to initial value
-						            doublePair.second.second.first;
-						        __GEN_COUT__ << "arg '" << doublePair.first << "' current value: " << doublePair.second.first << __E__;
-					        }  // end double loop
-				        }      // end update current value to initial value for all
-				               // dimensional parameters
-
-				        for(dimensionIterationCnt[dimension] = 0;  // reset each time through dimension loop
-				            dimensionIterationCnt[dimension] < dimensionIterations[dimension];
-				            ++dimensionIterationCnt[dimension])
-				        {
-					        __GEN_COUT__ << "dimension[" << dimension << "] index := " << dimensionIterationCnt[dimension] << __E__;
-
-					        localRecurse(dimension + 1);
-
-					        // update current value to next value for this dimension's
-					        // parameters
-					        {
-						        for(auto& longPair : longDimensionParameters[dimension])
-						        {
-							        longPair.second.first +=  // add step value
-							            longPair.second.second.second;
-							        __GEN_COUT__ << "arg '" << longPair.first << "' current value: " << longPair.second.first << __E__;
-						        }  // end long loop
-
-						        for(auto& doublePair : doubleDimensionParameters[dimension])
-						        {
-							        doublePair.second.first +=  // add step value
-							            doublePair.second.second.second;
-
-							        __GEN_COUT__ << "arg '" << doublePair.first << "' current value: " << doublePair.second.first << __E__;
-						        }  // end double loop
-					        }      // end update current value to next value for all
-					           // dimensional parameters
-				        }
-				        __GEN_COUT__ << "Completed dimension[" << dimension << "] number of iterations := " << dimensionIterationCnt[dimension] << " of "
-				                     << dimensionIterations[dimension] << __E__;
-			        };  // end local lambda recursive function
-
-			    // launch multi-dimensional recursion
-			    localRecurse(0);
-
-			    // close output file
-			    if(outputFilePointer)
-				    fclose(outputFilePointer);
-		    }
-		    catch(const std::runtime_error& e)
-		    {
-			    __SS__ << "Error executing multi-dimensional FE Macro: " << e.what() << __E__;
-			    statusResult = ss.str();
-		    }
-		    catch(...)
-		    {
-			    __SS__ << "Unknown error executing multi-dimensional FE Macro. " << __E__;
-				try	{ throw; } //one more try to printout extra info
-				catch(const std::exception &e)
+		// make sure interface results are on disk before reporting done
+		try
+		{
+			scan->writeOutput("", true /*forceFlush*/);
+		}
+		catch(const std::runtime_error& e)
+		{
+			if(statusResult == "Done")
+				statusResult = e.what();
+		}
+
+		__GEN_COUTV__(statusResult);
+
+		{  // lock mutex scope
+			std::lock_guard<std::mutex> lock(feMgr->macroMultiDimensionalDoneMutex_);
+			scan->runningInterfaceIDs_.erase(interfaceID);
+
+			// change status at completion, or release the interface if the scan was erased (e.g. after an error on another interface)
+			auto scanIt = feMgr->macroMultiDimensionalScanMap_.find(interfaceID);
+			if(scanIt != feMgr->macroMultiDimensionalScanMap_.end() && scanIt->second == scan)
+			{
+				if(scan->aborted_)
 				{
-					ss << "Exception message: " << e.what();
+					feMgr->macroMultiDimensionalStatusMap_.erase(interfaceID);
+					feMgr->macroMultiDimensionalScanMap_.erase(scanIt);
 				}
-				catch(...){}
-			    statusResult = ss.str();
-		    }
-
-		    __COUTV__(statusResult);
-
-		    {  // lock mutex scope
-			    std::lock_guard<std::mutex> lock(feMgr->macroMultiDimensionalDoneMutex_);
-			    // change status at completion
-			    feMgr->macroMultiDimensionalStatusMap_[interfaceID] = statusResult;
-		    }
-	    },  // end thread()
-	    this,
-	    interfaceID,
-	    feMacroName,
-	    enableSavingOutput,
-	    outputFilePath,
-	    outputFileRadix,
-	    inputArgs)
-	    .detach();
-
-	__CFG_COUT__ << "Started multi-dimensional FE Macro '" << feMacroName << "' for interface '" << interfaceID << ".'" << __E__;
+				else
+					feMgr->macroMultiDimensionalStatusMap_[interfaceID] = statusResult;
+			}
+		}
+		feMgr->macroMultiDimensionalDoneCondition_.notify_all();
+	}  // end interface loop
 
-}  // end startFEMacroMultiDimensional()
+	__GEN_COUT__ << "Thread done." << __E__;
+}  // end macroMultiDimensionalScanThread()
+
+//==============================================================================
+// runMacroMultiDimensionalScan
+//	Runs the multi-dimensional loop of the scan Macro or FE Macro on one interface,
+//		writing one output row per execution.
+//	Dimensions are iterated like an odometer, the last dimension changing fastest,
+//		and each argument value is computed from its dimension index as
+//		initial value + index * step value.
+void FEVInterfacesManager::runMacroMultiDimensionalScan(FEVInterfacesManager* feMgr, macroMultiDimensionalScan_t& scan, const std::string& interfaceID)
+{
+	// create local message facility subject
+	std::string mfSubject_ = "multiD-" + interfaceID + "-" + scan.macroName_;
+	__GEN_COUT__ << "Launching " << scan.iterationsPerInterface_ << " iterations of '" << scan.macroName_ << "' ..." << __E__;
+
+	//-------------------------------
+	// check for interfaceID
+	FEVInterface* fe = feMgr->getFEInterfaceP(interfaceID);
+
+	//-------------------------------
+	// extract macro object
+	const FEVInterface::frontEndMacroStruct_t* feMacro = 0;
+	std::unique_ptr<FEVInterface::macroStruct_t> macro;
+
+	// instead of strict inputs and outputs for Macros, make a map
+	//	and populate with all input and output names
+	std::map<std::string /*name*/, uint64_t /*value*/> variableMap;
+	std::vector<FEVInterface::frontEndMacroArg_t>       argsIn;
+	std::vector<FEVInterface::frontEndMacroArg_t>       argsOut;
+
+	if(scan.isFEMacro_)
+	{
+		// have pointer to virtual FEInterface, find Macro structure
+		auto FEMacroIt = fe->getMapOfFEMacroFunctions().find(scan.macroName_);
+		if(FEMacroIt == fe->getMapOfFEMacroFunctions().end())
+		{
+			__GEN_SS__ << "FE Macro '" << scan.macroName_ << "' of interfaceID '" << interfaceID << "' was not found!" << __E__;
+			__GEN_SS_THROW__;
+		}
+		feMacro = &FEMacroIt->second;
+
+		for(unsigned int i = 0; i < feMacro->namesOfInputArguments_.size(); ++i)
+			argsIn.push_back(std::make_pair(  // do not care about input arg value
+			    feMacro->namesOfInputArguments_[i],
+			    ""));
+		for(unsigned int i = 0; i < feMacro->namesOfOutputArguments_.size(); ++i)
+			argsOut.push_back(std::make_pair(  // do not care about output arg value
+			    feMacro->namesOfOutputArguments_[i],
+			    ""));
+	}
+	else
+	{
+		macro.reset(new FEVInterface::macroStruct_t(scan.macroString_));
+
+		for(const auto& inputArgName : macro->namesOfInputArguments_)
+			variableMap.emplace(  // do not care about input arg value
+			    std::pair<std::string /*name*/, uint64_t /*value*/>(inputArgName, 0));
+		for(const auto& outputArgName : macro->namesOfOutputArguments_)
+			variableMap.emplace(  // do not care about output arg value
+			    std::pair<std::string /*name*/, uint64_t /*value*/>(outputArgName, 0));
+	}
+
+	const unsigned int         numOfDimensions = scan.dimensionIterations_.size();
+	std::vector<unsigned long> dimensionIterationCnt(numOfDimensions, 0);
+	std::string                rows;
+	const unsigned int         ROWS_PER_WRITE = 64;
+
+	for(unsigned long iteration = 0; iteration < scan.iterationsPerInterface_; ++iteration)
+	{
+		if(scan.aborted_)
+		{
+			__GEN_SS__ << "Multi-dimensional launch of '" << scan.macroName_ << "' was aborted after " << iteration << " iterations." << __E__;
+			__GEN_SS_THROW__;
+		}
+
+		// set arguments to current value
+		//	note: Although conflicts should not be allowed
+		//		at this point, lower dimensions will have priority
+		//		over higher dimension with same name argument..
+		//		and longs will have priority over doubles
+		if(scan.isFEMacro_)
+		{
+			for(auto& argIn : argsIn)
+			{
+				bool found = false;
+				for(unsigned int j = 0; !found && j < numOfDimensions; ++j)
+				{
+					auto longIt = scan.longDimensionParameters_[j].find(argIn.first);
+					if(longIt == scan.longDimensionParameters_[j].end())
+						continue;
+					argIn.second = std::to_string(longIt->second.first + (long)dimensionIterationCnt[j] * longIt->second.second);
+					found        = true;
+				}  // end long loop
+				for(unsigned int j = 0; !found && j < numOfDimensions; ++j)
+				{
+					auto doubleIt = scan.doubleDimensionParameters_[j].find(argIn.first);
+					if(doubleIt == scan.doubleDimensionParameters_[j].end())
+						continue;
+					argIn.second = std::to_string(doubleIt->second.first + dimensionIterationCnt[j] * doubleIt->second.second);
+					found        = true;
+				}  // end double loop
+				for(unsigned int j = 0; !found && j < numOfDimensions; ++j)
+				{
+					auto stringIt = scan.stringDimensionParameters_[j].find(argIn.first);
+					if(stringIt == scan.stringDimensionParameters_[j].end())
+						continue;
+					argIn.second = stringIt->second;
+					found        = true;
+				}  // end string loop
+
+				if(found)
+					continue;
+
+				__GEN_SS__ << "ArgIn '" << argIn.first << "' was not assigned a value "
+				           << "by any dimensional loop parameter sets. "
+				              "This is illegal. FEMacro '"
+				           << feMacro->feMacroName_ << "' requires '" << argIn.first
+				           << "' as an input argument. Either remove the "
+				              "input argument from this FEMacro, "
+				           << "or define a value as a dimensional loop "
+				              "parameter."
+				           << __E__;
+				__GEN_SS_THROW__;
+			}  // done building argsIn
+
+			// have pointer to Macro structure, so run it
+			(fe->*(feMacro->macroFunction_))(*feMacro, argsIn, argsOut);
+		}
+		else
+		{
+			for(unsigned int j = 0; j < numOfDimensions; ++j)
+				for(auto& longParam : scan.longDimensionParameters_[j])
+					variableMap.at(longParam.first) = longParam.second.first + (long)dimensionIterationCnt[j] * longParam.second.second;
+
+			// have FE and Macro structure, so run it
+			fe->runMacro(*macro, variableMap);
+		}
+
+		++scan.iterationsDone_;
+
+		// output row
+		{
+			std::stringstream outSS;
+			outSS << interfaceID << "\t" << iteration;
+			for(unsigned int j = 0; j < numOfDimensions; ++j)
+				outSS << "\t" << dimensionIterationCnt[j];
+			if(scan.isFEMacro_)
+			{
+				for(auto& argIn : argsIn)
+					outSS << "\t" << argIn.second;
+				for(auto& argOut : argsOut)
+					outSS << "\t" << argOut.second;
+			}
+			else
+			{
+				for(auto& argIn : macro->namesOfInputArguments_)
+					outSS << "\t" << variableMap.at(argIn);
+				for(auto& argOut : macro->namesOfOutputArguments_)
+					outSS << "\t" << variableMap.at(argOut);
+			}
+			outSS << __E__;
+
+			__GEN_COUT_TYPE__(TLVL_DEBUG + 5) << __COUT_HDR__ << outSS.str();
+			rows += outSS.str();
+			if((iteration + 1) % ROWS_PER_WRITE == 0)
+			{
+				scan.writeOutput(rows);
+				rows.clear();
+			}
+		}  // end output row
+
+		// advance dimension indices, last dimension fastest
+		for(unsigned int j = numOfDimensions; j-- > 0;)
+		{
+			if(++dimensionIterationCnt[j] < scan.dimensionIterations_[j])
+				break;
+			dimensionIterationCnt[j] = 0;
+		}
+	}  // end iteration loop
+
+	scan.writeOutput(rows);
+
+	__GEN_COUT__ << "Completed " << scan.iterationsPerInterface_ << " iterations of '" << scan.macroName_ << ".'" << __E__;
+}  // end runMacroMultiDimensionalScan()
+
+//==============================================================================
+// macroMultiDimensionalScan_t::writeOutput
+//	Appends rows to the scan output buffer and writes the buffer to file
+//		when large enough (or when forced). Called by all scan threads.
+void FEVInterfacesManager::macroMultiDimensionalScan_t::writeOutput(const std::string& rows, bool forceFlush)
+{
+	const size_t OUTPUT_BUFFER_SIZE = 1 << 20;  // 1MB
+
+	std::lock_guard<std::mutex> lock(outputMutex_);
+	if(!outputFilePointer_)
+		return;
+
+	outputBuffer_ += rows;
+	if(!forceFlush && outputBuffer_.size() < OUTPUT_BUFFER_SIZE)
+		return;
+
+	if(outputBuffer_.size() && fwrite(outputBuffer_.data(), 1, outputBuffer_.size(), outputFilePointer_) != outputBuffer_.size())
+	{
+		__SS__ << "Failed to write multi-dimensional scan output of '" << macroName_ << ".'" << __E__;
+		outputBuffer_.clear();
+		__SS_THROW__;
+	}
+	outputBuffer_.clear();
+	if(forceFlush)
+		fflush(outputFilePointer_);
+}  // end macroMultiDimensionalScan_t::writeOutput()
+
+//==============================================================================
+// macroMultiDimensionalScan_t::closeOutput
+//	Writes any buffered rows and closes the scan output file.
+//	Later writeOutput() calls are ignored.
+void FEVInterfacesManager::macroMultiDimensionalScan_t::closeOutput(void)
+{
+	std::lock_guard<std::mutex> lock(outputMutex_);
+	if(!outputFilePointer_)
+		return;
+
+	if(outputBuffer_.size())
+		fwrite(outputBuffer_.data(), 1, outputBuffer_.size(), outputFilePointer_);
+	outputBuffer_.clear();
+	fclose(outputFilePointer_);
+	outputFilePointer_ = 0;
+}  // end macroMultiDimensionalScan_t::closeOutput()
+
+//==============================================================================
+// eraseMacroMultiDimensionalScan
+//	Aborts the scan, so scan threads take no more interfaces and running threads
+//		stop at their next iteration, and closes the scan output file.
+//	Idle interfaces of the scan are released immediately, so the launch can be retried.
+//	Interfaces with a running thread are marked "Aborting" and are released
+//		by their thread when it stops, so a relaunch can not overlap them.
+//	Call with macroMultiDimensionalDoneMutex_ locked.
+void FEVInterfacesManager::eraseMacroMultiDimensionalScan(macroMultiDimensionalScan_t& scan)
+{
+	scan.aborted_            = true;
+	scan.nextInterfaceIndex_ = scan.interfaceIDs_.size();
+
+	for(const auto& interfaceID : scan.interfaceIDs_)
+	{
+		auto scanIt = macroMultiDimensionalScanMap_.find(interfaceID);
+		if(scanIt == macroMultiDimensionalScanMap_.end() || scanIt->second.get() != &scan)
+			continue;  // interface belongs to another launch
+
+		if(scan.runningInterfaceIDs_.find(interfaceID) != scan.runningInterfaceIDs_.end())
+		{
+			macroMultiDimensionalStatusMap_[interfaceID] = "Aborting";
+			continue;
+		}
+
+		macroMultiDimensionalStatusMap_.erase(interfaceID);
+		macroMultiDimensionalScanMap_.erase(scanIt);
+	}
+
+	scan.closeOutput();
+}  // end eraseMacroMultiDimensionalScan()
 
 //==============================================================================
 // checkFEMacroMultiDimensional
-//	Checks for the completion of the thread that manages the multi-dimensional loop
-//		running the FE Macro or MacroMaker Macro in the specified FE interface.
+//	Checks for the completion of the threads that manage the multi-dimensional loop
+//		running the FE Macro or MacroMaker Macro in the specified FE interfaces.
 //	Called by iterator (for now).
 //
-//	Returns true if multi-dimensional launch is done
-bool FEVInterfacesManager::checkMacroMultiDimensional(const std::string& interfaceID, const std::string& macroName)
+//	interfaceID can be one interface, or a comma-separated list of interfaces.
+//	If progress is given, it is filled with the aggregate iteration count of
+//		the scans of the interfaces.
+//	If waitTimeoutMs is given, the check waits up to that long for the launch
+//		of all interfaces to complete (or fail) before answering, so the caller
+//		learns of completion as soon as it happens instead of on its next poll.
+//
+//	Returns true if multi-dimensional launch is done for all interfaces
+bool FEVInterfacesManager::checkMacroMultiDimensional(const std::string& interfaceID,
+                                                      const std::string& macroName,
+                                                      std::string*       progress,
+                                                      unsigned int       waitTimeoutMs)
 {
-	// check active(only one FE Macro per interface active at any time, for now)
-	// lock mutex scope
-	std::lock_guard<std::mutex> lock(macroMultiDimensionalDoneMutex_);
-	// check status
-	auto statusIt = macroMultiDimensionalStatusMap_.find(interfaceID);
-	if(statusIt == macroMultiDimensionalStatusMap_.end())
+	std::vector<std::string> interfaceIDs;
+	StringMacros::getVectorFromString(interfaceID, interfaceIDs, {','} /*delimeter set*/);
+
+	if(std::set<std::string>(interfaceIDs.begin(), interfaceIDs.end()).size() != interfaceIDs.size())
 	{
-		__CFG_SS__ << "Status missing for multi-dimensional launch of Macro '" << macroName << "' for interface '" << interfaceID << ".'" << __E__;
+		__CFG_SS__ << "Duplicate target interfaces given to check multi-dimensional launch of Macro '" << macroName << "': " << interfaceID << __E__;
 		__CFG_SS_THROW__;
 	}
-	else if(statusIt->second == "Done")
+
+	// lock mutex scope
+	std::unique_lock<std::mutex> lock(macroMultiDimensionalDoneMutex_);
+
+	if(waitTimeoutMs)
+		macroMultiDimensionalDoneCondition_.wait_for(lock, std::chrono::milliseconds(waitTimeoutMs), [&]() {
+			for(const auto& scanInterfaceID : interfaceIDs)
+			{
+				auto statusIt = macroMultiDimensionalStatusMap_.find(scanInterfaceID);
+				if(statusIt != macroMultiDimensionalStatusMap_.end() && statusIt->second == "Active")
+					return false;
+			}
+			return true;
+		});
+
+	// check status
+	bool                                                    done = true;
+	std::set<std::shared_ptr<macroMultiDimensionalScan_t> > scans;
+	for(const auto& scanInterfaceID : interfaceIDs)
 	{
-		__CFG_COUT__ << "Completed multi-dimensional launch of Macro '" << macroName << "' for interface '" << interfaceID << ".'" << __E__;
+		auto statusIt = macroMultiDimensionalStatusMap_.find(scanInterfaceID);
+		auto scanIt   = macroMultiDimensionalScanMap_.find(scanInterfaceID);
+		if(statusIt == macroMultiDimensionalStatusMap_.end() ||
+		   (scanIt != macroMultiDimensionalScanMap_.end() && scanIt->second->macroName_ != macroName))  // interface busy with another Macro
+		{
+			__CFG_SS__ << "Status missing for multi-dimensional launch of Macro '" << macroName << "' for interface '" << scanInterfaceID << ".'" << __E__;
+			__CFG_SS_THROW__;
+		}
+		else if(statusIt->second == "Active")
+			done = false;
+		else if(statusIt->second != "Done")  // assume error
+		{
+			__CFG_SS__ << "Error occured during multi-dimensional launch of Macro '" << macroName << "' for interface '" << scanInterfaceID
+			           << "':" << statusIt->second << __E__;
+
+			// abort the scan and release its interfaces, so the launch can be retried
+			if(scanIt != macroMultiDimensionalScanMap_.end())
+			{
+				std::shared_ptr<macroMultiDimensionalScan_t> scan = scanIt->second;  // keep alive while erasing
+				eraseMacroMultiDimensionalScan(*scan);
+			}
+			else
+				macroMultiDimensionalStatusMap_.erase(statusIt);
+			__CFG_SS_THROW__;
+		}
 
-		// erase from map
-		macroMultiDimensionalStatusMap_.erase(statusIt);
-		return true;
+		if(scanIt != macroMultiDimensionalScanMap_.end())
+			scans.emplace(scanIt->second);
 	}
-	else if(statusIt->second == "Active")
+
+	if(progress)
+	{
+		unsigned long iterationsDone = 0, iterationsTotal = 0;
+		for(const auto& scan : scans)
+		{
+			iterationsDone += scan->iterationsDone_;
+			iterationsTotal += scan->iterationsPerInterface_ * scan->interfaceIDs_.size();
+		}
+		*progress = std::to_string(iterationsDone) + "/" + std::to_string(iterationsTotal) + " iterations of " + std::to_string(interfaceIDs.size()) +
+		            " interface(s)";
+	}
+
+	if(!done)
 	{
-		__CFG_COUT__ << "Still running multi-dimensional launch of Macro '" << macroName << "' for interface '" << interfaceID << ".'" << __E__;
+		__CFG_COUT__ << "Still running multi-dimensional launch of Macro '" << macroName << "' for interface(s) '" << interfaceID << ".'"
+		             << (progress ? (" Progress: " + *progress) : "") << __E__;
 		return false;
 	}
-	// else //assume error
 
-	__CFG_SS__ << "Error occured during multi-dimensional launch of Macro '" << macroName << "' for interface '" << interfaceID << "':" << statusIt->second
-	           << __E__;
-	__CFG_SS_THROW__;
+	__CFG_COUT__ << "Completed multi-dimensional launch of Macro '" << macroName << "' for interface(s) '" << interfaceID << ".'" << __E__;
 
+	// erase from map
+	for(const auto& scanInterfaceID : interfaceIDs)
+	{
+		macroMultiDimensionalStatusMap_.erase(scanInterfaceID);
+		macroMultiDimensionalScanMap_.erase(scanInterfaceID);
+	}
+	return true;
 }  // end checkMacroMultiDimensional()
 
 //==============================================================================
@@ -1,11 +1,16 @@
 #ifndef _ots_FEVInterfacesManager_h_
 #define _ots_FEVInterfacesManager_h_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
+#include <vector>
 #include "otsdaq/Configurable/Configurable.h"
 #include "otsdaq/FECore/FEVInterface.h"
 #include "otsdaq/FiniteStateMachine/VStateMachine.h"
@@ -39,6 +44,7 @@ class FEVInterfacesManager : public Configurable, public VStateMachine
 	                          char* returnValue);  // used by MacroMaker
 	void        universalWrite(const std::string& interfaceID, char* address,
 	                           char* writeValue);                   // used by MacroMaker
+	void        universalBulkAccess(std::vector<std::pair<std::string /*interfaceID*/, FEVInterface::universalAccess_t> >& accesses);  // used by MacroMaker
 	std::string getFEListString(const std::string& supervisorLid);  // used by MacroMaker
 	std::string getFEMacrosString(const std::string& supervisorName,
 	                              const std::string& supervisorLid);  // used by MacroMaker
@@ -75,7 +81,9 @@ class FEVInterfacesManager : public Configurable, public VStateMachine
 	                                       const std::string& outputFileRadix,
 	                                       const std::string& inputArgs);  // used by iterator calling (i.e. FESupervisor)
 	bool        checkMacroMultiDimensional(const std::string& interfaceID,
-	                                       const std::string& macroName);  // used by iterator calling (i.e. FESupervisor)
+	                                       const std::string& macroName,
+	                                       std::string*       progress      = 0,
+	                                       unsigned int       waitTimeoutMs = 0);  // used by iterator calling (i.e. FESupervisor)
 
 	unsigned int        getInterfaceUniversalAddressSize(const std::string& interfaceID);  // used by MacroMaker
 	unsigned int        getInterfaceUniversalDataSize(const std::string& interfaceID);     // used by MacroMaker
@@ -86,20 +94,75 @@ class FEVInterfacesManager : public Configurable, public VStateMachine
 	FEVInterface*                                                         getFEInterfaceP(const std::string& interfaceID);
 
 	// FE communication helpers
-	std::mutex frontEndCommunicationReceiveMutex_;
+	bool hasFEInterface(const std::string& interfaceID) const { return theFEInterfaces_.find(interfaceID) != theFEInterfaces_.end(); }
+	void deliverFrontEndCommunication(const std::string& targetInterfaceID,
+	                                  const std::string& requester,
+	                                  const std::string& value);  // used by FE calling (in-process) and FESupervisor (remote)
+
+	std::mutex              frontEndCommunicationReceiveMutex_;
+	std::condition_variable frontEndCommunicationReceiveCondition_;  // notified on every delivery, receivers wait on it
 	std::map<std::string /*targetInterfaceID*/,  // map of target to buffers organized by
 	                                             // source
 	         std::map<std::string /*requester*/, std::queue<std::string /*value*/> > >
 	    frontEndCommunicationReceiveBuffer_;
 
 	// multi-dimensional FE Macro helpers
-	std::mutex macroMultiDimensionalDoneMutex_;
+	//	A scan is one multi-dimensional launch of a Macro or FE Macro on one or more
+	//	interfaces. Interfaces are run concurrently by a bounded pool of threads,
+	//	and all results go to a single columnar output file per scan.
+	struct macroMultiDimensionalScan_t
+	{
+		macroMultiDimensionalScan_t(void)
+		    : isFEMacro_(false), nextInterfaceIndex_(0), aborted_(false), iterationsDone_(0), iterationsPerInterface_(1), outputFilePointer_(0)
+		{
+		}
+		~macroMultiDimensionalScan_t(void) { closeOutput(); }
+
+		void writeOutput(const std::string& rows, bool forceFlush = false);  // buffered, thread safe
+		void closeOutput(void);                                              // flushes and closes output file, thread safe
+
+		std::string              macroName_;
+		std::string              macroString_;  // empty for FE Macros
+		bool                     isFEMacro_;
+		std::vector<std::string> interfaceIDs_;
+		std::vector<std::string> inputArgNames_, outputArgNames_;
+
+		// by dimension
+		std::vector<unsigned long /*dimension iterations*/>                                          dimensionIterations_;
+		std::vector<std::map<std::string /*name*/, std::pair<long /*initial*/, long /*step*/> > >     longDimensionParameters_;
+		std::vector<std::map<std::string /*name*/, std::pair<double /*initial*/, double /*step*/> > > doubleDimensionParameters_;
+		std::vector<std::map<std::string /*name*/, std::string /*value*/> >                          stringDimensionParameters_;
+
+		std::atomic<size_t>        nextInterfaceIndex_;   // pool threads take interfaces in order
+		std::set<std::string>      runningInterfaceIDs_;  // interfaces with a running thread, guarded by macroMultiDimensionalDoneMutex_
+		std::atomic<bool>          aborted_;              // set when the scan is erased, running threads stop at their next iteration
+		std::atomic<unsigned long> iterationsDone_;       // for aggregate progress
+		unsigned long              iterationsPerInterface_;
+
+		std::mutex  outputMutex_;
+		FILE*       outputFilePointer_;
+		std::string outputBuffer_;
+	};  // end macroMultiDimensionalScan_t
+
+	std::mutex              macroMultiDimensionalDoneMutex_;
+	std::condition_variable macroMultiDimensionalDoneCondition_;  // notified on every status change, checkers may wait on it
 	std::map<std::string /*targetInterfaceID*/,  // set of active multi-dimensional Macro
-	                                             // launches
-	         std::string /*status := Active, Done, Error: <message> */>
+	                                             // launches, at most one per interface
+	         std::string /*status := Active, Aborting, Done, Error: <message> */>
 	    macroMultiDimensionalStatusMap_;
+	std::map<std::string /*targetInterfaceID*/, std::shared_ptr<macroMultiDimensionalScan_t> >
+	    macroMultiDimensionalScanMap_;  // for progress of active scans
 
   private:
+	void        startMacroMultiDimensionalScan(std::shared_ptr<macroMultiDimensionalScan_t> scan,
+	                                           const std::string&                           inputArgs,
+	                                           const bool                                   enableSavingOutput,
+	                                           const std::string&                           outputFilePath,
+	                                           const std::string&                           outputFileRadix);
+	void        eraseMacroMultiDimensionalScan(macroMultiDimensionalScan_t& scan);  // call with macroMultiDimensionalDoneMutex_ locked
+	static void macroMultiDimensionalScanThread(FEVInterfacesManager* feMgr, std::shared_ptr<macroMultiDimensionalScan_t> scan);
+	static void runMacroMultiDimensionalScan(FEVInterfacesManager* feMgr, macroMultiDimensionalScan_t& scan, const std::string& interfaceID);
+
 	std::map<std::string /*name*/, std::unique_ptr<FEVInterface> > theFEInterfaces_;
 	std::vector<std::string /*name*/>                              theFENamesByPriority_;
 
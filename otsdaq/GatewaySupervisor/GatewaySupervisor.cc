@@ -32,6 +32,7 @@
 #include <xoap/Method.h>
 
 #include <sys/stat.h>  // for mkdir
+#include <algorithm>   // std::remove_if
 #include <chrono>      // std::chrono::seconds
 #include <fstream>
 #include <thread>  // std::this_thread::sleep_for
@@ -49,7 +50,8 @@ using namespace ots;
 XDAQ_INSTANTIATOR_IMPL(GatewaySupervisor)
 
 WebUsers GatewaySupervisor::theWebUsers_ = WebUsers();
-std::vector<std::shared_ptr<GatewaySupervisor::BroadcastThreadStruct>> GatewaySupervisor::broadcastThreadStructs_;
+
+const size_t GatewaySupervisor::TRANSITION_PROFILE_HISTORY_SIZE = 20;
 
 //==============================================================================
 GatewaySupervisor::GatewaySupervisor(xdaq::ApplicationStub* s)
@@ -63,6 +65,7 @@ GatewaySupervisor::GatewaySupervisor(xdaq::ApplicationStub* s)
     , theIterator_(this)
     , broadcastCommandMessageIndex_(0)
     , broadcastIterationBreakpoint_(-1)  // for standard transitions, ignore the breakpoint
+    , broadcastPool_(std::make_shared<GatewaySupervisor::BroadcastPoolStruct>())
 {
 	INIT_MF("." /*directory used is USER_DATA/LOG/.*/);
 
@@ -126,6 +129,18 @@ GatewaySupervisor::GatewaySupervisor(xdaq::ApplicationStub* s)
 // entry is made when ots is killed
 GatewaySupervisor::~GatewaySupervisor(void)
 {
+	{  // exit broadcast threads
+		std::unique_lock<std::mutex> lock(broadcastPool_->mutex_);
+		broadcastPool_->exit_ = true;
+		broadcastPool_->workCondition_.notify_all();
+
+		// threads still waiting on a reply (e.g. from a hung supervisor) are left
+		//	to exit on their own, they only hold the shared pool
+		if(!broadcastPool_->doneCondition_.wait_for(
+		       lock, std::chrono::seconds(5), [this]() { return broadcastPool_->threadCount_ == 0; }))
+			__COUT_WARN__ << broadcastPool_->threadCount_ << " broadcast thread(s) still waiting on replies at shutdown." << __E__;
+	}
+
 	delete CorePropertySupervisorBase::theConfigurationManager_;
 	makeSystemLogEntry("ots shutdown.");
 }  // end destructor
@@ -160,6 +175,9 @@ void GatewaySupervisor::init(void)
 			__COUT__ << "State changes over UDP are disabled." << __E__;
 	}  // end setting up thread for UDP drive of state machine
 
+	// start state machine broadcast threads ahead of the first transition
+	startBroadcastThreads();
+
 	// setting up checking of App Status
 	{
 		bool checkAppStatus = false;
@@ -1273,7 +1291,17 @@ xoap::MessageReference GatewaySupervisor::stateMachineXoapHandler(xoap::MessageR
 {
 	__COUT__ << "Soap Handler!" << __E__;
 	stateMachineWorkLoopManager_.removeProcessedRequests();
-	stateMachineWorkLoopManager_.processRequest(message);
+	theIterator_.signalTransitionQueued();  // before the work loop can end it
+	try
+	{
+		if(stateMachineWorkLoopManager_.processRequest(message).getMatchingValue("RequestStatus") == "ERROR")
+			theIterator_.signalTransitionDone();  // never queued
+	}
+	catch(...)
+	{
+		theIterator_.signalTransitionDone();  // so the Iterator does not wait on it forever
+		throw;
+	}
 	__COUT__ << "Done - Soap Handler!" << __E__;
 	return message;
 }  // end stateMachineXoapHandler()
@@ -1291,11 +1319,23 @@ bool GatewaySupervisor::stateMachineThread(toolbox::task::WorkLoop* workLoop)
 
 	__COUT__ << "Propagating command '" << command << "'..." << __E__;
 
-	std::string reply = send(allSupervisorInfo_.getGatewayDescriptor(), stateMachineWorkLoopManager_.getMessage(workLoop));
+	std::string reply;
+	try
+	{
+		reply = send(allSupervisorInfo_.getGatewayDescriptor(), stateMachineWorkLoopManager_.getMessage(workLoop));
+	}
+	catch(...)
+	{
+		__COUT_ERR__ << "Failure to send Workloop transition command '" << command << "!'" << __E__;
+		stateMachineSemaphore_.give();
+		theIterator_.signalTransitionDone();  // the Iterator check then finds the FSM error
+		throw;
+	}
 	stateMachineWorkLoopManager_.report(workLoop, reply, 100, true);
 
 	__COUT__ << "Done with command '" << command << ".' Reply = " << reply << __E__;
 	stateMachineSemaphore_.give();
+	theIterator_.signalTransitionDone();  // transition is complete, so the Iterator can check its command now
 
 	if(reply == "Fault")
 	{
@@ -2898,70 +2938,144 @@ catch(...)
 	XCEPT_RAISE(toolbox::fsm::exception::Exception, ss.str());
 }
 
+//==============================================================================
+// startBroadcastThreads
+//	Makes sure the long-lived broadcast thread pool has NumberOfStateMachineBroadcastThreads
+//	idle threads. Threads stuck waiting on a reply (e.g. after a failed transition) do
+//	not count, so they are replaced rather than starving the next broadcast.
+//	When the number is reduced, the extra threads stay idle because each broadcast
+//	limits its own jobs in progress to the returned number.
+//	Returns the number of threads to use, 0 to broadcast from the calling thread.
+unsigned int GatewaySupervisor::startBroadcastThreads(void)
+{
+	unsigned int numberOfThreads = 1;
+
+	try
+	{
+		numberOfThreads = CorePropertySupervisorBase::getSupervisorTableNode().getNode("NumberOfStateMachineBroadcastThreads").getValue<unsigned int>();
+	}
+	catch(...)
+	{
+		// ignore error for backwards compatibility
+		__COUT__ << "Number of threads not in configuration, so defaulting to " << numberOfThreads << __E__;
+	}
+
+	// Note: if 1 thread, then create no threads
+	// i.e. only create threads if 2 or more.
+	if(numberOfThreads == 1)
+		numberOfThreads = 0;
+
+	std::lock_guard<std::mutex> lock(broadcastPool_->mutex_);
+	if(numberOfThreads && broadcastPool_->busyThreadCount_)
+		__COUT__ << broadcastPool_->busyThreadCount_ << " broadcast thread(s) still waiting on replies." << __E__;
+	while(broadcastPool_->threadCount_ - broadcastPool_->busyThreadCount_ < numberOfThreads)
+	{
+		std::thread(&GatewaySupervisor::broadcastMessageThread, this, broadcastPool_, broadcastPool_->nextThreadIndex_++).detach();
+		++broadcastPool_->threadCount_;
+	}
+
+	return numberOfThreads;
+}  // end startBroadcastThreads()
+
 //==============================================================================
 // broadcastMessageThread
-//	Sends transition command message and gets reply
-//		if failure, THROW
-void GatewaySupervisor::broadcastMessageThread(GatewaySupervisor* supervisorPtr, std::shared_ptr<GatewaySupervisor::BroadcastThreadStruct> threadStruct)
+//	Long-lived broadcast pool thread: takes transition command messages from the
+//		job queue, sends them and gets the reply.
+//	A failure is recorded in the job's broadcast context, and the broadcasting
+//		thread throws it.
+//	Only the shared pool and job are touched outside of the message handling, so
+//		the thread can outlive the supervisor.
+void GatewaySupervisor::broadcastMessageThread(GatewaySupervisor*                                      supervisorPtr,
+                                               std::shared_ptr<GatewaySupervisor::BroadcastPoolStruct> pool,
+                                               unsigned int                                            threadIndex)
 {
-	__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
+	__COUT__ << "Broadcast thread " << threadIndex << "\t"
 	         << "established..." << __E__;
 
-	while(!threadStruct->exitThread_)
+	while(1)
 	{
-		// sleep to give time to main thread to dole out work
-		usleep(1000 /* 1ms */);
+		std::shared_ptr<GatewaySupervisor::BroadcastJobStruct> job;
+		{  // wait for work
+			std::unique_lock<std::mutex> lock(pool->mutex_);
+			pool->workCondition_.wait(lock, [&pool]() {
+				return pool->exit_ ||
+				       (!pool->jobQueue_.empty() && pool->jobQueue_.front()->context_->jobsInProgress_ < pool->jobQueue_.front()->context_->maxJobsInProgress_);
+			});
+			if(pool->exit_)
+				break;
+
+			job = pool->jobQueue_.front();
+			pool->jobQueue_.pop_front();
+			++job->context_->jobsInProgress_;
+			++pool->busyThreadCount_;
+		}
+
+		__COUT__ << "Broadcast thread " << threadIndex << "\t"
+		         << "starting work... command = " << job->context_->command_ << __E__;
 
-		// take lock for remainder of scope
-		std::lock_guard<std::mutex> lock(threadStruct->threadMutex_);
-		if(threadStruct->workToDo_)
+		std::string                           reply;
+		bool                                  iterationDone = false, error = false;
+		std::chrono::steady_clock::time_point sendTime      = std::chrono::steady_clock::now();
+		try
+		{
+			iterationDone = supervisorPtr->handleBroadcastMessageTarget(job->appInfo_, job->message_, job->context_->command_, job->iteration_, reply, threadIndex);
+		}
+		catch(const toolbox::fsm::exception::Exception& e)
 		{
-			__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
-			         << "starting work... command = " << threadStruct->getCommand() << __E__;
+			__COUT__ << "Broadcast thread " << threadIndex << "\t"
+			         << "going into error: " << e.what() << __E__;
 
-			try
-			{
-				if(supervisorPtr->handleBroadcastMessageTarget(threadStruct->getAppInfo(),
-				                                               threadStruct->getMessage(),
-				                                               threadStruct->getCommand(),
-				                                               threadStruct->getIteration(),
-				                                               threadStruct->getReply(),
-				                                               threadStruct->threadIndex_))
-					threadStruct->getIterationsDone() = true;
-			}
-			catch(const toolbox::fsm::exception::Exception& e)
-			{
-				__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
-				         << "going into error: " << e.what() << __E__;
+			reply = e.what();
+			error = true;
+		}
+		catch(...)
+		{
+			__SS__ << "Unknown error sending command '" << job->context_->command_ << "' to Supervisor instance = '" << job->appInfo_.getName()
+			       << "' [LID=" << job->appInfo_.getId() << "]." << __E__;
+			__COUT_ERR__ << ss.str();
 
-				threadStruct->getReply() = e.what();
-				threadStruct->error_     = true;
-				threadStruct->workToDo_  = false;
-				threadStruct->working_   = false;  // indicate exiting
-				return;
-			}
+			reply = ss.str();
+			error = true;
+		}
 
-			if(!threadStruct->getIterationsDone())
+		if(!error && !iterationDone)
+			__COUT__ << "Broadcast thread " << threadIndex << "\t"
+			         << "flagged for another iteration." << __E__;
+
+		{  // report completion
+			std::lock_guard<std::mutex> lock(pool->mutex_);
+			--pool->busyThreadCount_;
+			--job->context_->jobsInProgress_;
+			job->reply_         = reply;
+			job->iterationDone_ = iterationDone;
+			job->error_         = error;
+			job->threadIndex_   = threadIndex;
+			job->sendTime_      = sendTime;
+			job->ackTime_       = std::chrono::steady_clock::now();
+			job->finished_      = true;
+			--job->context_->jobsPending_;
+			if(error && !job->context_->error_)
 			{
-				__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
-				         << "flagged for another iteration." << __E__;
-
-				// set global iterationsDone
-				std::lock_guard<std::mutex> lock(supervisorPtr->broadcastIterationsDoneMutex_);
-				supervisorPtr->broadcastIterationsDone_ = false;
+				job->context_->error_      = true;
+				job->context_->errorReply_ = reply;
 			}
+		}
+		// Note: a job held back by the in-progress limit is picked up by this thread
+		//	re-checking the queue before it waits again
+		pool->doneCondition_.notify_all();
 
-			__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
-			         << "done with work." << __E__;
-
-			threadStruct->workToDo_ = false;
-		}  // end work
-
+		__COUT__ << "Broadcast thread " << threadIndex << "\t"
+		         << "done with work." << __E__;
 	}  // end primary while loop
 
-	__COUT__ << "Broadcast thread " << threadStruct->threadIndex_ << "\t"
+	{  // report exit
+		std::lock_guard<std::mutex> lock(pool->mutex_);
+		--pool->threadCount_;
+	}
+	pool->doneCondition_.notify_all();
+
+	__COUT__ << "Broadcast thread " << threadIndex << "\t"
 	         << "exited." << __E__;
-	threadStruct->working_ = false;  // indicate exiting
 }  // end broadcastMessageThread()
 
 //==============================================================================
@@ -2985,7 +3099,6 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 
 	std::string reply;
 	broadcastIterationsDone_ = false;
-	bool assignedJob;
 
 	std::vector<std::vector<const SupervisorInfo*>> orderedSupervisors;
 
@@ -3028,42 +3141,17 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 
 	__COUT__ << "=========> Broadcasting state machine command = " << command << __E__;
 
-	unsigned int numberOfThreads = 1;
-
-	try
-	{
-		numberOfThreads = CorePropertySupervisorBase::getSupervisorTableNode().getNode("NumberOfStateMachineBroadcastThreads").getValue<unsigned int>();
-	}
-	catch(...)
-	{
-		// ignore error for backwards compatibility
-		__COUT__ << "Number of threads not in configuration, so defaulting to " << numberOfThreads << __E__;
-	}
-
-	// Note: if 1 thread, then create no threads
-	// i.e. only create threads if 2 or more.
-	if(numberOfThreads == 1)
-		numberOfThreads = 0;
-
+	// the pool threads are normally already running (from init), this picks up configuration changes
+	//	if 1 thread, just use main thread
+	unsigned int numberOfThreads = startBroadcastThreads();
 	__COUTV__(numberOfThreads);
 
-	// std::vector<GatewaySupervisor::BroadcastThreadStruct> broadcastThreadStructs_(numberOfThreads);
-	broadcastThreadStructs_.clear();
+	std::shared_ptr<GatewaySupervisor::BroadcastContextStruct> context = std::make_shared<GatewaySupervisor::BroadcastContextStruct>(command, numberOfThreads);
 
-	// only launch threads if more than 1
-	//	if 1, just use main thread
-	for(unsigned int i = 0; i < numberOfThreads; ++i)
-	{
-		broadcastThreadStructs_.push_back(std::make_shared<GatewaySupervisor::BroadcastThreadStruct>());
-		broadcastThreadStructs_[i]->threadIndex_ = i;
-
-		std::thread([](GatewaySupervisor*                        supervisorPtr,
-		               std::shared_ptr<GatewaySupervisor::BroadcastThreadStruct> threadStruct) { 
-						GatewaySupervisor::broadcastMessageThread(supervisorPtr, threadStruct); },
-		            this,
-		            broadcastThreadStructs_[i])
-		    .detach();
-	}  // end broadcast thread creation loop
+	GatewaySupervisor::TransitionProfileStruct transitionProfile;
+	transitionProfile.command_         = command;
+	transitionProfile.startTime_       = time(0);
+	transitionProfile.startSteadyTime_ = std::chrono::steady_clock::now();
 
 	RunControlStateMachine::theProgressBar_.step();
 
@@ -3095,6 +3183,8 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 
 			for(unsigned int i = 0; i < supervisorIterationsDone.size(); ++i)
 			{
+				std::vector<std::pair<unsigned int /*j*/, std::shared_ptr<GatewaySupervisor::BroadcastJobStruct>>> levelJobs;
+
 				for(unsigned int j = 0; j < supervisorIterationsDone.size(i); ++j)
 				{
 					checkForAsyncError();
@@ -3118,36 +3208,32 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 
 					if(numberOfThreads)
 					{
-						// schedule message to first open thread
-						assignedJob = false;
-						do
+						// hand message to the pool
+						levelJobs.push_back(std::make_pair(j, std::make_shared<GatewaySupervisor::BroadcastJobStruct>(context, appInfo, message, iteration, i)));
 						{
-							for(unsigned int k = 0; k < numberOfThreads; ++k)
-							{
-								if(!broadcastThreadStructs_[k]->workToDo_)
-								{
-									// found our thread!
-									assignedJob = true;
-									__COUT__ << "Giving work to thread " << k << ", command = " << command << __E__;
-
-									std::lock_guard<std::mutex> lock(broadcastThreadStructs_[k]->threadMutex_);
-									broadcastThreadStructs_[k]->setMessage(appInfo, message, command, iteration, supervisorIterationsDone[i][j]);
-
-									break;
-								}
-							}  // end thread assigning search
-
-							if(!assignedJob)
-							{
-								__COUT__ << "No free broadcast threads, "
-								         << "waiting for an available thread..." << __E__;
-								usleep(100 * 1000 /*100 ms*/);
-							}
-						} while(!assignedJob);
+							std::lock_guard<std::mutex> lock(broadcastPool_->mutex_);
+							++context->jobsPending_;
+							broadcastPool_->jobQueue_.push_back(levelJobs.back().second);
+						}
+						// wake all, an idle thread beyond the in-progress limit could otherwise swallow the wakeup
+						broadcastPool_->workCondition_.notify_all();
 					}
 					else  // no thread
 					{
-						if(handleBroadcastMessageTarget(appInfo, message, command, iteration, reply))
+						std::chrono::steady_clock::time_point sendTime = std::chrono::steady_clock::now();
+						bool                                  iterationDone = false;
+						try
+						{
+							iterationDone = handleBroadcastMessageTarget(appInfo, message, command, iteration, reply);
+						}
+						catch(...)
+						{
+							addTransitionProfileEntry(transitionProfile, appInfo, i, iteration, 0, sendTime, std::chrono::steady_clock::now(), true /*error*/);
+							throw;
+						}
+						addTransitionProfileEntry(transitionProfile, appInfo, i, iteration, 0, sendTime, std::chrono::steady_clock::now(), false /*error*/);
+
+						if(iterationDone)
 							supervisorIterationsDone[i][j] = true;
 						else
 							broadcastIterationsDone_ = false;
@@ -3156,54 +3242,63 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 				}  // end supervisors at same priority broadcast loop
 
 				// before proceeding to next priority,
-				//	make sure all threads have completed
-				if(numberOfThreads)
+				//	wait for all messages of this priority to complete
+				if(levelJobs.size())
 				{
 					__COUT__ << "Done with priority level. Waiting for threads to finish..." << __E__;
-					bool done;
-					do
+
+					std::unique_lock<std::mutex> lock(broadcastPool_->mutex_);
+					while(context->jobsPending_ && !context->error_)
 					{
-						done                              = true;
-						unsigned int numOfThreadsWithWork = 0;
-						unsigned int lastUnfinishedThread = -1;
+						std::stringstream waitSs;
+						waitSs << "Waiting on " << context->jobsPending_ << " of " << levelJobs.size() << " transitions to finish. Command = " << command;
+						if(command == RunControlStateMachine::CONFIGURE_TRANSITION_NAME)
+							waitSs << " w/" + RunControlStateMachine::getLastAttemptedConfigureGroup();
+						if(context->jobsPending_ == 1)
+							for(const auto& levelJob : levelJobs)
+								if(!levelJob.second->finished_)
+								{
+									waitSs << ".. " << levelJob.second->appInfo_.getName() << ":" << levelJob.second->appInfo_.getId();
+									break;
+								}
+						waitSs << __E__;
+						__COUT__ << waitSs.str();
 
-						for(unsigned int i = 0; i < numberOfThreads; ++i)
-							if(broadcastThreadStructs_[i]->workToDo_)
-							{
-								done = false;
-								++numOfThreadsWithWork;
-								lastUnfinishedThread = i;
-							}
-							else if(broadcastThreadStructs_[i]->error_)
-							{
-								__COUT__ << "Found thread in error! Throwing state "
-								            "machine error: "
-								         << broadcastThreadStructs_[i]->getReply() << __E__;
-								XCEPT_RAISE(toolbox::fsm::exception::Exception, broadcastThreadStructs_[i]->getReply());
-							}
+						{  // create lock scope for status update
+							std::lock_guard<std::mutex> statusLock(broadcastCommandStatusUpdateMutex_);
+							broadcastCommandStatus_ = waitSs.str();
+						}
 
-						if(!done)  // update status and sleep
-						{
-							std::stringstream waitSs;
-							waitSs << "Waiting on " << numOfThreadsWithWork << " of " << numberOfThreads << " threads to finish. Command = " << command;
-							if(command == RunControlStateMachine::CONFIGURE_TRANSITION_NAME)
-								waitSs << " w/" + RunControlStateMachine::getLastAttemptedConfigureGroup();
-							if(numOfThreadsWithWork == 1)
-							{
-								waitSs << ".. " << broadcastThreadStructs_[lastUnfinishedThread]->getAppInfo().getName() << ":"
-								       << broadcastThreadStructs_[lastUnfinishedThread]->getAppInfo().getId();
-							}
-							waitSs << __E__;
-							__COUT__ << waitSs.str();
+						// wake on the next completion (or error)
+						const unsigned int jobsPending = context->jobsPending_;
+						broadcastPool_->doneCondition_.wait(lock, [&context, jobsPending]() { return context->jobsPending_ != jobsPending || context->error_; });
+					}
 
-							{  // create lock scope that does not include sleep
-								std::lock_guard<std::mutex> lock(broadcastCommandStatusUpdateMutex_);
-								broadcastCommandStatus_ = waitSs.str();
-							}
-							usleep(100 * 1000 /*100ms*/);
-						}
+					for(const auto& levelJob : levelJobs)
+						if(levelJob.second->finished_)
+							addTransitionProfileEntry(transitionProfile,
+							                          levelJob.second->appInfo_,
+							                          levelJob.second->priorityLevel_,
+							                          levelJob.second->iteration_,
+							                          levelJob.second->threadIndex_,
+							                          levelJob.second->sendTime_,
+							                          levelJob.second->ackTime_,
+							                          levelJob.second->error_);
+
+					if(context->error_)
+					{
+						__COUT__ << "Found thread in error! Throwing state "
+						            "machine error: "
+						         << context->errorReply_ << __E__;
+						XCEPT_RAISE(toolbox::fsm::exception::Exception, context->errorReply_);
+					}
+
+					for(const auto& levelJob : levelJobs)
+						if(levelJob.second->iterationDone_)
+							supervisorIterationsDone[i][levelJob.first] = true;
+						else
+							broadcastIterationsDone_ = false;  // flagged for another iteration
 
-					} while(!done);
 					__COUT__ << "All threads done with priority level work." << __E__;
 				}  // end thread complete verification
 
@@ -3225,38 +3320,157 @@ void GatewaySupervisor::broadcastMessage(xoap::MessageReference message)
 	}  // end main transition broadcast try
 	catch(...)
 	{
-		__COUT__ << "Exception caught, exiting broadcast threads..." << __E__;
+		saveTransitionProfile(transitionProfile, true /*failed*/);
 
-		// attempt to exit threads
-		//	The threads should already be done with all work.
-		//	If broadcastMessage scope ends, then the
-		//	thread struct will be destructed, and the thread will
-		//	crash on next access attempt (though we probably do not care).
-		for(unsigned int i = 0; i < numberOfThreads; ++i)
-			broadcastThreadStructs_[i]->exitThread_ = true;
-		usleep(100 * 1000 /*100ms*/);  // sleep for exit time
+		if(numberOfThreads)
+		{
+			__COUT__ << "Exception caught, dropping queued broadcast work..." << __E__;
+
+			// messages in progress complete on their own, and only report to this broadcast's context
+			std::lock_guard<std::mutex> lock(broadcastPool_->mutex_);
+			broadcastPool_->jobQueue_.erase(std::remove_if(broadcastPool_->jobQueue_.begin(),
+			                                               broadcastPool_->jobQueue_.end(),
+			                                               [&context](const std::shared_ptr<GatewaySupervisor::BroadcastJobStruct>& job) { return job->context_ == context; }),
+			                                broadcastPool_->jobQueue_.end());
+		}
 
 		throw;  // re-throw
 	}
 
-	if(numberOfThreads)
-	{
-		__COUT__ << "All transitions completed. Wrapping up, exiting broadcast threads..." << __E__;
-
-		// attempt to exit threads
-		//	The threads should already be done with all work.
-		//	If broadcastMessage scope ends, then the
-		//	thread struct will be destructed, and the thread will
-		//	crash on next access attempt (when the thread crashes, the whole context
-		// crashes).
-		for(unsigned int i = 0; i < numberOfThreads; ++i)
-			broadcastThreadStructs_[i]->exitThread_ = true;
-		usleep(100 * 1000 /*100ms*/);  // sleep for exit time
-	}
+	saveTransitionProfile(transitionProfile, false /*failed*/);
 
 	__COUT__ << "Broadcast complete." << __E__;
 }  // end broadcastMessage()
 
+//==============================================================================
+void GatewaySupervisor::addTransitionProfileEntry(TransitionProfileStruct&              profile,
+                                                  const SupervisorInfo&                 appInfo,
+                                                  unsigned int                          priorityLevel,
+                                                  unsigned int                          iteration,
+                                                  unsigned int                          threadIndex,
+                                                  std::chrono::steady_clock::time_point sendTime,
+                                                  std::chrono::steady_clock::time_point ackTime,
+                                                  bool                                  error)
+{
+	GatewaySupervisor::TransitionProfileEntryStruct entry;
+	entry.appName_       = appInfo.getName();
+	entry.appId_         = appInfo.getId();
+	entry.priorityLevel_ = priorityLevel;
+	entry.iteration_     = iteration;
+	entry.threadIndex_   = threadIndex;
+	entry.sendMs_        = std::chrono::duration<double, std::milli>(sendTime - profile.startSteadyTime_).count();
+	entry.ackMs_         = std::chrono::duration<double, std::milli>(ackTime - profile.startSteadyTime_).count();
+	entry.error_         = error;
+	profile.entries_.push_back(entry);
+}  // end addTransitionProfileEntry()
+
+//==============================================================================
+// saveTransitionProfile
+//	Adds the profile of a completed (or failed) broadcast to the rolling history
+//		and prints the slowest application.
+void GatewaySupervisor::saveTransitionProfile(TransitionProfileStruct& profile, bool failed)
+{
+	profile.durationMs_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - profile.startSteadyTime_).count();
+	profile.failed_     = failed;
+
+	const GatewaySupervisor::TransitionProfileEntryStruct* slowest = 0;
+	for(const auto& entry : profile.entries_)
+		if(!slowest || entry.ackMs_ - entry.sendMs_ > slowest->ackMs_ - slowest->sendMs_)
+			slowest = &entry;
+	if(slowest)
+		__COUT__ << "Transition '" << profile.command_ << "' " << (failed ? "failed after " : "took ") << profile.durationMs_ / 1000. << " s for "
+		         << profile.entries_.size() << " message(s). Slowest was Supervisor " << slowest->appName_ << " [LID=" << slowest->appId_ << "] at priority level "
+		         << slowest->priorityLevel_ << " with " << (slowest->ackMs_ - slowest->sendMs_) / 1000. << " s." << __E__;
+
+	std::lock_guard<std::mutex> lock(transitionProfileMutex_);
+	transitionProfileHistory_.push_back(profile);
+	if(transitionProfileHistory_.size() > TRANSITION_PROFILE_HISTORY_SIZE)
+		transitionProfileHistory_.pop_front();
+}  // end saveTransitionProfile()
+
+//==============================================================================
+// getTransitionProfile
+//	Critical-path summary of every transition in the history (most recent first),
+//		and the per application send/acknowledge times of the transition at
+//		transitionIndex (0 is most recent).
+//
+//	Priority levels (and iterations) are transitioned one after the other, so the
+//		critical path is each level's span from first send to last acknowledge,
+//		which is set by the slowest application of the level.
+void GatewaySupervisor::getTransitionProfile(HttpXmlDocument& xmlOut, unsigned int transitionIndex)
+{
+	std::lock_guard<std::mutex> lock(transitionProfileMutex_);
+
+	char tmp[100];
+	for(unsigned int t = 0; t < transitionProfileHistory_.size(); ++t)
+	{
+		const GatewaySupervisor::TransitionProfileStruct& profile = transitionProfileHistory_[transitionProfileHistory_.size() - 1 - t];
+
+		auto transitionElement = xmlOut.addTextElementToData("transition", std::to_string(t));
+		xmlOut.addTextElementToParent("transition_command", profile.command_, transitionElement);
+		xmlOut.addTextElementToParent("transition_start_time", StringMacros::getTimestampString(profile.startTime_), transitionElement);
+		sprintf(tmp, "%.1f", profile.durationMs_);
+		xmlOut.addTextElementToParent("transition_duration_ms", tmp, transitionElement);
+		xmlOut.addTextElementToParent("transition_result", profile.failed_ ? "Failed" : "Done", transitionElement);
+
+		// critical path, in transition order
+		struct LevelSpan
+		{
+			double                                                 firstSendMs_, lastAckMs_;
+			unsigned int                                           messages_;
+			const GatewaySupervisor::TransitionProfileEntryStruct* slowest_;
+		};
+		std::map<std::pair<unsigned int /*iteration*/, unsigned int /*priority level*/>, LevelSpan> levelSpans;
+		for(const auto& entry : profile.entries_)
+		{
+			auto levelIt = levelSpans.find(std::make_pair(entry.iteration_, entry.priorityLevel_));
+			if(levelIt == levelSpans.end())
+				levelSpans.emplace(std::make_pair(entry.iteration_, entry.priorityLevel_), LevelSpan({entry.sendMs_, entry.ackMs_, 1, &entry}));
+			else
+			{
+				LevelSpan& span   = levelIt->second;
+				span.firstSendMs_ = std::min(span.firstSendMs_, entry.sendMs_);
+				span.lastAckMs_   = std::max(span.lastAckMs_, entry.ackMs_);
+				++span.messages_;
+				if(entry.ackMs_ - entry.sendMs_ > span.slowest_->ackMs_ - span.slowest_->sendMs_)
+					span.slowest_ = &entry;
+			}
+		}
+
+		for(const auto& levelSpan : levelSpans)
+		{
+			auto levelElement = xmlOut.addTextElementToParent("critical_path_step", "", transitionElement);
+			xmlOut.addTextElementToParent("iteration", std::to_string(levelSpan.first.first), levelElement);
+			xmlOut.addTextElementToParent("priority_level", std::to_string(levelSpan.first.second), levelElement);
+			xmlOut.addTextElementToParent("messages", std::to_string(levelSpan.second.messages_), levelElement);
+			sprintf(tmp, "%.1f", levelSpan.second.lastAckMs_ - levelSpan.second.firstSendMs_);
+			xmlOut.addTextElementToParent("duration_ms", tmp, levelElement);
+			xmlOut.addTextElementToParent(
+			    "slowest_app", levelSpan.second.slowest_->appName_ + ":" + std::to_string(levelSpan.second.slowest_->appId_), levelElement);
+			sprintf(tmp, "%.1f", levelSpan.second.slowest_->ackMs_ - levelSpan.second.slowest_->sendMs_);
+			xmlOut.addTextElementToParent("slowest_app_ms", tmp, levelElement);
+		}
+
+		if(t != transitionIndex)
+			continue;
+
+		// per application detail of selected transition
+		for(const auto& entry : profile.entries_)
+		{
+			auto appElement = xmlOut.addTextElementToParent("app", entry.appName_, transitionElement);
+			xmlOut.addTextElementToParent("app_id", std::to_string(entry.appId_), appElement);
+			xmlOut.addTextElementToParent("priority_level", std::to_string(entry.priorityLevel_), appElement);
+			xmlOut.addTextElementToParent("iteration", std::to_string(entry.iteration_), appElement);
+			xmlOut.addTextElementToParent("thread", std::to_string(entry.threadIndex_), appElement);
+			sprintf(tmp, "%.1f", entry.sendMs_);
+			xmlOut.addTextElementToParent("send_ms", tmp, appElement);
+			sprintf(tmp, "%.1f", entry.ackMs_);
+			xmlOut.addTextElementToParent("ack_ms", tmp, appElement);
+			xmlOut.addTextElementToParent("error", entry.error_ ? "1" : "0", appElement);
+		}
+	}
+}  // end getTransitionProfile()
+
 //==============================================================================
 // LoginRequest
 //  handles all users login/logout actions from web GUI.
@@ -3645,6 +3859,7 @@ void GatewaySupervisor::request(xgi::Input* in, xgi::Output* out)
 	// getCurrentState
 	// cancelStateMachineTransition
 	// getIterationPlanStatus
+	// getStateMachineTransitionProfile
 	// getErrorInStateMatchine
 
 	// getDesktopIcons
@@ -4130,6 +4345,11 @@ void GatewaySupervisor::request(xgi::Input* in, xgi::Output* out)
 			//__COUT__ << "checking it status" << __E__;
 			theIterator_.handleCommandRequest(xmlOut, requestType, "");
 		}
+		else if(requestType == "getStateMachineTransitionProfile")
+		{
+			unsigned int transitionIndex = CgiDataUtilities::getDataAsInt(cgiIn, "transitionIndex");  // 0 is most recent
+			getTransitionProfile(xmlOut, transitionIndex);
+		}
 		else if(requestType == "getCurrentState")
 		{
 			xmlOut.addTextElementToData("current_state", theStateMachine_.getCurrentStateName());
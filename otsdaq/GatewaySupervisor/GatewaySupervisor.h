@@ -25,9 +25,15 @@
 #include <xdata/String.h>
 #include <xgi/Method.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 
 // defines used also by OtsConfigurationWizardSupervisor
 #define FSM_LAST_CONFIGURED_GROUP_ALIAS_FILE std::string("FSMLastConfiguredGroupAlias.hist")
@@ -182,85 +188,122 @@ class WorkLoopManager;
 			std::vector<unsigned int> arraySizes_;
 		};  // end BroadcastMessageIterationsDoneStruct definition
 
-		struct BroadcastThreadStruct
+		// one broadcast of a transition command, shared with the broadcast pool threads
+		//	so that a late reply to an earlier broadcast can never touch the current one
+		struct BroadcastContextStruct
 		{
-			//===================
-			BroadcastThreadStruct()
-				: threadIndex_(-1)
-				, exitThread_(false)
-				, working_(true)
-				, workToDo_(false)
+			BroadcastContextStruct(const std::string& command, unsigned int maxJobsInProgress)
+				: command_(command)
+				, maxJobsInProgress_(maxJobsInProgress)
+				, jobsPending_(0)
+				, jobsInProgress_(0)
 				, error_(false)
 			{
-			}  // end BroadcastThreadStruct constructor()
-
-			//===================
-			BroadcastThreadStruct(BroadcastThreadStruct &&b)
-				: threadIndex_(b.threadIndex_)
-				, exitThread_(b.exitThread_)
-				, working_(b.working_)
-				, workToDo_(b.workToDo_)
-				, error_(b.error_)
-			{
-			}  // end BroadcastThreadStruct move constructor()
-
+			}
 
-			struct BroadcastMessageStruct
-			{
-				//===================
-				BroadcastMessageStruct(const SupervisorInfo& appInfo,
-					xoap::MessageReference message,
-					const std::string& command,
-					const unsigned int& iteration,
-					bool& iterationsDone)
-					: appInfo_(appInfo)
-					, message_(message)
-					, command_(command)
-					, iteration_(iteration)
-					, iterationsDone_(iterationsDone)
-				{
-				}
-
-				const SupervisorInfo& appInfo_;
-				xoap::MessageReference message_;
-				const std::string command_;
-				const unsigned int iteration_;
-				bool& iterationsDone_;
-
-				std::string reply_;
-			};  // end BroadcastMessageStruct definition
-
-			//===================
-			void setMessage(const SupervisorInfo& appInfo,
+			const std::string 	command_;
+			const unsigned int 	maxJobsInProgress_;  // NumberOfStateMachineBroadcastThreads at start of broadcast
+			// access with BroadcastPoolStruct::mutex_
+			unsigned int 		jobsPending_;  // queued or in progress
+			unsigned int 		jobsInProgress_;
+			bool 				error_;
+			std::string 		errorReply_;  // of first error
+		};  // end BroadcastContextStruct definition
+
+		// one transition command message to one supervisor
+		struct BroadcastJobStruct
+		{
+			BroadcastJobStruct(std::shared_ptr<BroadcastContextStruct> context,
+				const SupervisorInfo& appInfo,
 				xoap::MessageReference message,
-				const std::string& command,
-				const unsigned int& iteration,
-				bool& iterationsDone)
+				unsigned int iteration,
+				unsigned int priorityLevel)
+				: context_(context)
+				, appInfo_(appInfo)
+				, message_(message)
+				, iteration_(iteration)
+				, priorityLevel_(priorityLevel)
+				, iterationDone_(false)
+				, finished_(false)
+				, error_(false)
+				, threadIndex_(0)
+			{
+			}
+
+			std::shared_ptr<BroadcastContextStruct> context_;
+			const SupervisorInfo& 	appInfo_;
+			xoap::MessageReference 	message_;
+			const unsigned int 		iteration_, priorityLevel_;
+			// access with BroadcastPoolStruct::mutex_
+			std::string 			reply_;
+			bool 					iterationDone_, finished_, error_;
+			unsigned int 			threadIndex_;
+			std::chrono::steady_clock::time_point sendTime_, ackTime_;  // for transition profile
+		};  // end BroadcastJobStruct definition
+
+		// transition timing profile: send and acknowledge time of every message
+		//	of a broadcast, by application, priority level and iteration
+		struct TransitionProfileEntryStruct
+		{
+			std::string 	appName_;
+			unsigned int 	appId_;
+			unsigned int 	priorityLevel_;  // 0 is first level transitioned
+			unsigned int 	iteration_;
+			unsigned int 	threadIndex_;
+			double 			sendMs_, ackMs_;  // since start of broadcast
+			bool 			error_;
+		};  // end TransitionProfileEntryStruct definition
+
+		struct TransitionProfileStruct
+		{
+			std::string 	command_;
+			time_t 			startTime_;
+			std::chrono::steady_clock::time_point startSteadyTime_;
+			double 			durationMs_;
+			bool 			failed_;
+			std::vector<TransitionProfileEntryStruct> entries_;
+		};  // end TransitionProfileStruct definition
+
+		static const size_t TRANSITION_PROFILE_HISTORY_SIZE;
+
+		void addTransitionProfileEntry(TransitionProfileStruct& profile,
+			const SupervisorInfo& appInfo,
+			unsigned int priorityLevel,
+			unsigned int iteration,
+			unsigned int threadIndex,
+			std::chrono::steady_clock::time_point sendTime,
+			std::chrono::steady_clock::time_point ackTime,
+			bool error);
+		void saveTransitionProfile(TransitionProfileStruct& profile, bool failed);
+		void getTransitionProfile(HttpXmlDocument& xmlOut, unsigned int transitionIndex);
+
+		// long-lived broadcast thread pool, shared with the pool threads so that a thread
+		//	still waiting on a reply never touches a destroyed mutex or queue
+		struct BroadcastPoolStruct
+		{
+			BroadcastPoolStruct()
+				: threadCount_(0)
+				, busyThreadCount_(0)
+				, nextThreadIndex_(0)
+				, exit_(false)
 			{
-				messages_.clear();
-				messages_.push_back(BroadcastThreadStruct::BroadcastMessageStruct(
-					appInfo, message, command, iteration, iterationsDone));
-				workToDo_ = true;
-			}  // end setMessage()
-
-			const SupervisorInfo& getAppInfo() { return messages_[0].appInfo_; }
-			xoap::MessageReference getMessage() { return messages_[0].message_; }
-			const std::string& getCommand() { return messages_[0].command_; }
-			const unsigned int& getIteration() { return messages_[0].iteration_; }
-			std::string& getReply() { return messages_[0].reply_; }
-			bool& getIterationsDone() { return messages_[0].iterationsDone_; }
-
-			// each thread accesses these members
-			std::mutex    threadMutex_;
-			unsigned int  threadIndex_;
-			volatile bool exitThread_, working_, workToDo_, error_;
-			// always just 1 message (for now)
-			std::vector<BroadcastThreadStruct::BroadcastMessageStruct> messages_;
-
-		};  // end BroadcastThreadStruct declaration
+			}
+
+			std::mutex 				mutex_;
+			std::condition_variable workCondition_;  // pool threads wait for jobs
+			std::condition_variable doneCondition_;  // broadcastMessage() waits for job completion, destructor for thread exit
+			std::deque<std::shared_ptr<BroadcastJobStruct>> jobQueue_;
+			unsigned int 			threadCount_;      // running threads
+			unsigned int 			busyThreadCount_;  // threads waiting on a reply
+			unsigned int 			nextThreadIndex_;
+			bool 					exit_;
+		};  // end BroadcastPoolStruct definition
+
+		unsigned int startBroadcastThreads(void);
 		static void broadcastMessageThread(
 			GatewaySupervisor* supervisorPtr,
-			std::shared_ptr<GatewaySupervisor::BroadcastThreadStruct> threadStruct);
+			std::shared_ptr<BroadcastPoolStruct> pool,
+			unsigned int threadIndex);
 		bool handleBroadcastMessageTarget(const SupervisorInfo& appInfo,
 			xoap::MessageReference message,
 			const std::string& command,
@@ -309,7 +352,12 @@ class WorkLoopManager;
 													 // matches breakpoint index
 		std::mutex			broadcastCommandStatusUpdateMutex_;
 		std::string			broadcastCommandStatus_;
-		static std::vector<std::shared_ptr<GatewaySupervisor::BroadcastThreadStruct>> broadcastThreadStructs_; //moving to static, instead of a local instance inside broadcastMessage() seems to avoid crashing when multiple error stack up and threads get stuck waiting for app replies
+
+		// work is handed over to the broadcast thread pool through the job queue
+		std::shared_ptr<BroadcastPoolStruct> broadcastPool_;
+
+		std::mutex			transitionProfileMutex_;
+		std::deque<TransitionProfileStruct> transitionProfileHistory_;  // most recent last
 
 		// temporary member variable to avoid redeclaration in repetitive functions
 		char 				tmpStringForConversions_[100];
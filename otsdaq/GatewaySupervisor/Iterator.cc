@@ -18,6 +18,8 @@ using namespace ots;
 	((getenv("SERVICE_DATA_PATH") == NULL) ? (std::string(__ENV__("USER_DATA")) + "/ServiceData") : (std::string(__ENV__("SERVICE_DATA_PATH")))) + \
 	    "/IteratorPlanHistory.hist"
 
+const size_t Iterator::STEP_TIMING_HISTORY_SIZE = 20;
+
 //==============================================================================
 Iterator::Iterator(GatewaySupervisor* supervisor)
     : workloopRunning_(false)
@@ -29,6 +31,10 @@ Iterator::Iterator(GatewaySupervisor* supervisor)
     , activePlanName_("")
     , activeCommandIndex_(-1)
     , activeCommandStartTime_(0)
+    , progressCount_(0)
+    , lastProgressCount_(0)
+    , transitionsQueued_(0)
+    , transitionsDone_(0)
     , theSupervisor_(supervisor)
 {
 	__COUT__ << "Iterator constructed." << __E__;
@@ -64,6 +70,111 @@ Iterator::Iterator(GatewaySupervisor* supervisor)
 //==============================================================================
 Iterator::~Iterator(void) {}
 
+//==============================================================================
+// signalCommandProgress
+//	Called when something the iterator thread may be waiting on has happened
+//	(e.g. a state machine transition finished, or a play/pause/halt command arrived),
+//	so that the active command is checked right away instead of on the next poll.
+void Iterator::signalCommandProgress(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(progressMutex_);
+		++progressCount_;
+	}
+	progressCondition_.notify_all();
+}  // end signalCommandProgress()
+
+//==============================================================================
+// waitForCommandProgress
+//	Called by the iterator thread between checks of the active command.
+//	Returns at the first progress signal since the last call, or at the
+//	timeout, which bounds the latency for completions that are not signaled.
+void Iterator::waitForCommandProgress(unsigned int timeoutMs)
+{
+	std::unique_lock<std::mutex> lock(progressMutex_);
+	progressCondition_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return progressCount_ != lastProgressCount_; });
+	lastProgressCount_ = progressCount_;
+}  // end waitForCommandProgress()
+
+//==============================================================================
+// signalTransitionQueued
+//	Called by GatewaySupervisor before a state machine transition is handed to
+//	the state machine work loop. The Iterator launches transitions from its own
+//	thread, so a transition it launched is always counted before its next check.
+void Iterator::signalTransitionQueued(void)
+{
+	std::lock_guard<std::mutex> lock(progressMutex_);
+	++transitionsQueued_;
+}  // end signalTransitionQueued()
+
+//==============================================================================
+// signalTransitionDone
+//	Called by GatewaySupervisor when a queued state machine transition has ended
+//	(or could not be handed to the work loop, or failed).
+void Iterator::signalTransitionDone(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(progressMutex_);
+		if(transitionsDone_ < transitionsQueued_)  // e.g. a failed hand-off that still ran
+			++transitionsDone_;
+		++progressCount_;
+	}
+	progressCondition_.notify_all();
+}  // end signalTransitionDone()
+
+//==============================================================================
+// waitForTransitionsDone
+//	Called by the iterator thread before checking the state of the FSM.
+//	Returns true once every transition queued so far has started and ended, so
+//	the state is never evaluated between the launch of a transition and its start,
+//	nor on an unrelated progress signal.
+//	When no transition is pending, it waits like waitForCommandProgress() so that
+//	polling checks (e.g. for the run duration) keep their pace.
+bool Iterator::waitForTransitionsDone(unsigned int timeoutMs)
+{
+	std::unique_lock<std::mutex> lock(progressMutex_);
+	if(transitionsDone_ >= transitionsQueued_)
+		progressCondition_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return progressCount_ != lastProgressCount_; });
+	else
+		progressCondition_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]() { return transitionsDone_ >= transitionsQueued_; });
+	lastProgressCount_ = progressCount_;
+	return transitionsDone_ >= transitionsQueued_;
+}  // end waitForTransitionsDone()
+
+//==============================================================================
+// recordStepTiming
+//	Called by the iterator thread when the active command completes.
+void Iterator::recordStepTiming(IteratorWorkLoopStruct* iteratorStruct)
+{
+	StepTiming stepTiming;
+	stepTiming.commandIndex_ = iteratorStruct->startedCommandIndex_;
+	stepTiming.commandIteration_ =
+	    stepTiming.commandIndex_ < iteratorStruct->commandIterations_.size() ? (int)iteratorStruct->commandIterations_[stepTiming.commandIndex_] : -1;
+	stepTiming.type_ = stepTiming.commandIndex_ < iteratorStruct->commands_.size() ? iteratorStruct->commands_[stepTiming.commandIndex_].type_ : "";
+	stepTiming.durationMs_ =
+	    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - iteratorStruct->commandStartTime_).count();
+
+	__COUT__ << "Command " << stepTiming.commandIndex_ + 1 << " (" << stepTiming.type_ << ") took " << stepTiming.durationMs_ << " ms." << __E__;
+
+	// lockout the messages array for the remainder of the scope
+	// this guarantees the reading thread can safely access the messages
+	if(theSupervisor_->VERBOSE_MUTEX)
+		__COUT__ << "Waiting for iterator access" << __E__;
+	std::lock_guard<std::mutex> lock(accessMutex_);
+	if(theSupervisor_->VERBOSE_MUTEX)
+		__COUT__ << "Have iterator access" << __E__;
+
+	stepTimingHistory_.push_back(stepTiming);
+	if(stepTimingHistory_.size() > STEP_TIMING_HISTORY_SIZE)
+		stepTimingHistory_.pop_front();
+
+	if(stepTiming.commandIndex_ < commandTimingTotals_.size())
+	{
+		++commandTimingTotals_[stepTiming.commandIndex_].first;
+		commandTimingTotals_[stepTiming.commandIndex_].second += stepTiming.durationMs_;
+	}
+}  // end recordStepTiming()
+
 //==============================================================================
 void Iterator::IteratorWorkLoop(Iterator* iterator)
 try
@@ -324,6 +435,12 @@ try
 				theIteratorStruct.originalConfigGroup_  = theIteratorStruct.cfgMgr_->getActiveGroupName();
 				theIteratorStruct.originalConfigKey_    = theIteratorStruct.cfgMgr_->getActiveGroupKey();
 
+				{  // reset step timing for the new plan
+					std::lock_guard<std::mutex> lock(iterator->accessMutex_);
+					iterator->stepTimingHistory_.clear();
+					iterator->commandTimingTotals_.assign(theIteratorStruct.commands_.size(), std::make_pair(0, 0));
+				}
+
 				__COUT__ << "originalTrackChanges " << theIteratorStruct.originalTrackChanges_ << __E__;
 				__COUT__ << "originalConfigGroup " << theIteratorStruct.originalConfigGroup_ << __E__;
 				__COUT__ << "originalConfigKey " << theIteratorStruct.originalConfigKey_ << __E__;
@@ -342,6 +459,8 @@ try
 					__MOUT__ << "Iterator starting command " << theIteratorStruct.commandIndex_ + 1 << ": "
 					         << theIteratorStruct.commands_[theIteratorStruct.commandIndex_].type_ << __E__;
 
+					theIteratorStruct.startedCommandIndex_ = theIteratorStruct.commandIndex_;
+					theIteratorStruct.commandStartTime_    = std::chrono::steady_clock::now();
 					iterator->startCommand(&theIteratorStruct);
 				}
 				else if(theIteratorStruct.commandIndex_ == theIteratorStruct.commands_.size())  // Done!
@@ -375,6 +494,7 @@ try
 				if(iterator->checkCommand(&theIteratorStruct))
 				{
 					theIteratorStruct.commandBusy_ = false;  // command complete
+					iterator->recordStepTiming(&theIteratorStruct);
 
 					++theIteratorStruct.commandIndex_;
 
@@ -390,8 +510,8 @@ try
 			}
 
 		}  // end running
-		else
-			sleep(1);  // when inactive sleep a lot
+		else  // when inactive wait for a play/pause/halt command
+			iterator->waitForCommandProgress(1000 /*ms*/);
 
 		////////////////
 		////////////////
@@ -577,8 +697,9 @@ catch(...)
 
 //==============================================================================
 // checkCommand
-//	when busy for a while, start to sleep
-//		use sleep() or nanosleep()
+//	checks wait on command progress (see waitForTransitionsDone() and
+//		waitForCommandProgress()) so that a step advances as soon as its
+//		transition or Macro completes
 bool Iterator::checkCommand(IteratorWorkLoopStruct* iteratorStruct)
 try
 {
@@ -925,6 +1046,7 @@ void Iterator::startCommandRun(IteratorWorkLoopStruct* iteratorStruct)
 	}
 
 	// save original duration
+	iteratorStruct->runDurationTickTime_ = std::chrono::steady_clock::now();
 	sscanf(iteratorStruct->commands_[iteratorStruct->commandIndex_].params_[IterateTable::commandRunParams_.DurationInSeconds_].c_str(),
 	       "%ld",
 	       &iteratorStruct->originalDurationInSeconds_);
@@ -1106,6 +1228,18 @@ void Iterator::startCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 
 		// for each target, init to not done
 		iteratorStruct->targetsDone_.push_back(false);
+	}  // end target loop
+
+	// the targets of each FE supervisor are launched with one request, so that the
+	//	front-end supervisor can run the scan on its targets concurrently and write
+	//	a single output file
+	groupMacroTargets(iteratorStruct);
+
+	for(const auto& targetGroup : iteratorStruct->macroTargetGroups_)
+	{
+		std::string targetInterfaceIDs;
+		for(const auto& targetIndex : targetGroup)
+			targetInterfaceIDs += (targetInterfaceIDs.size() ? "," : "") + iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_[targetIndex].UID_;
 
 		xoap::MessageReference message = SOAPUtilities::makeSOAPMessageReference("FECommunication");
 
@@ -1113,7 +1247,7 @@ void Iterator::startCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 		std::string    type = isFrontEndMacro ? "feMacroMultiDimensionalStart" : "macroMultiDimensionalStart";
 		parameters.addParameter("type", type);
 		parameters.addParameter("requester", WebUsers::DEFAULT_ITERATOR_USERNAME);
-		parameters.addParameter("targetInterfaceID", target.UID_);
+		parameters.addParameter("targetInterfaceID", targetInterfaceIDs);
 		parameters.addParameter(isFrontEndMacro ? "feMacroName" : "macroName", macroName);
 		parameters.addParameter("enableSavingOutput", enableSavingOutput);
 		parameters.addParameter("outputFilePath", outputFilePath);
@@ -1137,18 +1271,20 @@ void Iterator::startCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 		if(response != type + "Done" || error != "")
 		{
 			// error occurred!
-			__SS__ << "Error transmitting request to target interface '" << target.UID_ << "' from '" << WebUsers::DEFAULT_ITERATOR_USERNAME << ".' Response '"
-			       << response << "' with error: " << error << __E__;
+			__SS__ << "Error transmitting request to target interface(s) '" << targetInterfaceIDs << "' from '" << WebUsers::DEFAULT_ITERATOR_USERNAME
+			       << ".' Response '" << response << "' with error: " << error << __E__;
 			__SS_THROW__;
 		}
-	}  // end target loop
+	}  // end target group loop
 
 }  // end startCommandMacro()
 
 //==============================================================================
 bool Iterator::checkCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool isFrontEndMacro)
 {
-	sleep(1);
+	// the check is a long poll: the front-end answers as soon as the launch completes, or after waitTimeoutMs
+	const unsigned int                          waitTimeoutMs = 1000;
+	const std::chrono::steady_clock::time_point checkTime     = std::chrono::steady_clock::now();
 
 	// Steps:
 	//	4 parameters  CommandExecuteFEMacroParams:
@@ -1161,13 +1297,24 @@ bool Iterator::checkCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 	__COUTV__(macroName);
 
 	// send request to MacroMaker to check completion of macro
-	// as targets are identified complete, remove targets_ from vector
+	//	for the targets of each FE supervisor in one request
 
-	for(unsigned int i = 0; i < iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_.size(); ++i)
+	bool        done = true;
+	std::string progress;
+	for(const auto& targetGroup : iteratorStruct->macroTargetGroups_)
 	{
-		ots::IterateTable::CommandTarget& target = iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_[i];
+		bool        groupDone = true;
+		std::string targetInterfaceIDs;
+		for(const auto& targetIndex : targetGroup)
+		{
+			groupDone = groupDone && iteratorStruct->targetsDone_[targetIndex];
+			targetInterfaceIDs += (targetInterfaceIDs.size() ? "," : "") + iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_[targetIndex].UID_;
+		}
+		if(groupDone)
+			continue;  // already reported done
 
-		__COUT__ << "target " << target.table_ << ":" << target.UID_ << __E__;
+		// share the long poll budget among the groups
+		unsigned int elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - checkTime).count();
 
 		xoap::MessageReference message = SOAPUtilities::makeSOAPMessageReference("FECommunication");
 
@@ -1175,8 +1322,9 @@ bool Iterator::checkCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 		std::string    type = isFrontEndMacro ? "feMacroMultiDimensionalCheck" : "macroMultiDimensionalCheck";
 		parameters.addParameter("type", type);
 		parameters.addParameter("requester", WebUsers::DEFAULT_ITERATOR_USERNAME);
-		parameters.addParameter("targetInterfaceID", target.UID_);
+		parameters.addParameter("targetInterfaceID", targetInterfaceIDs);
 		parameters.addParameter(isFrontEndMacro ? "feMacroName" : "macroName", macroName);
+		parameters.addParameter("waitTimeoutMs", elapsedMs < waitTimeoutMs ? waitTimeoutMs - elapsedMs : 0);
 		SOAPUtilities::addParameters(message, parameters);
 
 		__COUT__ << "Sending FE communication: " << SOAPUtilities::translate(message) << __E__;
@@ -1189,34 +1337,105 @@ bool Iterator::checkCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool is
 		SOAPParameters rxParameters;
 		rxParameters.addParameter("Error");
 		rxParameters.addParameter("Done");
+		rxParameters.addParameter("Progress");
 		std::string response = SOAPUtilities::receive(replyMessage, rxParameters);
 
 		std::string error = rxParameters.getValue("Error");
-		bool        done  = rxParameters.getValue("Done") == "1";
 
 		if(response != type + "Done" || error != "")
 		{
 			// error occurred!
-			__SS__ << "Error transmitting request to target interface '" << target.UID_ << "' from '" << WebUsers::DEFAULT_ITERATOR_USERNAME << ".' Response '"
-			       << response << "' with error: " << error << __E__;
+			__SS__ << "Error transmitting request to target interface(s) '" << targetInterfaceIDs << "' from '" << WebUsers::DEFAULT_ITERATOR_USERNAME
+			       << ".' Response '" << response << "' with error: " << error << __E__;
 			__SS_THROW__;
 		}
 
-		if(!done)  // still more to do so give up checking
-			return false;
+		progress += (progress.size() ? "; " : "") + rxParameters.getValue("Progress");
+
+		if(rxParameters.getValue("Done") != "1")
+		{
+			done = false;
+			continue;
+		}
 
-		// mark target done
-		iteratorStruct->targetsDone_[i] = true;
+		// mark targets of group done
+		for(const auto& targetIndex : targetGroup)
+			iteratorStruct->targetsDone_[targetIndex] = true;
+	}  // end target group loop
 
-		//		iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_.erase(
-		//				targetIt--); //go back after delete
+	__COUT__ << "Macro '" << macroName << "' progress: " << progress << __E__;
 
-	}  // end target loop
+	if(!done)  // still more to do so give up checking
+	{
+		// if the wait was not honored along the way, wait out the remainder here
+		unsigned int elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - checkTime).count();
+		if(elapsedMs < waitTimeoutMs)
+			iteratorStruct->theIterator_->waitForCommandProgress(waitTimeoutMs - elapsedMs);
+		return false;
+	}
 
 	// if here all targets are done
 	return true;
 }  // end checkCommandMacro()
 
+//==============================================================================
+// groupMacroTargets
+//	Groups the targets of the current Macro command by the FE supervisor that owns
+//		each target interface in the active configuration, so that each FE supervisor
+//		receives one request for all of its targets.
+//	A target not found under any FE supervisor is kept in a group of its own,
+//		so that Macro Maker routes (or rejects) it as a single target.
+void Iterator::groupMacroTargets(IteratorWorkLoopStruct* iteratorStruct)
+{
+	// map each interface to its FE supervisor
+	std::map<std::string /*interfaceID*/, std::string /*supervisor*/> interfaceSupervisorMap;
+	for(const auto& supervisorPair : iteratorStruct->theIterator_->theSupervisor_->allSupervisorInfo_.getAllFETypeSupervisorInfo())
+	{
+		const SupervisorInfo& supervisorInfo = supervisorPair.second;
+		try
+		{
+			ConfigurationTree feGroupLinkNode =
+			    iteratorStruct->cfgMgr_->getSupervisorTableNode(supervisorInfo.getContextName(), supervisorInfo.getName()).getNode("LinkToFEInterfaceTable");
+			if(feGroupLinkNode.isDisconnected())
+				continue;
+
+			for(const auto& interfaceID : feGroupLinkNode.getChildrenNames(false /*byPriority*/, true /*onlyStatusTrue*/))
+				interfaceSupervisorMap.emplace(interfaceID, supervisorInfo.getContextName() + "/" + supervisorInfo.getName());
+		}
+		catch(...)  // ignore supervisors without front-end interfaces
+		{
+			__COUT__ << "No front-end interfaces found for supervisor '" << supervisorInfo.getContextName() << "/" << supervisorInfo.getName() << ".'"
+			         << __E__;
+		}
+	}  // end FE supervisor loop
+
+	iteratorStruct->macroTargetGroups_.clear();
+	std::map<std::string /*supervisor*/, unsigned int /*group index*/> supervisorGroupMap;
+
+	const std::vector<IterateTable::CommandTarget>& targets = iteratorStruct->commands_[iteratorStruct->commandIndex_].targets_;
+	for(unsigned int i = 0; i < targets.size(); ++i)
+	{
+		auto supervisorIt = interfaceSupervisorMap.find(targets[i].UID_);
+		if(supervisorIt == interfaceSupervisorMap.end())
+		{
+			__COUT__ << "No FE supervisor found for target interface '" << targets[i].UID_ << "' - sending it alone." << __E__;
+			iteratorStruct->macroTargetGroups_.push_back({i});
+			continue;
+		}
+
+		auto groupIt = supervisorGroupMap.find(supervisorIt->second);
+		if(groupIt == supervisorGroupMap.end())
+		{
+			supervisorGroupMap.emplace(supervisorIt->second, iteratorStruct->macroTargetGroups_.size());
+			iteratorStruct->macroTargetGroups_.push_back({i});
+		}
+		else
+			iteratorStruct->macroTargetGroups_[groupIt->second].push_back(i);
+	}  // end target loop
+
+	__COUT__ << "Grouped " << targets.size() << " target(s) into " << iteratorStruct->macroTargetGroups_.size() << " FE supervisor request(s)." << __E__;
+}  // end groupMacroTargets()
+
 //==============================================================================
 void Iterator::startCommandModifyActive(IteratorWorkLoopStruct* iteratorStruct)
 {
@@ -1306,7 +1525,9 @@ void Iterator::startCommandModifyActive(IteratorWorkLoopStruct* iteratorStruct)
 //	Note: watch iterator->doPauseAction and iterator->doHaltAction and respond
 bool Iterator::checkCommandRun(IteratorWorkLoopStruct* iteratorStruct)
 {
-	sleep(1);  // sleep to give FSM time to transition
+	// wait for the FSM to finish the launched transitions (signaled by GatewaySupervisor)
+	if(!iteratorStruct->theIterator_->waitForTransitionsDone(1000 /*ms*/))
+		return false;
 
 	// all RunControlStateMachine access commands should be mutually exclusive with
 	// GatewaySupervisor main thread state machine accesses  should be mutually exclusive
@@ -1521,6 +1742,12 @@ bool Iterator::checkCommandRun(IteratorWorkLoopStruct* iteratorStruct)
 
 		///////////////////
 		// priority 2 is duration, if <= 0 it is ignored
+		//	Note: checks can come sooner than once per second (on progress signals), so
+		//	the remaining duration is only counted down when a second has passed
+		if(remainingDurationInSeconds > 0 && std::chrono::steady_clock::now() - iteratorStruct->runDurationTickTime_ < std::chrono::seconds(1))
+			return false;
+		iteratorStruct->runDurationTickTime_ = std::chrono::steady_clock::now();
+
 		if(remainingDurationInSeconds > 1)
 		{
 			--remainingDurationInSeconds;
@@ -1572,7 +1799,9 @@ bool Iterator::checkCommandRun(IteratorWorkLoopStruct* iteratorStruct)
 // return true if done
 bool Iterator::checkCommandConfigure(IteratorWorkLoopStruct* iteratorStruct)
 {
-	sleep(1);  // sleep to give FSM time to transition
+	// wait for the FSM to finish the launched transitions (signaled by GatewaySupervisor)
+	if(!iteratorStruct->theIterator_->waitForTransitionsDone(1000 /*ms*/))
+		return false;
 
 	// all RunControlStateMachine access commands should be mutually exclusive with
 	// GatewaySupervisor main thread state machine accesses  should be mutually exclusive
@@ -1637,7 +1866,9 @@ bool Iterator::checkCommandFSMTransition(IteratorWorkLoopStruct* iteratorStruct,
 {
 	__COUTV__(finalState);
 
-	sleep(1);  // sleep to give FSM time to transition
+	// wait for the FSM to finish the launched transitions (signaled by GatewaySupervisor)
+	if(!iteratorStruct->theIterator_->waitForTransitionsDone(1000 /*ms*/))
+		return false;
 
 	// all RunControlStateMachine access commands should be mutually exclusive with
 	// GatewaySupervisor main thread state machine accesses  should be mutually exclusive
@@ -1695,12 +1926,16 @@ bool Iterator::handleCommandRequest(HttpXmlDocument& xmldoc, const std::string&
 	}
 	else if(command == "getIterationPlanStatus")
 	{
-		if(activePlanName_ == "" && parameter != "") //take parameter to set active plan name from GUI manipulations
+		if(parameter != "")
 		{
-			activePlanName_ = parameter;
-			__COUTV__(activePlanName_);		
+			std::lock_guard<std::mutex> lock(accessMutex_);
+			if(activePlanName_ == "") //take parameter to set active plan name from GUI manipulations
+			{
+				activePlanName_ = parameter;
+				__COUTV__(activePlanName_);
+			}
 		}
-		getIterationPlanStatus(xmldoc);
+		getIterationPlanStatus(xmldoc);  // takes accessMutex_
 		return true;
 	}
 	else  // return true if iterator has control of state machine
@@ -1762,6 +1997,7 @@ void Iterator::playIterationPlan(HttpXmlDocument& xmldoc, const std::string& pla
 
 		activePlanName_ = planName;
 		commandPlay_    = true;
+		signalCommandProgress();
 	}
 	else
 	{
@@ -1795,6 +2031,7 @@ void Iterator::pauseIterationPlan(HttpXmlDocument& xmldoc)
 	if(workloopRunning_ && activePlanIsRunning_ && !commandPause_)
 	{
 		commandPause_ = true;
+		signalCommandProgress();
 	}
 	else
 	{
@@ -1829,6 +2066,7 @@ void Iterator::haltIterationPlan(HttpXmlDocument& /*xmldoc*/)
 		__COUT__ << "activePlanIsRunning_: " << activePlanIsRunning_ << __E__;
 		__COUT__ << "Passing halt command to iterator thread." << __E__;
 		commandHalt_ = true;
+		signalCommandProgress();
 
 		// clear
 		activePlanName_     = "";
@@ -1886,6 +2124,27 @@ void Iterator::getIterationPlanStatus(HttpXmlDocument& xmldoc)
 		xmldoc.addTextElementToData("depth_iteration", tmp);
 	}
 
+	// per step timing, most recent steps last
+	for(const auto& stepTiming : stepTimingHistory_)  // updated by the iterator thread under accessMutex_, held here
+	{
+		sprintf(tmp, "%u", stepTiming.commandIndex_);
+		xmldoc.addTextElementToData("step_command_index", tmp);
+		xmldoc.addTextElementToData("step_command_type", stepTiming.type_);
+		sprintf(tmp, "%d", stepTiming.commandIteration_);  // -1 if unknown
+		xmldoc.addTextElementToData("step_command_iteration", tmp);
+		sprintf(tmp, "%u", stepTiming.durationMs_);
+		xmldoc.addTextElementToData("step_duration_ms", tmp);
+	}
+
+	// per command totals of the active plan, in command index order
+	for(const auto& commandTiming : commandTimingTotals_)
+	{
+		sprintf(tmp, "%u", commandTiming.first);
+		xmldoc.addTextElementToData("command_execution_count", tmp);
+		sprintf(tmp, "%lu", commandTiming.first ? commandTiming.second / commandTiming.first : 0);
+		xmldoc.addTextElementToData("command_average_duration_ms", tmp);
+	}
+
 	if(activePlanIsRunning_ && iteratorBusy_)
 	{
 		if(workloopRunning_)
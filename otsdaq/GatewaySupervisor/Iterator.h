@@ -1,6 +1,9 @@
 #ifndef _ots_Iterator_h
 #define _ots_Iterator_h
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <mutex>  //for std::mutex
 #include <string>
 #include "otsdaq/TablePlugins/IterateTable.h"
@@ -28,6 +31,10 @@ class Iterator
 
 	bool handleCommandRequest(HttpXmlDocument& xmldoc, const std::string& command, const std::string& parameter);
 
+	void signalCommandProgress(void);  // wakes the iterator thread, e.g. on a play/pause/halt command
+	void signalTransitionQueued(void);  // called for every state machine transition handed to the state machine work loop
+	void signalTransitionDone(void);    // called at the end of every queued state machine transition
+
   private:
 	// begin declaration of iterator workloop members
 	struct IteratorWorkLoopStruct
@@ -42,6 +49,7 @@ class Iterator
 		    , doHaltAction_(false)
 		    , doResumeAction_(false)
 		    , commandIndex_((unsigned int)-1)
+		    , startedCommandIndex_((unsigned int)-1)
 		{
 		}
 
@@ -69,6 +77,12 @@ class Iterator
 		std::vector<std::string> fsmCommandParameters_;
 		std::vector<bool>        targetsDone_;
 
+		std::vector<std::vector<unsigned int /*target index*/> > macroTargetGroups_;  // Macro targets grouped by owning FE supervisor
+
+		unsigned int                          startedCommandIndex_;    // for step timing (repeat labels change commandIndex_)
+		std::chrono::steady_clock::time_point commandStartTime_;       // for step timing
+		std::chrono::steady_clock::time_point runDurationTickTime_;    // run duration is counted down once per second
+
 	};  // end declaration of iterator workloop members
 
 	static void IteratorWorkLoop(Iterator* iterator);
@@ -86,6 +100,7 @@ class Iterator
 
 	static void startCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool isFEMacro);
 	static bool checkCommandMacro(IteratorWorkLoopStruct* iteratorStruct, bool isFEMacro);
+	static void groupMacroTargets(IteratorWorkLoopStruct* iteratorStruct);
 
 	static void startCommandBeginLabel(IteratorWorkLoopStruct* iteratorStruct);
 	static void startCommandRepeatLabel(IteratorWorkLoopStruct* iteratorStruct);
@@ -100,6 +115,20 @@ class Iterator
 	                         IteratorWorkLoopStruct* iteratorStruct = 0,
 							 bool 					  doNotHaltFSM = false);
 
+	void waitForCommandProgress(unsigned int timeoutMs);  // returns early on signalCommandProgress()
+	bool waitForTransitionsDone(unsigned int timeoutMs);  // returns true when all queued transitions have ended
+	void recordStepTiming(IteratorWorkLoopStruct* iteratorStruct);
+
+	// step timing of the active plan, kept for the plan status
+	struct StepTiming
+	{
+		unsigned int commandIndex_;
+		int          commandIteration_;  // -1 if unknown
+		std::string  type_;
+		unsigned int durationMs_;
+	};
+	static const size_t STEP_TIMING_HISTORY_SIZE;
+
 	std::mutex    accessMutex_;
 	volatile bool workloopRunning_;
 	volatile bool activePlanIsRunning_;
@@ -114,6 +143,13 @@ class Iterator
 	volatile time_t           activeCommandStartTime_;
 	std::string               lastFsmName_;
 	std::string               errorMessage_;
+	std::deque<StepTiming>    stepTimingHistory_;  // most recent last
+	std::vector<std::pair<unsigned int /*count*/, unsigned long /*total ms*/> > commandTimingTotals_;  // by command index
+
+	std::mutex              progressMutex_;
+	std::condition_variable progressCondition_;
+	unsigned long           progressCount_, lastProgressCount_;  // progress is new when these differ
+	unsigned long           transitionsQueued_, transitionsDone_;  // FSM is settled when these are equal
 
 	GatewaySupervisor* theSupervisor_;
 
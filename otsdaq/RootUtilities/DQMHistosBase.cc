@@ -4,8 +4,11 @@
 
 #include <TDirectory.h>
 #include <TFile.h>
+#include <TH1.h>
+#include <TROOT.h>
 #include <TStyle.h>
 
+#include <cstdio>  //rename
 #include <ctime>
 #include <iostream>
 
@@ -21,6 +24,19 @@ DQMHistosBase::DQMHistosBase(void) { gStyle->SetPalette(1); }
 //==============================================================================
 DQMHistosBase::~DQMHistosBase(void) { closeFile(); }
 
+//==============================================================================
+// setBackgroundAutoSave
+//	ROOT thread safety (global locking) is only enabled when this mode is, so
+//	enable it before booking histograms, e.g. from the plugin constructor.
+void DQMHistosBase::setBackgroundAutoSave(bool backgroundAutoSave)
+{
+	if(backgroundAutoSave)
+		ROOT::EnableThreadSafety();  // the snapshot file is written by another thread
+	else
+		waitForBackgroundSave();
+	backgroundAutoSave_ = backgroundAutoSave;
+}
+
 //==============================================================================
 bool DQMHistosBase::isFileOpen(void)
 {
@@ -43,6 +59,8 @@ void DQMHistosBase::openFile(std::string fileName)
 //==============================================================================
 void DQMHistosBase::save(void)
 {
+	waitForBackgroundSave();  // the live file is written below, snapshots go to a separate file
+
 	if(theFile_ != nullptr)
 	{
 		if(autoSave_)
@@ -62,21 +80,138 @@ void DQMHistosBase::autoSave(bool force)  // The file will be saved if currentTi
 	time(&currentTime);
 	if(beginTime_ == 0)
 	{
-		theFile_->Write("", TObject::kOverwrite);  // write the histogram to the file with kOverwrite update option
+		if(backgroundAutoSave_)
+			snapshotSave(false /*waitForPrevious*/);
+		else
+			theFile_->Write("", TObject::kOverwrite);  // write the histogram to the file with kOverwrite update option
 		beginTime_ = currentTime;
 		return;
 	}
 
 	if(force || currentTime - beginTime_ >= autoSaveInterval_)
 	{
-		theFile_->Write("", TObject::kOverwrite);  // write the histogram to the file with kOverwrite update option
+		if(backgroundAutoSave_)
+		{
+			if(!snapshotSave(force /*waitForPrevious*/))
+				return;  // previous save is still writing, so try again on next call
+		}
+		else
+			theFile_->Write("", TObject::kOverwrite);  // write the histogram to the file with kOverwrite update option
 		beginTime_ = currentTime;
 	}
 }
 
+//==============================================================================
+// snapshotSave
+//	Clone the histograms on the calling (filling) thread, then write the clones
+//	on a background thread to a temporary file which is renamed over the
+//	snapshot file when complete. So neither filling nor visualization waits on
+//	disk. The live file is left open and untouched, and is written by save().
+//	Returns false if the previous save is still writing and waitForPrevious is false.
+bool DQMHistosBase::snapshotSave(bool waitForPrevious)
+{
+	if(theFile_ == nullptr)
+		return true;
+	if(backgroundSaveRunning_ && !waitForPrevious)
+		return false;
+	waitForBackgroundSave();
+
+	Snapshot* snapshot = new Snapshot();
+	{
+		TDirectory::TContext context(nullptr);  // so clones are not added to the current directory
+		takeSnapshot(theFile_, "", *snapshot);
+	}
+
+	std::string filePath   = getSnapshotFilePath();
+	backgroundSaveRunning_ = true;
+	backgroundSaveThread_  = std::thread([this, snapshot, filePath]() {
+		writeSnapshot(*snapshot, filePath);
+		delete snapshot;
+		backgroundSaveRunning_ = false;
+	});
+	return true;
+}  // end snapshotSave()
+
+//==============================================================================
+// getSnapshotFilePath
+//	<file>.root becomes <file>_snapshot.root, so the open live file is never
+//	replaced on disk.
+std::string DQMHistosBase::getSnapshotFilePath(void) const
+{
+	if(theFile_ == nullptr)
+		return "";
+
+	std::string       filePath  = theFile_->GetName();
+	const std::string extension = ".root";
+	if(filePath.size() > extension.size() && filePath.compare(filePath.size() - extension.size(), extension.size(), extension) == 0)
+		filePath.resize(filePath.size() - extension.size());
+	return filePath + "_snapshot" + extension;
+}  // end getSnapshotFilePath()
+
+//==============================================================================
+void DQMHistosBase::takeSnapshot(TDirectory* directory, const std::string& path, Snapshot& snapshot)
+{
+	TIter next(directory->GetList());
+	while(TObject* object = next())
+	{
+		if(TDirectory* subDirectory = dynamic_cast<TDirectory*>(object))
+		{
+			takeSnapshot(subDirectory, (path == "" ? "" : path + "/") + subDirectory->GetName(), snapshot);
+			continue;
+		}
+
+		TObject* clone = object->Clone();
+		if(TH1* histo = dynamic_cast<TH1*>(clone))
+			histo->SetDirectory(nullptr);
+		snapshot.push_back(std::make_pair(path, clone));
+	}
+}  // end takeSnapshot()
+
+//==============================================================================
+// writeSnapshot
+//	Runs on the background thread, and deletes the clones.
+void DQMHistosBase::writeSnapshot(Snapshot& snapshot, const std::string& filePath)
+{
+	std::string tmpFilePath = filePath + ".tmp";
+	TFile*      file        = TFile::Open(tmpFilePath.c_str(), "RECREATE");
+	if(file == nullptr || !file->IsOpen())
+		__COUT_ERR__ << "Can't open temporary file for histogram save: " << tmpFilePath << __E__;
+
+	for(auto& object : snapshot)
+	{
+		if(file != nullptr && file->IsOpen())
+		{
+			TDirectory* directory = file;
+			if(object.first != "" && (directory = file->GetDirectory(object.first.c_str())) == nullptr)
+				directory = file->mkdir(object.first.c_str());
+			if(directory != nullptr)
+				directory->WriteTObject(object.second, object.second->GetName(), "Overwrite");
+		}
+		delete object.second;
+	}
+
+	if(file == nullptr)
+		return;
+	bool isOpen = file->IsOpen();
+	file->Close();
+	delete file;
+
+	if(isOpen && rename(tmpFilePath.c_str(), filePath.c_str()) != 0)
+		__COUT_ERR__ << "Can't rename histogram save file " << tmpFilePath << " to " << filePath << __E__;
+}  // end writeSnapshot()
+
+//==============================================================================
+void DQMHistosBase::waitForBackgroundSave(void)
+{
+	if(backgroundSaveThread_.joinable())
+		backgroundSaveThread_.join();
+}  // end waitForBackgroundSave()
+
 //==============================================================================
 void DQMHistosBase::closeFile(void)
 {
+	waitForBackgroundSave();
+
 	if(theFile_ != nullptr)
 	{
 		if(theFile_->IsOpen())
@@ -1,8 +1,12 @@
 #ifndef _ots_DQMHistosBase_h_
 #define _ots_DQMHistosBase_h_
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 class TFile;
 class TDirectory;
@@ -28,6 +32,7 @@ class DQMHistosBase
 
   protected:
 	void         setAutoSave(bool autoSave) { autoSave_ = autoSave; }  // Default is true
+	void         setBackgroundAutoSave(bool backgroundAutoSave);  // Default is false, if true autosaves write snapshots to <file>_snapshot.root on a thread
 	bool         isFileOpen(void);
 	virtual void save(void);
 	virtual void openFile(std::string fileName);
@@ -35,14 +40,26 @@ class DQMHistosBase
 	virtual void autoSave(bool force = false);  // The file will be saved if force == true or currentTime - beginTimeTime_ is >= autoSaveInterval_
 	virtual void setAutoSaveInterval(unsigned int interval) { autoSaveInterval_ = interval; }  // Default is in the protected variables = 300
 
-	TFile*      theFile_          = nullptr;
-	TDirectory* myDirectory_      = nullptr;
-	bool        autoSave_         = true;
-	bool        autoSaveInterval_ = 300;
-	time_t      beginTime_        = 0;
+	TFile*       theFile_          = nullptr;
+	TDirectory*  myDirectory_      = nullptr;
+	bool         autoSave_         = true;
+	unsigned int autoSaveInterval_ = 300;
+	time_t       beginTime_        = 0;
 
   private:
+	typedef std::vector<std::pair<std::string /*directory path*/, TObject* /*clone*/> > Snapshot;
+
+	std::string getSnapshotFilePath(void) const;
+	void        takeSnapshot(TDirectory* directory, const std::string& path, Snapshot& snapshot);
+	void        writeSnapshot(Snapshot& snapshot, const std::string& filePath);
+	bool        snapshotSave(bool waitForPrevious);
+	void        waitForBackgroundSave(void);
+
 	VisualDataManager* theDataManager_;
+
+	bool              backgroundAutoSave_ = false;
+	std::thread       backgroundSaveThread_;
+	std::atomic<bool> backgroundSaveRunning_{false};
 };
 }  // namespace ots
 
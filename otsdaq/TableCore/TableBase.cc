@@ -15,6 +15,8 @@ using namespace ots;
 const std::string TableBase::GROUP_CACHE_PREPEND = "GroupCache_";
 const std::string TableBase::JSON_DOC_PREPEND = "JSONDoc_";
 
+std::atomic<unsigned long> TableBase::activeViewChangeCount_(0);
+
 //==============================================================================
 // TableBase
 //	If a valid string pointer is passed in accumulatedExceptions
@@ -149,7 +151,10 @@ void TableBase::reset(bool keepTemporaryVersions)
 	if(keepTemporaryVersions)
 		trimCache(0);
 	else  // clear all
+	{
 		tableViews_.clear();
+		viewContentHashes_.clear();
+	}
 }
 
 //==============================================================================
@@ -248,6 +253,7 @@ void TableBase::trimTemporary(TableVersion targetVersion)
 				if(activeTableView_ && getViewVersion() == it->first)  // if activeVersion is being erased!
 					deactivate();                                      // deactivate active view, instead of guessing at next
 					                                                   // active view
+				invalidateViewContentHash(it->first);
 				tableViews_.erase(it++);
 			}
 			else
@@ -289,6 +295,7 @@ TableVersion TableBase::checkForDuplicate(TableVersion needleVersion, TableVersi
 	const TableView* needleView = &(needleIt->second);
 	unsigned int     rows       = needleView->getNumberOfRows();
 	unsigned int     cols       = needleView->getNumberOfColumns();
+	uint64_t         needleHash = needleView->getContentHash();
 
 	bool         match;
 	unsigned int potentialMatchCount = 0;
@@ -313,6 +320,9 @@ TableVersion TableBase::checkForDuplicate(TableVersion needleVersion, TableVersi
 		if(viewPairReverseIterator->second.getDataColumnSize() != cols || viewPairReverseIterator->second.getSourceColumnMismatch() != 0)
 			continue;  // col mismatch
 
+		if(getViewContentHash(viewPairReverseIterator->first, viewPairReverseIterator->second) != needleHash)
+			continue;  // content mismatch (cell-by-cell comparison below only on hash collision)
+
 		++potentialMatchCount;
 		__COUT_TYPE__(TLVL_DEBUG+12) << __COUT_HDR__ << "Checking version... " << viewPairReverseIterator->first << __E__;
 
@@ -385,6 +395,29 @@ TableVersion TableBase::checkForDuplicate(TableVersion needleVersion, TableVersi
 	return TableVersion();  // return invalid if no matches
 }  // end checkForDuplicate()
 
+//==============================================================================
+// getViewContentHash
+//	returns cached content hash of a persistent view, computing it if needed.
+//	The cached hash is recomputed if the view was modified since it was hashed
+//		(e.g. through a retained getViewP() pointer).
+//	Temporary views are always recomputed, since they are expected to be modified.
+uint64_t TableBase::getViewContentHash(const TableVersion& version, const TableView& view) const
+{
+	if(version.isTemporaryVersion())
+		return view.getContentHash();
+
+	auto it = viewContentHashes_.find(version);
+	if(it != viewContentHashes_.end() && it->second.first == view.getContentChangeCount())
+		return it->second.second;
+
+	uint64_t hash               = view.getContentHash();
+	viewContentHashes_[version] = std::make_pair(view.getContentChangeCount(), hash);
+	return hash;
+}  // end getViewContentHash()
+
+//==============================================================================
+void TableBase::invalidateViewContentHash(const TableVersion& version) const { viewContentHashes_.erase(version); }
+
 
 //==============================================================================
 // diffTwoVersions
@@ -595,6 +628,8 @@ void TableBase::changeVersionAndActivateView(TableVersion temporaryVersion, Tabl
 
 	auto emplacePair /*it,bool*/ = tableViews_.emplace(std::make_pair(version, TableView(tableName_)));
 	emplacePair.first->second.copy(tmpIt->second, version, tmpIt->second.getAuthor());
+	invalidateViewContentHash(version);
+	getViewContentHash(version, emplacePair.first->second);  // hash on save, for subsequent duplicate checks
 	setActiveView(version);
 	eraseView(temporaryVersion);  // delete temp version from tableViews_
 }
@@ -611,6 +646,7 @@ bool TableBase::eraseView(TableVersion version)
 	if(activeTableView_ && getViewVersion() == version)  // if activeVersion is being erased!
 		deactivate();                                    // deactivate active view, instead of guessing at next active view
 
+	invalidateViewContentHash(version);
 	tableViews_.erase(version);
 
 	return true;
@@ -733,7 +769,11 @@ void TableBase::setTableDescription(const std::string& tableDescription) { table
 //==============================================================================
 // deactivate
 //	reset the active view
-void TableBase::deactivate() { activeTableView_ = 0; }
+void TableBase::deactivate()
+{
+	activeTableView_ = 0;
+	++activeViewChangeCount_;
+}  // end deactivate()
 
 //==============================================================================
 // isActive
@@ -752,6 +792,7 @@ bool TableBase::setActiveView(TableVersion version)
 		return false;
 	}
 	activeTableView_ = &tableViews_.at(version);
+	++activeViewChangeCount_;
 
 	if(tableViews_.at(version).getVersion() != version)
 	{
@@ -1,6 +1,7 @@
 #ifndef _ots_TableBase_h_
 #define _ots_TableBase_h_
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <string>
@@ -95,6 +96,12 @@ class TableBase
 
 	unsigned int 				getNumberOfStoredViews			(void) const;
 
+	static unsigned long		getActiveViewChangeCount		(void) { return activeViewChangeCount_; }  // e.g. to invalidate caches of resolved nodes
+
+  private:
+	uint64_t					getViewContentHash				(const TableVersion& version, const TableView& view) const;
+	void						invalidateViewContentHash		(const TableVersion& version) const;
+
 
   // ----- member variables
 
@@ -114,6 +121,14 @@ class TableBase
 	// NOTE: must be very careful to setVersion of view after manipulating (e.g. copy from different version view)
 	std::map<TableVersion, TableView> 	tableViews_;	
 
+  private:
+	// Content hash of persistent views, computed on save or lazily by checkForDuplicate().
+	// Kept with the view content change count at hashing time, so a hash of a since-modified view is recomputed.
+	mutable std::map<TableVersion, std::pair<unsigned long /*view content change count*/, uint64_t /*hash*/> > viewContentHashes_;
+
+	// incremented on every setActiveView() or deactivate() of any table
+	static std::atomic<unsigned long>	activeViewChangeCount_;
+
 };
 // clang-format on
 }  // namespace ots
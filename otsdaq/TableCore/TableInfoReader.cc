@@ -35,6 +35,8 @@ using namespace ots;
 //    __ENV__("CONFIGURATION_TYPE");
 #define CONFIGURATION_BACKEND_TYPE_ __ENV__("CONFIGURATION_TYPE")
 
+std::mutex TableInfoReader::platformMutex_;
+
 //==============================================================================
 TableInfoReader::TableInfoReader(bool allowIllegalColumns) : allowIllegalColumns_(allowIllegalColumns)
 {
@@ -89,6 +91,7 @@ TableInfoReader::~TableInfoReader(void)
 //==============================================================================
 void TableInfoReader::initPlatform(void)
 {
+	std::lock_guard<std::mutex> lock(platformMutex_);
 	try
 	{
 		xercesc::XMLPlatformUtils::Initialize();  // Initialize Xerces infrastructure
@@ -103,6 +106,7 @@ void TableInfoReader::initPlatform(void)
 //==============================================================================
 void TableInfoReader::terminatePlatform(void)
 {
+	std::lock_guard<std::mutex> lock(platformMutex_);
 	try
 	{
 		xercesc::XMLPlatformUtils::Terminate();  // Terminate after release of memory
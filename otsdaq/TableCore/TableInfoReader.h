@@ -1,6 +1,7 @@
 #ifndef _ots_TableInfoReader_h_
 #define _ots_TableInfoReader_h_
 
+#include <mutex>
 #include <string>
 #include <xercesc/dom/DOMDocument.hpp>
 #include <xercesc/util/XMLChar.hpp>
@@ -51,6 +52,8 @@ class TableInfoReader
 
 	bool allowIllegalColumns_;
 
+	static std::mutex platformMutex_;  // Xerces Initialize/Terminate are not thread-safe
+
 	// static const std::string CONFIGURATION_BACKEND_TYPE_;
 };
 
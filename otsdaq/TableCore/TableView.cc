@@ -14,6 +14,7 @@ using namespace ots;
 #define __COUT_HDR__ (tableName_ + "v" + version_.toString() + "\t<> ")
 
 const unsigned int TableView::INVALID = -1;
+const int          TableView::JSON_FILL_FALLBACK = -2;
 
 //==============================================================================
 TableView::TableView(const std::string& tableName)
@@ -31,6 +32,7 @@ TableView::TableView(const std::string& tableName)
     , getSourceRawData_(false)
     , sourceColumnMismatchCount_(0)
     , sourceColumnMissingCount_(0)
+    , contentChangeCount_(0)
 {
 	storageData_ = "";  // unhijack
 
@@ -64,6 +66,7 @@ TableView& TableView::operator=(const TableView /*src*/)
 //==============================================================================
 TableView& TableView::copy(const TableView& src, TableVersion destinationVersion, const std::string& author)
 {
+	++contentChangeCount_;
 	// tableName_ = src.tableName_;
 	version_ = destinationVersion;
 	comment_ = src.comment_;
@@ -129,6 +132,7 @@ unsigned int TableView::copyRows(const std::string& author,
                                  unsigned char      generateUniqueDataColumns /* = false */,
                                  const std::string& baseNameAutoUID /*= "" */)
 {
+	++contentChangeCount_;
 	//__COUTV__(destOffsetRow);
 	//__COUTV__(srcOffsetRow);
 	//__COUTV__(srcRowsToCopy);
@@ -183,6 +187,7 @@ unsigned int TableView::copyRows(const std::string& author,
 // 	Note: this function also sanitizes yes/no, on/off, and true/false types
 void TableView::init(void)
 {
+	++contentChangeCount_;
 	//__COUT__ << "Starting table verification..." << StringMacros::stackTrace() << __E__;
 
 	try
@@ -902,6 +907,7 @@ std::string TableView::getEscapedValueAsString(unsigned int row, unsigned int co
 //	string version
 void TableView::setValue(const std::string& value, unsigned int row, unsigned int col)
 {
+	++contentChangeCount_;
 	if(!(col < columnsInfo_.size() && row < getNumberOfRows()))
 	{
 		__SS__ << "Invalid row (" << row << ") col (" << col << ") requested!" << __E__;
@@ -928,6 +934,7 @@ void TableView::setValue(const char* value, unsigned int row, unsigned int col)
 //	string version
 void TableView::setValueAsString(const std::string& value, unsigned int row, unsigned int col)
 {
+	++contentChangeCount_;
 	if(!(col < columnsInfo_.size() && row < getNumberOfRows()))
 	{
 		__SS__ << "Invalid row (" << row << ") col (" << col << ") requested!" << __E__;
@@ -951,6 +958,7 @@ const std::string& TableView::setUniqueColumnValue(unsigned int row,
 												   std::string  childLinkIndex /* = "" */,
 												   std::string  groupId /* = "" */)
 {
+	++contentChangeCount_;
 	if(!(col < columnsInfo_.size() && row < getNumberOfRows()))
 	{
 		__SS__ << "Invalid row (" << row << ") col (" << col << ") requested!" << __E__;
@@ -1276,6 +1284,7 @@ void TableView::addRowToGroup(const unsigned int& row,
                               const std::string&  groupID)  //,
                                                            // const std::string &colDefault)
 {
+	++contentChangeCount_;
 	if(isEntryInGroupCol(row, col, groupID))
 	{
 		__SS__ << "GroupID (" << groupID << ") added to row (" << row << " is already present!" << __E__;
@@ -1397,6 +1406,7 @@ std::vector<std::vector<unsigned int /*group row*/>> TableView::getGroupRowsInVe
 //	returns true if row was deleted because it had no group left
 bool TableView::removeRowFromGroup(const unsigned int& row, const unsigned int& col, const std::string& groupNeedle, bool deleteRowIfNoGroupLeft)
 {
+	++contentChangeCount_;
 	__COUT__ << "groupNeedle " << groupNeedle << __E__;
 	std::set<std::string> groupIDList;
 	if(!isEntryInGroupCol(row, col, groupNeedle, &groupIDList))
@@ -1886,6 +1896,7 @@ void TableView::doGetSourceRawData(bool setValue) { getSourceRawData_ = setValue
 //==============================================================================
 void TableView::reset(void)
 {
+	++contentChangeCount_;
 	version_ = -1;
 	comment_ = "";
 	author_  = "";
@@ -2106,8 +2117,12 @@ std::string restoreJSONStringEntities(const std::string& str)
 //	first level keys:
 //		NAME
 //		DATA_SET
+//
+//	Uses the single-pass parser, and falls back to the legacy parser
+//		for raw data requests or unexpected document structure.
 int TableView::fillFromJSON(const std::string& json)
 {
+	++contentChangeCount_;
 	{
 		//handle special GROUP CACHE table
 		std::string tmpCachePrepend = TableBase::GROUP_CACHE_PREPEND;
@@ -2139,9 +2154,29 @@ int TableView::fillFromJSON(const std::string& json)
 		} //end special GROUP CACHE table construction
 	} //end handle special GROUP CACHE table
 
+	if(!getSourceRawData_)
+	{
+		unsigned int rowCount = getNumberOfRows();
+		int          retVal   = fillFromJSONSinglePass(json);
+		if(retVal != TableView::JSON_FILL_FALLBACK)
+			return retVal;
 
+		__COUT_TYPE__(TLVL_DEBUG+20) << "Unexpected JSON structure for table '" << tableName_ << ",' falling back to legacy parser." << __E__;
+		theDataView_.resize(rowCount);  // remove partially filled rows
+	}
 
+	return fillFromJSONLegacy(json);
+}  // end fillFromJSON()
 
+//==============================================================================
+// fillFromJSONLegacy
+//	Original character-by-character JSON parser.
+//	Handles raw data requests (see doGetSourceRawData()) and is the fallback
+//	for document structures not handled by fillFromJSONSinglePass().
+//	Note: does not handle the special GROUP CACHE and JSON DOC tables, see fillFromJSON().
+int TableView::fillFromJSONLegacy(const std::string& json)
+{
+	++contentChangeCount_;
 	bool dbg     = false;  // tableName_ == "ARTDAQEventBuilderTable" || tableName_ == "";
 	bool rawData = getSourceRawData_;
 	if(getSourceRawData_)
@@ -2724,7 +2759,416 @@ int TableView::fillFromJSON(const std::string& json)
 	// print();
 
 	return 0;  // success
-}  // end fillFromJSON()
+}  // end fillFromJSONLegacy()
+
+namespace
+{
+//==============================================================================
+// JSON scanning helpers for TableView::fillFromJSONSinglePass()
+
+inline const char* skipJSONWhitespace(const char* p, const char* end)
+{
+	while(p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+		++p;
+	return p;
+}  // end skipJSONWhitespace()
+
+// findJSONStringEnd
+//	p points after the opening quote. Returns pointer to the closing quote, or 0.
+//	Jumps between quotes with memchr (vectorized in libc), a quote is escaped
+//	if preceded by an odd number of backslashes.
+inline const char* findJSONStringEnd(const char* p, const char* end, bool& hasEscapes)
+{
+	const char* start = p;
+	const char* q;
+	const char* b;
+	while(p < end)
+	{
+		q = static_cast<const char*>(memchr(p, '"', end - p));
+		if(!q)
+			return 0;
+
+		b = q;
+		while(b > start && *(b - 1) == '\\')
+			--b;
+		if(((q - b) & 1) == 0)  // not escaped
+		{
+			hasEscapes = memchr(start, '\\', q - start) != 0;
+			return q;
+		}
+		p = q + 1;
+	}
+	return 0;
+}  // end findJSONStringEnd()
+
+// decodeJSONString
+//	Decodes [begin, end) into out, reusing the capacity of out.
+//	Same entity handling as restoreJSONStringEntities().
+inline void decodeJSONString(const char* begin, const char* end, bool hasEscapes, std::string& out)
+{
+	if(!hasEscapes)
+	{
+		out.assign(begin, end);
+		return;
+	}
+
+	out.clear();
+	out.reserve(end - begin);
+	for(const char* p = begin; p < end; ++p)
+	{
+		if(*p == '\\' && p + 1 < end)
+			switch(p[1])
+			{
+			case 'n':
+				out += '\n';
+				++p;
+				continue;
+			case '"':
+				out += '"';
+				++p;
+				continue;
+			case 't':
+				out += '\t';
+				++p;
+				continue;
+			case 'r':
+				out += '\r';
+				++p;
+				continue;
+			case '\\':
+				out += '\\';
+				++p;
+				continue;
+			default:;
+			}
+		out += *p;
+	}
+}  // end decodeJSONString()
+
+// skipJSONValue
+//	Returns pointer after the value starting at p, or 0 on malformed value.
+inline const char* skipJSONValue(const char* p, const char* end)
+{
+	bool hasEscapes;
+	if(p >= end)
+		return 0;
+
+	if(*p == '"')
+	{
+		p = findJSONStringEnd(p + 1, end, hasEscapes);
+		return p ? p + 1 : 0;
+	}
+
+	if(*p == '{' || *p == '[')
+	{
+		unsigned int depth = 0;
+		for(; p < end; ++p)
+		{
+			if(*p == '"')
+			{
+				p = findJSONStringEnd(p + 1, end, hasEscapes);
+				if(!p)
+					return 0;
+			}
+			else if(*p == '{' || *p == '[')
+				++depth;
+			else if((*p == '}' || *p == ']') && --depth == 0)
+				return p + 1;
+		}
+		return 0;
+	}
+
+	// number or literal
+	while(p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+		++p;
+	return p;
+}  // end skipJSONValue()
+
+// extractJSONValue
+//	Decodes the string or number value starting at p into out.
+//	Returns pointer after the value, or 0 on malformed or nested value.
+inline const char* extractJSONValue(const char* p, const char* end, std::string& out)
+{
+	bool hasEscapes;
+	if(p >= end || *p == '{' || *p == '[')
+		return 0;
+
+	if(*p == '"')
+	{
+		const char* q = findJSONStringEnd(p + 1, end, hasEscapes);
+		if(!q)
+			return 0;
+		decodeJSONString(p + 1, q, hasEscapes, out);
+		return q + 1;
+	}
+
+	const char* q = skipJSONValue(p, end);
+	out.assign(p, q);
+	return q;
+}  // end extractJSONValue()
+
+}  // end anonymous namespace
+
+//==============================================================================
+// findColForJSONKey
+//	Returns the column matching the JSON DATA_SET key, or INVALID.
+//	Exact storage name match is tried first, then the same loose match as
+//	fillFromJSONLegacy() (ignoring '_').
+//	Search starts at startingCol, since data is expected in column order.
+unsigned int TableView::findColForJSONKey(const std::string& key, unsigned int startingCol) const
+{
+	const unsigned int noc = getNumberOfColumns();
+	unsigned int       col;
+
+	for(unsigned int ccnt = 0; ccnt < noc; ++ccnt)
+	{
+		col = (ccnt + startingCol) % noc;
+		if(columnsInfo_[col].getStorageName() == key)
+			return col;
+	}
+
+	// same matching as fillFromJSONLegacy()
+	const std::string COMMENT_ALT_KEY = "COMMENT";
+	bool              keyIsMatch, keyIsComment;
+	unsigned int      keyIsMatchIndex, keyIsMatchStorageIndex, keyIsMatchCommentIndex;
+	for(unsigned int ccnt = 0; ccnt < noc; ++ccnt)
+	{
+		col = (ccnt + startingCol) % noc;
+
+		keyIsMatch   = true;
+		keyIsComment = true;
+		for(keyIsMatchIndex = 0, keyIsMatchStorageIndex = 0, keyIsMatchCommentIndex = 0; keyIsMatchIndex < key.size(); ++keyIsMatchIndex)
+		{
+			if(columnsInfo_[col].getStorageName()[keyIsMatchStorageIndex] == '_')
+				++keyIsMatchStorageIndex;  // skip to next storage character
+			if(key[keyIsMatchIndex] == '_')
+				continue;  // skip to next character
+
+			// match to storage name
+			if(keyIsMatchStorageIndex >= columnsInfo_[col].getStorageName().size() ||
+			   key[keyIsMatchIndex] != columnsInfo_[col].getStorageName()[keyIsMatchStorageIndex])
+			{
+				// size mismatch or character mismatch
+				keyIsMatch = false;
+				if(!keyIsComment)
+					break;
+			}
+
+			// check also if alternate comment is matched
+			if(keyIsComment && keyIsMatchCommentIndex < COMMENT_ALT_KEY.size())
+			{
+				if(key[keyIsMatchIndex] != COMMENT_ALT_KEY[keyIsMatchCommentIndex])
+					keyIsComment = false;  // character mismatch with COMMENT
+			}
+
+			++keyIsMatchStorageIndex;  // go to next character
+		}
+
+		if(keyIsMatch || keyIsComment)
+			return col;
+	}
+	return TableView::INVALID;
+}  // end findColForJSONKey()
+
+//==============================================================================
+// fillFromJSONSinglePass
+//	Scans the JSON document once, decoding values directly into the data view.
+//	DATA_SET is expected as an array of row objects (as written by printJSON()).
+//	Column lookup is memoized by key position within the row object, and the
+//	data view is reserved based on the size of the first row.
+//
+//	Returns JSON_FILL_FALLBACK for document structures that are not handled,
+//		in which case the caller should use fillFromJSONLegacy().
+int TableView::fillFromJSONSinglePass(const std::string& json)
+{
+	sourceColumnMismatchCount_ = 0;
+	sourceColumnMissingCount_  = 0;
+	sourceColumnNames_.clear();  // reset
+
+	const unsigned int noc = getNumberOfColumns();
+	const char*        p   = json.data();
+	const char*        end = p + json.size();
+	const char*        q;
+	const char*        rowStart;
+	bool               hasEscapes;
+	std::string        key, val;
+
+	// column by key position in row object, to skip key matching after first row
+	std::vector<std::pair<std::string /*key*/, unsigned int /*col*/>> keyColCache;
+
+	const std::vector<std::string> emptyRow(noc);
+	const std::vector<std::string>& defaultRow = rowDefaultValues_.size() == noc ? rowDefaultValues_ : emptyRow;
+
+	p = skipJSONWhitespace(p, end);
+	if(p >= end || *p != '{')
+		return TableView::JSON_FILL_FALLBACK;
+	++p;
+
+	// depth 1 keys
+	while(1)
+	{
+		p = skipJSONWhitespace(p, end);
+		if(p < end && *p == '}')
+			break;  // end of document
+		if(p >= end || *p != '"' || !(q = findJSONStringEnd(p + 1, end, hasEscapes)))
+			return TableView::JSON_FILL_FALLBACK;
+		decodeJSONString(p + 1, q, hasEscapes, key);
+
+		p = skipJSONWhitespace(q + 1, end);
+		if(p >= end || *p != ':')
+			return TableView::JSON_FILL_FALLBACK;
+		p = skipJSONWhitespace(p + 1, end);
+		if(p >= end)
+			return TableView::JSON_FILL_FALLBACK;
+
+		if(key == "DATA_SET")
+		{
+			if(*p != '[' || noc == 0)
+				return TableView::JSON_FILL_FALLBACK;
+			++p;
+
+			unsigned int colFoundCount = 0;
+			unsigned int row, col, keyIndex;
+			while(1)  // rows
+			{
+				p = skipJSONWhitespace(p, end);
+				if(p < end && *p == ']')
+				{
+					++p;
+					break;  // end of DATA_SET
+				}
+				if(p >= end || *p != '{')
+					return TableView::JSON_FILL_FALLBACK;
+				rowStart = p++;
+
+				row = getNumberOfRows();
+				if(row)  // same accounting as fillFromJSONLegacy(), counted when the next row starts
+					sourceColumnMissingCount_ += noc - colFoundCount;
+				colFoundCount = 0;
+				theDataView_.push_back(defaultRow);
+
+				keyIndex = 0;
+				while(1)  // columns
+				{
+					p = skipJSONWhitespace(p, end);
+					if(p < end && *p == '}')
+					{
+						++p;
+						break;  // end of row
+					}
+					if(p >= end || *p != '"' || !(q = findJSONStringEnd(p + 1, end, hasEscapes)))
+						return TableView::JSON_FILL_FALLBACK;
+					decodeJSONString(p + 1, q, hasEscapes, key);
+
+					p = skipJSONWhitespace(q + 1, end);
+					if(p >= end || *p != ':')
+						return TableView::JSON_FILL_FALLBACK;
+					p = skipJSONWhitespace(p + 1, end);
+
+					if(fillWithLooseColumnMatching_)
+					{
+						// loose column matching makes no attempt to match the column names,
+						//	just assumes the data is in the correct order
+						if(keyIndex >= noc)
+							return TableView::JSON_FILL_FALLBACK;
+						col = keyIndex;
+					}
+					else if(keyIndex < keyColCache.size() && keyColCache[keyIndex].first == key)
+						col = keyColCache[keyIndex].second;
+					else
+					{
+						col = findColForJSONKey(key, keyIndex % noc);
+						if(keyIndex >= keyColCache.size())
+							keyColCache.resize(keyIndex + 1);
+						keyColCache[keyIndex].first  = key;
+						keyColCache[keyIndex].second = col;
+					}
+
+					if(row == 0)  // only for first row, track source column names
+						sourceColumnNames_.emplace(key);
+
+					if(col == TableView::INVALID)
+					{
+						if(row == 0)
+							__COUT__ << "Invalid column in JSON source data: " << key << " not found in column names of table named " << getTableName()
+							         << ". Trying to ignore error, and not populating missing column." << __E__;
+						++sourceColumnMismatchCount_;  // but count errors
+						p = skipJSONValue(p, end);
+					}
+					else
+					{
+						p = extractJSONValue(p, end, theDataView_[row][col]);
+						++colFoundCount;
+					}
+					if(!p)
+						return TableView::JSON_FILL_FALLBACK;
+					++keyIndex;
+
+					p = skipJSONWhitespace(p, end);
+					if(p < end && *p == ',')
+						++p;
+					else if(p >= end || *p != '}')
+						return TableView::JSON_FILL_FALLBACK;
+				}  // end column loop
+
+				// rows with no matching columns are not created by the legacy parser
+				if(!fillWithLooseColumnMatching_ && colFoundCount == 0)
+					return TableView::JSON_FILL_FALLBACK;
+
+				// reserve rows based on the size of the first row
+				if(row == 0 && p > rowStart)
+					theDataView_.reserve(1 + (end - p) / (p - rowStart));
+
+				p = skipJSONWhitespace(p, end);
+				if(p < end && *p == ',')
+					++p;
+				else if(p >= end || *p != ']')
+					return TableView::JSON_FILL_FALLBACK;
+			}  // end row loop
+		}
+		else if(*p == '{' || *p == '[')  // e.g. COL_TYPES, not needed
+		{
+			if(!(p = skipJSONValue(p, end)))
+				return TableView::JSON_FILL_FALLBACK;
+		}
+		else
+		{
+			if(!(p = extractJSONValue(p, end, val)))
+				return TableView::JSON_FILL_FALLBACK;
+
+			if(key == "NAME")
+			{
+				// table name is constant, set by parent TableBase, so check for consistency, and show warning
+				if(val != getTableName() &&
+				   getTableName() != "TABLE_GROUP_METADATA")  // allow metadata table to be illegal, since it is created by ConfigurationManager.cc
+					__COUT_WARN__ << "JSON-fill Table name mismatch: " << val << " vs " << getTableName() << __E__;
+			}
+			else if(key == "COMMENT")
+				setComment(val);
+			else if(key == "AUTHOR")
+				setAuthor(val);
+			else if(key == "CREATION_TIME")
+				setCreationTime(strtol(val.c_str(), 0, 10));
+		}
+
+		p = skipJSONWhitespace(p, end);
+		if(p < end && *p == ',')
+			++p;
+		else if(p >= end || *p != '}')
+			return TableView::JSON_FILL_FALLBACK;
+	}  // end depth 1 key loop
+
+	if(!fillWithLooseColumnMatching_ && sourceColumnMissingCount_ > 0)
+	{
+		__COUTV__(sourceColumnMissingCount_);
+		__SS__ << "Can not ignore errors because not every column was found in the source data!"
+		       << ". Please see the details below:\n\n"
+		       << getMismatchColumnInfo() << StringMacros::stackTrace();
+		__SS_ONLY_THROW__;
+	}
+
+	return 0;  // success
+}  // end fillFromJSONSinglePass()
 
 //==============================================================================
 std::string TableView::getMismatchColumnInfo(void) const
@@ -2778,6 +3222,52 @@ std::string TableView::getMismatchColumnInfo(void) const
 	return ss.str();
 }  // end getMismatchColumnInfo()
 
+//==============================================================================
+// getContentHash
+//	FNV-1a hash over the source column names and the data cells, order-sensitive,
+//	ignoring the last two columns (author and timestamp) as does
+//	TableBase::checkForDuplicate(). Each string is length-prefixed so that
+//	shifted content between neighboring cells can not alias.
+//	Equal hashes do not guarantee equal content; callers must still compare cells.
+uint64_t TableView::getContentHash(void) const
+{
+	const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+	const uint64_t FNV_PRIME        = 1099511628211ULL;
+
+	uint64_t hash = FNV_OFFSET_BASIS;
+
+	auto hashBytes = [&hash](const void* data, size_t size) {
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for(size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+	};
+	auto hashString = [&hashBytes](const std::string& str) {
+		uint64_t size = str.size();
+		hashBytes(&size, sizeof(size));
+		hashBytes(str.data(), str.size());
+	};
+
+	uint64_t count = sourceColumnNames_.size();
+	hashBytes(&count, sizeof(count));
+	for(const auto& colName : sourceColumnNames_)
+		hashString(colName);
+
+	unsigned int cols = getDataColumnSize();
+	count             = getNumberOfRows();
+	hashBytes(&count, sizeof(count));
+	count = cols;
+	hashBytes(&count, sizeof(count));
+
+	for(const auto& rowData : theDataView_)
+		for(unsigned int col = 0; col + 2 < cols && col < rowData.size(); ++col)  // do not consider author and timestamp
+			hashString(rowData[col]);
+
+	return hash;
+}  // end getContentHash()
+
 //==============================================================================
 bool TableView::isURIEncodedCommentTheSame(const std::string& comment) const
 {
@@ -2843,6 +3333,7 @@ bool TableView::isURIEncodedCommentTheSame(const std::string& comment) const
 //
 int TableView::fillFromCSV(const std::string& data, const int& dataOffset, const std::string& author)
 {
+	++contentChangeCount_;
 	int retVal = 0;
 
 	int r = dataOffset;
@@ -2974,6 +3465,7 @@ int TableView::fillFromCSV(const std::string& data, const int& dataOffset, const
 // timestamp
 bool TableView::setURIEncodedValue(const std::string& value, const unsigned int& r, const unsigned int& c, const std::string& author)
 {
+	++contentChangeCount_;
 	if(!(c < columnsInfo_.size() && r < getNumberOfRows()))
 	{
 		__SS__ << "Invalid row (" << (int)r << ") col (" << (int)c << ") requested!"
@@ -3045,6 +3537,7 @@ bool TableView::setURIEncodedValue(const std::string& value, const unsigned int&
 //==============================================================================
 void TableView::resizeDataView(unsigned int nRows, unsigned int nCols)
 {
+	++contentChangeCount_;
 	// FIXME This maybe should disappear but I am using it in ConfigurationHandler
 	// still...
 	theDataView_.resize(nRows, std::vector<std::string>(nCols));
@@ -3066,6 +3559,7 @@ unsigned int TableView::addRow(const std::string& author,
 							   std::string 		  childLinkIndex /* = "" */,
 							   std::string 		  groupId /* = "" */)
 {
+	++contentChangeCount_;
 	// default to last row
 	if(rowToAdd == (unsigned int)-1)
 		rowToAdd = getNumberOfRows();
@@ -3136,6 +3630,7 @@ unsigned int TableView::addRow(const std::string& author,
 //	throws exception on failure
 void TableView::deleteRow(int r)
 {
+	++contentChangeCount_;
 	if(r >= (int)getNumberOfRows())
 	{
 		// out of bounds
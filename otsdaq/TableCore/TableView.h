@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <time.h> /* time_t, time, ctime */
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <set>
 #include <vector>
@@ -21,6 +22,7 @@ class TableView
 {
   public:
 	static const unsigned int                      					INVALID;
+	static const int                      							JSON_FILL_FALLBACK;  // fillFromJSONSinglePass() return value for unhandled document structure
 	typedef std::vector<std::vector<std::string> > 					DataView;
 	typedef DataView::iterator                     					iterator;
 	typedef DataView::const_iterator               					const_iterator;
@@ -85,6 +87,8 @@ class TableView
 	std::set<std::string /*storage name*/>      getColumnStorageNames		(void) const;
 	const std::vector<std::string /*per col*/>& getDefaultRowValues			(void) const { return rowDefaultValues_; }
 	std::string									getMismatchColumnInfo		(void) const;
+	uint64_t									getContentHash				(void) const;  // over source column names and data, ignoring author and timestamp columns
+	unsigned long								getContentChangeCount		(void) const { return contentChangeCount_; }  // incremented by every call that may modify the data, e.g. to validate a cached content hash
 
 	unsigned int       							getNumberOfRows				(void) const { return theDataView_.size(); }
 	unsigned int       							getNumberOfColumns			(void) const { return columnsInfo_.size(); }
@@ -199,7 +203,7 @@ public:
 																			 std::string 		  childLinkIndex = "", //to allow for handling TableViewColumnInfo::TYPE_UNIQUE_GROUP_DATA
 							   												 std::string 		  groupId = "");
 	void 										deleteRow					(int r);
-	void 										deleteAllRows				(void) {theDataView_.clear();}
+	void 										deleteAllRows				(void) {++contentChangeCount_; theDataView_.clear();}
 
 
 	// Lore did not like this.. wants special access through separate Supervisor for
@@ -207,14 +211,15 @@ public:
 	// std::string viewType); //returns index of added column, always is last column
 	// unless
 
-	iterator       								begin						(void) { return theDataView_.begin(); }
-	iterator       								end							(void) { return theDataView_.end(); }
+	iterator       								begin						(void) { ++contentChangeCount_; return theDataView_.begin(); }
+	iterator       								end							(void) { ++contentChangeCount_; return theDataView_.end(); }
 	const_iterator 								begin						(void) const { return theDataView_.begin(); }
 	const_iterator 								end							(void) const { return theDataView_.end(); }
 	void           								reset						(void);
 	void           								print						(std::ostream& out = std::cout) const;
 	void           								printJSON					(std::ostream& out = std::cout) const;
 	int            								fillFromJSON				(const std::string& json);
+	int            								fillFromJSONLegacy			(const std::string& json);  // original character-by-character parser, kept as fallback and for benchmarking
 	int            								fillFromCSV					(const std::string& data,
 																			 const int&         dataOffset = 0,
 																			 const std::string& author     = "");
@@ -228,6 +233,8 @@ public:
 	unsigned int 								initColStatus				(void);
 	unsigned int 								initColPriority				(void);
 	const std::vector<std::string /*per col*/>&	initRowDefaults				(void);
+	int            								fillFromJSONSinglePass		(const std::string& json);
+	unsigned int 								findColForJSONKey			(const std::string& key, unsigned int startingCol) const;
 
 	TableView& 									operator=					(const TableView src);  // operator= is purposely undefined and
 														                                            // private (DO NOT USE IT!) - should use
@@ -250,6 +257,7 @@ public:
 	std::string														sourceRawData_;	
 	unsigned int          											sourceColumnMismatchCount_, sourceColumnMissingCount_;
 	std::set<std::string> 											sourceColumnNames_;
+	unsigned long 													contentChangeCount_;  		// incremented by every call that may modify the data or source column names
 
 	std::vector<TableViewColumnInfo> 								columnsInfo_;
 	DataView                         								theDataView_;
@@ -0,0 +1,199 @@
+#define BOOST_TEST_MODULE (nodecache test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "otsdaq/ConfigurationInterface/ConfigurationManager.h"
+#include "otsdaq/ConfigurationInterface/ConfigurationTree.h"
+#include "otsdaq/TableCore/TableBase.h"
+
+using namespace ots;
+
+//==============================================================================
+// setupTable
+//	activates version 1 of the table, with UID, value, comment, author and timestamp
+//	columns, filled with the given rows of UID and value
+void setupTable(TableBase& table, const std::vector<std::pair<std::string, std::string>>& rows)
+{
+	std::string                       capturedExceptionString;
+	std::vector<TableViewColumnInfo>* colInfo = table.getMockupViewP()->getColumnsInfoP();
+	colInfo->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_UID, "Name", "NAME", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	colInfo->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_DATA, "Value", "VALUE", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	colInfo->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_COMMENT,
+	                                       TableViewColumnInfo::COL_NAME_COMMENT,
+	                                       "COMMENT_DESCRIPTION",
+	                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                       0,
+	                                       "",
+	                                       0,
+	                                       0,
+	                                       &capturedExceptionString));
+	colInfo->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_AUTHOR,
+	                                       TableViewColumnInfo::COL_NAME_AUTHOR,
+	                                       "AUTHOR",
+	                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                       0,
+	                                       "",
+	                                       0,
+	                                       0,
+	                                       &capturedExceptionString));
+	colInfo->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_TIMESTAMP,
+	                                       TableViewColumnInfo::COL_NAME_CREATION,
+	                                       "RECORD_INSERTION_TIME",
+	                                       TableViewColumnInfo::DATATYPE_TIME,
+	                                       0,
+	                                       "",
+	                                       0,
+	                                       0,
+	                                       &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	table.getMockupViewP()->init();
+
+	table.setupMockupView(TableVersion(1));
+	TableView* view = table.getViewP(TableVersion(1));
+	view->resizeDataView(rows.size(), view->getNumberOfColumns());
+	for(unsigned int row = 0; row < rows.size(); ++row)
+	{
+		view->setValueAsString(rows[row].first, row, 0);
+		view->setValueAsString(rows[row].second, row, 1);
+		view->setValueAsString("", row, 2);
+		view->setValueAsString("tester", row, 3);
+		view->setValueAsString("1700000000", row, 4);
+	}
+	view->init();
+	BOOST_REQUIRE(table.setActiveView(TableVersion(1)));
+}  // end setupTable()
+
+//==============================================================================
+// renameUID
+//	renames a record in place, without an active view change, so that only
+//	a cached node can still be found by the old UID
+void renameUID(TableBase& table, const std::string& uid, const std::string& newUID)
+{
+	TableView* view = table.getViewP();
+	view->setValueAsString(newUID, view->findRow(view->getColUID(), uid), view->getColUID());
+}  // end renameUID()
+
+BOOST_AUTO_TEST_SUITE(nodecache_test)
+
+// the ConfigurationManager node cache is dropped whenever the active view change count moves
+BOOST_AUTO_TEST_CASE(active_view_change_count)
+{
+	TableBase   table(true /*special table*/, "NodeCacheTestTable");
+	std::string capturedExceptionString;
+	table.getMockupViewP()->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_UID, "Name", "NAME", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	table.setupMockupView(TableVersion(1));
+
+	unsigned long count = TableBase::getActiveViewChangeCount();
+
+	table.setActiveView(TableVersion(1));
+	BOOST_CHECK(TableBase::getActiveViewChangeCount() > count);
+	count = TableBase::getActiveViewChangeCount();
+
+	// re-activating the same version must also invalidate (e.g. initializeFromFhicl() defaults)
+	table.setActiveView(TableVersion(1));
+	BOOST_CHECK(TableBase::getActiveViewChangeCount() > count);
+	count = TableBase::getActiveViewChangeCount();
+
+	table.deactivate();
+	BOOST_CHECK(TableBase::getActiveViewChangeCount() > count);
+	count = TableBase::getActiveViewChangeCount();
+
+	// reading the table does not invalidate
+	table.isActive();
+	table.getStoredVersions();
+	BOOST_CHECK_EQUAL(TableBase::getActiveViewChangeCount(), count);
+}
+
+// multi-part paths are resolved once, then served from the cache
+BOOST_AUTO_TEST_CASE(get_node_cache_hit_and_miss)
+{
+	ConfigurationManager cfgMgr(true /*initForWriteAccess, skips loading from the database*/);
+	cfgMgr.setNodeCacheEnabled(true);
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "NodeCacheTestTable");  // skips table info
+	setupTable(table, {{"uid0", "0"}, {"uid1", "1"}});
+
+	ConfigurationTree tableNode(&cfgMgr, &table);
+
+	// miss, resolved and cached
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid0/Value").getValueAsString(), "0");
+
+	renameUID(table, "uid0", "uidX");
+
+	// hit, the cached node is returned without resolving the renamed record
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid0/Value").getValueAsString(), "0");
+	BOOST_CHECK_EQUAL(tableNode.getNode(ConfigurationTree::NodePath("uid0/Value")).getValueAsString(), "0");
+
+	// misses are resolved from the current view
+	BOOST_CHECK_EQUAL(tableNode.getNode("uidX/Value").getValueAsString(), "0");
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid1/Value").getValueAsString(), "1");
+	BOOST_CHECK_THROW(tableNode.getNode("uid0/Comment"), std::runtime_error);
+
+	// single-part paths are never cached
+	BOOST_CHECK_THROW(tableNode.getNode("uid0"), std::runtime_error);
+
+	// nothing is cached when the cache is disabled
+	cfgMgr.setNodeCacheEnabled(false);
+	BOOST_CHECK_THROW(tableNode.getNode("uid0/Value"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(get_node_cache_invalidated_on_set_active_view)
+{
+	ConfigurationManager cfgMgr(true /*initForWriteAccess, skips loading from the database*/);
+	cfgMgr.setNodeCacheEnabled(true);
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "NodeCacheTestTable");  // skips table info
+	setupTable(table, {{"uid0", "0"}});
+
+	ConfigurationTree tableNode(&cfgMgr, &table);
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid0/Value").getValueAsString(), "0");
+
+	renameUID(table, "uid0", "uidX");
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid0/Value").getValueAsString(), "0");
+
+	// re-activating the same version drops the cached node
+	BOOST_REQUIRE(table.setActiveView(TableVersion(1)));
+	BOOST_CHECK_THROW(tableNode.getNode("uid0/Value"), std::runtime_error);
+	BOOST_CHECK_EQUAL(tableNode.getNode("uidX/Value").getValueAsString(), "0");
+}
+
+BOOST_AUTO_TEST_CASE(get_node_cache_invalidated_on_deactivate)
+{
+	ConfigurationManager cfgMgr(true /*initForWriteAccess, skips loading from the database*/);
+	cfgMgr.setNodeCacheEnabled(true);
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "NodeCacheTestTable");  // skips table info
+	setupTable(table, {{"uid0", "0"}});
+
+	ConfigurationTree tableNode(&cfgMgr, &table);
+	BOOST_CHECK_EQUAL(tableNode.getNode("uid0/Value").getValueAsString(), "0");
+
+	renameUID(table, "uid0", "uidX");
+
+	// deactivating any table drops the cached node
+	//	Note: the node still holds the (still stored) view, so it resolves from it
+	TableBase otherTable(TableBase::GROUP_CACHE_PREPEND + "NodeCacheOtherTable");
+	otherTable.deactivate();
+	BOOST_CHECK_THROW(tableNode.getNode("uid0/Value"), std::runtime_error);
+	BOOST_CHECK_EQUAL(tableNode.getNode("uidX/Value").getValueAsString(), "0");
+}
+
+BOOST_AUTO_TEST_CASE(node_path_parts)
+{
+	ConfigurationTree::NodePath path("//uid/LinkToTable//col/");
+	BOOST_CHECK_EQUAL(path.getPath(), "//uid/LinkToTable//col/");
+	BOOST_REQUIRE_EQUAL(path.getNodeNames().size(), 3u);
+	BOOST_CHECK_EQUAL(path.getNodeNames()[0], "uid");
+	BOOST_CHECK_EQUAL(path.getNodeNames()[1], "LinkToTable");
+	BOOST_CHECK_EQUAL(path.getNodeNames()[2], "col");
+
+	BOOST_CHECK_EQUAL(ConfigurationTree::NodePath("/").getNodeNames().size(), 0u);
+	BOOST_CHECK_EQUAL(ConfigurationTree::NodePath("uid").getNodeNames().size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+#define BOOST_TEST_MODULE (tablehash test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "otsdaq/TableCore/TableBase.h"
+#include "otsdaq/TableCore/TableView.h"
+
+using namespace ots;
+
+//==============================================================================
+// addColumns
+//	adds UID, value, comment, author and timestamp columns to the view, and
+//	initializes it to set up the source column names
+void addColumns(TableView* view)
+{
+	std::string capturedExceptionString;
+
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_UID, "Name", "NAME", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_DATA, "Value", "VALUE", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_COMMENT,
+	                                                       TableViewColumnInfo::COL_NAME_COMMENT,
+	                                                       "COMMENT_DESCRIPTION",
+	                                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_AUTHOR,
+	                                                       TableViewColumnInfo::COL_NAME_AUTHOR,
+	                                                       "AUTHOR",
+	                                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_TIMESTAMP,
+	                                                       TableViewColumnInfo::COL_NAME_CREATION,
+	                                                       "RECORD_INSERTION_TIME",
+	                                                       TableViewColumnInfo::DATATYPE_TIME,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	view->init();  // sets up the source column names
+}  // end addColumns()
+
+//==============================================================================
+// fillView
+//	replaces the data of the view with the given rows of UID and value
+void fillView(TableView*                                              view,
+              const std::vector<std::pair<std::string, std::string>>& rows,
+              const std::string&                                      author    = "tester",
+              const std::string&                                      timestamp = "1700000000")
+{
+	view->resizeDataView(rows.size(), view->getNumberOfColumns());
+	for(unsigned int row = 0; row < rows.size(); ++row)
+	{
+		view->setValueAsString(rows[row].first, row, 0);
+		view->setValueAsString(rows[row].second, row, 1);
+		view->setValueAsString("", row, 2);
+		view->setValueAsString(author, row, 3);
+		view->setValueAsString(timestamp, row, 4);
+	}
+	view->init();  // verifies the data, as when loading a version
+}  // end fillView()
+
+//==============================================================================
+// makeView
+//	returns a stand-alone view filled with the given rows of UID and value
+std::unique_ptr<TableView> makeView(const std::vector<std::pair<std::string, std::string>>& rows,
+                                    const std::string&                                      author    = "tester",
+                                    const std::string&                                      timestamp = "1700000000")
+{
+	std::unique_ptr<TableView> view(new TableView("HashTestTable"));
+	addColumns(view.get());
+	fillView(view.get(), rows, author, timestamp);
+	return view;
+}  // end makeView()
+
+//==============================================================================
+// addVersion
+//	adds a persistent version of the table filled with the given rows of UID and value
+void addVersion(TableBase& table, TableVersion version, const std::vector<std::pair<std::string, std::string>>& rows)
+{
+	table.setupMockupView(version);
+	fillView(table.getViewP(version), rows);
+}  // end addVersion()
+
+//==============================================================================
+// addNeedle
+//	returns a temporary version of the table filled with the given rows of UID and value,
+//	to search for with TableBase::checkForDuplicate()
+TableVersion addNeedle(TableBase& table, const std::vector<std::pair<std::string, std::string>>& rows)
+{
+	TableVersion temporaryVersion = table.createTemporaryView();
+	fillView(table.getViewP(temporaryVersion), rows, "other", "1800000000");
+	return temporaryVersion;
+}  // end addNeedle()
+
+BOOST_AUTO_TEST_SUITE(tablehash_test)
+
+// persistent view hashes are cached by TableBase for checkForDuplicate()
+BOOST_AUTO_TEST_CASE(duplicate_found_by_hash)
+{
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "HashTestTable");  // skips table info, and caches more than one view
+	addColumns(table.getMockupViewP());
+	addVersion(table, TableVersion(1), {{"uid0", "1"}});
+	addVersion(table, TableVersion(2), {{"uid0", "2"}});
+
+	// repeated checks use the cached hashes of the persistent versions
+	for(unsigned int i = 0; i < 2; ++i)
+	{
+		BOOST_CHECK_EQUAL(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})), TableVersion(2));
+		BOOST_CHECK_EQUAL(table.checkForDuplicate(addNeedle(table, {{"uid0", "1"}})), TableVersion(1));
+		BOOST_CHECK(table.checkForDuplicate(addNeedle(table, {{"uid0", "3"}})).isInvalid());
+	}
+
+	// the ignore version is skipped
+	BOOST_CHECK(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}}), TableVersion(2)).isInvalid());
+}
+
+// a view modified through a pointer retained from before the hash was cached is rehashed
+BOOST_AUTO_TEST_CASE(hash_refreshed_after_modification)
+{
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "HashTestTable");  // skips table info, and caches more than one view
+	addColumns(table.getMockupViewP());
+	addVersion(table, TableVersion(1), {{"uid0", "1"}});
+
+	TableView* retainedView = table.getViewP(TableVersion(1));
+
+	// caches the hash of version 1
+	BOOST_CHECK(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})).isInvalid());
+
+	retainedView->setValueAsString("2", 0, 1);
+	BOOST_CHECK_EQUAL(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})), TableVersion(1));
+
+	retainedView->addRow();
+	BOOST_CHECK(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})).isInvalid());
+
+	retainedView->deleteRow(1);
+	BOOST_CHECK_EQUAL(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})), TableVersion(1));
+}
+
+// an erased version does not leave its hash behind for a new view of the same version
+BOOST_AUTO_TEST_CASE(hash_dropped_on_erase)
+{
+	TableBase table(TableBase::GROUP_CACHE_PREPEND + "HashTestTable");  // skips table info, and caches more than one view
+	addColumns(table.getMockupViewP());
+	addVersion(table, TableVersion(1), {{"uid0", "1"}});
+
+	// caches the hash of version 1
+	BOOST_CHECK(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})).isInvalid());
+
+	// same steps with different content, so the new view has the same change count
+	BOOST_CHECK(table.eraseView(TableVersion(1)));
+	addVersion(table, TableVersion(1), {{"uid0", "2"}});
+	BOOST_CHECK_EQUAL(table.checkForDuplicate(addNeedle(table, {{"uid0", "2"}})), TableVersion(1));
+}
+
+BOOST_AUTO_TEST_CASE(content_hash_equality)
+{
+	const uint64_t hash = makeView({{"uid0", "1"}, {"uid1", "2"}})->getContentHash();
+
+	// same content, repeatable
+	BOOST_CHECK_EQUAL(makeView({{"uid0", "1"}, {"uid1", "2"}})->getContentHash(), hash);
+
+	// author and timestamp are ignored, as in TableBase::checkForDuplicate()
+	BOOST_CHECK_EQUAL(makeView({{"uid0", "1"}, {"uid1", "2"}}, "other", "1800000000")->getContentHash(), hash);
+
+	// any cell change, row order, or row count changes the hash
+	BOOST_CHECK(makeView({{"uid0", "1"}, {"uid1", "3"}})->getContentHash() != hash);
+	BOOST_CHECK(makeView({{"uid1", "2"}, {"uid0", "1"}})->getContentHash() != hash);
+	BOOST_CHECK(makeView({{"uid0", "1"}})->getContentHash() != hash);
+
+	// content shifted between neighboring cells does not alias
+	BOOST_CHECK(makeView({{"uid0", "12"}, {"uid1", ""}})->getContentHash() != makeView({{"uid0", "1"}, {"uid1", "2"}})->getContentHash());
+	BOOST_CHECK(makeView({{"ab", "c"}})->getContentHash() != makeView({{"a", "bc"}})->getContentHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
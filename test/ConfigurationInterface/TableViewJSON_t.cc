@@ -0,0 +1,156 @@
+#define BOOST_TEST_MODULE (tableviewjson test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <memory>
+#include <string>
+
+#include "otsdaq/TableCore/TableView.h"
+
+using namespace ots;
+
+//==============================================================================
+// makeView
+//	returns an empty view with UID, number and string columns
+std::unique_ptr<TableView> makeView(void)
+{
+	std::unique_ptr<TableView> view(new TableView("JSONTestTable"));
+	std::string                capturedExceptionString;
+
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_UID, "Name", "NAME", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_DATA, "Value", "VALUE", TableViewColumnInfo::DATATYPE_NUMBER, 0, "", 0, 0, &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(
+	    TableViewColumnInfo::TYPE_DATA, "Label", "LABEL", TableViewColumnInfo::DATATYPE_STRING, 0, "", 0, 0, &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+
+	// required trailing columns
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_COMMENT,
+	                                                       TableViewColumnInfo::COL_NAME_COMMENT,
+	                                                       "COMMENT_DESCRIPTION",
+	                                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_AUTHOR,
+	                                                       TableViewColumnInfo::COL_NAME_AUTHOR,
+	                                                       "AUTHOR",
+	                                                       TableViewColumnInfo::DATATYPE_STRING,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+	view->getColumnsInfoP()->push_back(TableViewColumnInfo(TableViewColumnInfo::TYPE_TIMESTAMP,
+	                                                       TableViewColumnInfo::COL_NAME_CREATION,
+	                                                       "RECORD_INSERTION_TIME",
+	                                                       TableViewColumnInfo::DATATYPE_TIME,
+	                                                       0,
+	                                                       "",
+	                                                       0,
+	                                                       0,
+	                                                       &capturedExceptionString));
+	BOOST_REQUIRE_EQUAL(capturedExceptionString, "");
+
+	view->init();  // sets up the default row values
+	return view;
+}  // end makeView()
+
+// trailing comment, author and timestamp columns of each row
+const std::string ROW_TRAILER =
+    "\t\t\"COMMENT_DESCRIPTION\" : \"\",\n"
+    "\t\t\"AUTHOR\" : \"tester\",\n"
+    "\t\t\"RECORD_INSERTION_TIME\" : \"1700000000\"\n";
+
+// as written by TableView::printJSON()
+const std::string TEST_JSON =
+    "{\n"
+    "\"NAME\" : \"JSON_TEST_TABLE\",\n"
+    "\"COMMENT\" : \"line one\\nline \\\"two\\\"\",\n"
+    "\"AUTHOR\" : \"tester\",\n"
+    "\"CREATION_TIME\" : 1700000000,\n"
+    "\"COL_TYPES\" : {\n"
+    "\t\t\"NAME\" : \"STRING\",\n"
+    "\t\t\"VALUE\" : \"NUMBER\",\n"
+    "\t\t\"LABEL\" : \"STRING\"\n"
+    "},\n"
+    "\"DATA_SET\" : [\n"
+    "\t{\n"
+    "\t\t\"NAME\" : \"row0\",\n"
+    "\t\t\"VALUE\" : \"1\",\n"
+    "\t\t\"LABEL\" : \"plain\",\n" +
+    ROW_TRAILER +
+    "\t},\n"
+    "\t{\n"
+    "\t\t\"NAME\" : \"row1\",\n"
+    "\t\t\"VALUE\" : \"-2.5e3\",\n"
+    "\t\t\"LABEL\" : \"with \\\"quotes\\\", commas, and \\\\ backslash\",\n" +
+    ROW_TRAILER +
+    "\t},\n"
+    "\t{\n"
+    "\t\t\"NAME\" : \"row2\",\n"
+    "\t\t\"VALUE\" : \"0x1F\",\n"
+    "\t\t\"LABEL\" : \"\",\n" +
+    ROW_TRAILER +
+    "\t}\n"
+    "]\n"
+    "}";
+
+BOOST_AUTO_TEST_SUITE(tableviewjson_test)
+
+BOOST_AUTO_TEST_CASE(single_pass_matches_legacy)
+{
+	std::unique_ptr<TableView> legacyView = makeView(), singlePassView = makeView();
+
+	BOOST_REQUIRE_EQUAL(legacyView->fillFromJSONLegacy(TEST_JSON), 0);
+	BOOST_REQUIRE_EQUAL(singlePassView->fillFromJSON(TEST_JSON), 0);
+
+	BOOST_REQUIRE_EQUAL(singlePassView->getNumberOfRows(), 3u);
+	BOOST_CHECK(singlePassView->getDataView() == legacyView->getDataView());
+	BOOST_CHECK_EQUAL(singlePassView->getComment(), legacyView->getComment());
+	BOOST_CHECK_EQUAL(singlePassView->getAuthor(), "tester");
+	BOOST_CHECK_EQUAL(singlePassView->getCreationTime(), 1700000000);
+
+	BOOST_CHECK_EQUAL(singlePassView->getDataView()[1][1], "-2.5e3");
+	BOOST_CHECK_EQUAL(singlePassView->getDataView()[2][1], "0x1F");
+}
+
+BOOST_AUTO_TEST_CASE(whitespace_after_number)
+{
+	// the legacy parser read a number followed by whitespace as empty,
+	//	the single-pass parser keeps the number
+	const std::string json =
+	    "{ \"NAME\" : \"JSONTestTable\", \"CREATION_TIME\" : 1700000000 ,\n"
+	    "\"DATA_SET\" : [ { \"NAME\" : \"row0\", \"VALUE\" : 42 , \"LABEL\" : \"a\", \"COMMENT_DESCRIPTION\" : \"\", \"AUTHOR\" : \"t\", \"RECORD_INSERTION_TIME\" : 0 },\n"
+	    "{ \"NAME\" : \"row1\", \"VALUE\" : 7\n, \"LABEL\" : \"b\", \"COMMENT_DESCRIPTION\" : \"\", \"AUTHOR\" : \"t\", \"RECORD_INSERTION_TIME\" : 0 } ] }";
+
+	std::unique_ptr<TableView> view = makeView();
+	BOOST_REQUIRE_EQUAL(view->fillFromJSON(json), 0);
+	BOOST_REQUIRE_EQUAL(view->getNumberOfRows(), 2u);
+	BOOST_CHECK_EQUAL(view->getDataView()[0][1], "42");
+	BOOST_CHECK_EQUAL(view->getDataView()[1][1], "7");
+	BOOST_CHECK_EQUAL(view->getCreationTime(), 1700000000);
+}
+
+BOOST_AUTO_TEST_CASE(unexpected_structure_falls_back)
+{
+	// DATA_SET as object of rows is not handled by the single-pass parser,
+	//	so fillFromJSON() must give the same result as the legacy parser
+	const std::string json =
+	    "{ \"NAME\" : \"JSONTestTable\",\n"
+	    "\"DATA_SET\" : { \"ROW\" : { \"NAME\" : \"row0\", \"VALUE\" : \"3\", \"LABEL\" : \"c\", \"COMMENT_DESCRIPTION\" : \"\", \"AUTHOR\" : \"t\", \"RECORD_INSERTION_TIME\" : \"0\" } } }";
+
+	std::unique_ptr<TableView> legacyView = makeView(), view = makeView();
+	int                        legacyRetVal = legacyView->fillFromJSONLegacy(json);
+	BOOST_CHECK_EQUAL(view->fillFromJSON(json), legacyRetVal);
+	BOOST_CHECK(view->getDataView() == legacyView->getDataView());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
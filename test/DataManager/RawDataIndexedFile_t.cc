@@ -0,0 +1,212 @@
+#define BOOST_TEST_MODULE (rawdataindexedfile test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "otsdaq/DataManager/RawDataIndexedFile.h"
+
+using namespace ots;
+
+namespace
+{
+const std::string FILE_HEADER = "file header";
+const std::string FILE_FOOTER = "file footer";
+
+//==============================================================================
+std::string getIndexedFilePath(const std::string& name)
+{
+	return "/tmp/RawDataIndexedFile_t_" + std::to_string(getpid()) + "_" + name + RawDataIndexedFile::FILE_EXTENSION;
+}  // end getIndexedFilePath()
+
+//==============================================================================
+// getPacket
+//	Packets of varying size and repetitive content (so they compress),
+//	distinct per packet number.
+std::string getPacket(uint64_t packetNumber)
+{
+	std::string packet = "packet " + std::to_string(packetNumber) + ":";
+	packet.append(packetNumber % 97 + 1, char('a' + packetNumber % 26));
+	return packet;
+}  // end getPacket()
+
+//==============================================================================
+// getPacketTime
+//	Packets are 10 ms apart, starting at t = 1000 ms.
+int64_t getPacketTime(uint64_t packetNumber) { return 1000 + packetNumber * 10; }
+
+//==============================================================================
+// writeIndexedFile
+//	Write numberOfPackets packets in blocks of about 256 bytes. If closeFile is
+//	false, the file is left as if the writer had stopped before close().
+void writeIndexedFile(const std::string& filePath, uint64_t numberOfPackets, bool compress, bool closeFile = true)
+{
+	std::filebuf file;
+	BOOST_REQUIRE(file.open(filePath, std::ios::out | std::ios::binary | std::ios::trunc));
+
+	RawDataIndexedFileWriter writer(256 /*blockSize*/, compress);
+	writer.open(&file);
+	std::ostream out(&writer);
+
+	out << FILE_HEADER;
+	writer.endFileHeader();
+	for(uint64_t i = 0; i < numberOfPackets; ++i)
+	{
+		out << getPacket(i);
+		writer.endPacket(getPacketTime(i));
+	}
+	BOOST_CHECK(out.good());
+	BOOST_CHECK_EQUAL(writer.getNumberOfPackets(), numberOfPackets);
+
+	if(closeFile)
+	{
+		out << FILE_FOOTER;
+		writer.close();
+	}
+	file.close();
+}  // end writeIndexedFile()
+
+//==============================================================================
+void checkPackets(RawDataIndexedFileReader& reader, uint64_t numberOfPackets)
+{
+	std::string packet;
+	for(uint64_t i = 0; i < numberOfPackets; ++i)
+	{
+		BOOST_REQUIRE(reader.readPacket(i, packet));
+		BOOST_CHECK_EQUAL(packet, getPacket(i));
+	}
+	BOOST_CHECK(!reader.readPacket(numberOfPackets, packet));
+
+	// random access, going back to an earlier block
+	BOOST_REQUIRE(reader.readPacket(numberOfPackets / 2, packet));
+	BOOST_CHECK_EQUAL(packet, getPacket(numberOfPackets / 2));
+	BOOST_REQUIRE(reader.readPacket(0, packet));
+	BOOST_CHECK_EQUAL(packet, getPacket(0));
+}  // end checkPackets()
+
+//==============================================================================
+void checkRoundTrip(bool compress)
+{
+	const uint64_t    NUMBER_OF_PACKETS = 200;
+	const std::string filePath          = getIndexedFilePath(compress ? "compressed" : "uncompressed");
+	writeIndexedFile(filePath, NUMBER_OF_PACKETS, compress);
+
+	RawDataIndexedFileReader reader(filePath);
+	BOOST_CHECK(reader.wasClosedCleanly());
+	BOOST_CHECK_EQUAL(reader.getFileHeader(), FILE_HEADER);
+	BOOST_CHECK_EQUAL(reader.getFileFooter(), FILE_FOOTER);
+	BOOST_CHECK_EQUAL(reader.getNumberOfPackets(), NUMBER_OF_PACKETS);
+	BOOST_REQUIRE_GT(reader.getBlockIndex().size(), 2u);
+
+	// blocks are contiguous in packet number and time
+	uint64_t nextPacketNumber = 0;
+	for(const auto& block : reader.getBlockIndex())
+	{
+		BOOST_CHECK_EQUAL(block.firstPacketNumber_, nextPacketNumber);
+		BOOST_CHECK_EQUAL(block.firstTimeMs_, getPacketTime(block.firstPacketNumber_));
+		BOOST_CHECK_EQUAL(block.lastTimeMs_, getPacketTime(block.firstPacketNumber_ + block.numberOfPackets_ - 1));
+		nextPacketNumber += block.numberOfPackets_;
+	}
+
+	checkPackets(reader, NUMBER_OF_PACKETS);
+
+	std::vector<std::string> packets;
+	reader.readBlock(1, packets);
+	BOOST_REQUIRE_EQUAL(packets.size(), reader.getBlockIndex()[1].numberOfPackets_);
+	BOOST_CHECK_EQUAL(packets[0], getPacket(reader.getBlockIndex()[1].firstPacketNumber_));
+	BOOST_CHECK_THROW(reader.readBlock(reader.getBlockIndex().size(), packets), std::runtime_error);
+
+	std::remove(filePath.c_str());
+}  // end checkRoundTrip()
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(rawdataindexedfile_test)
+
+//==============================================================================
+BOOST_AUTO_TEST_CASE(round_trip_compressed) { checkRoundTrip(true /*compress*/); }
+
+//==============================================================================
+BOOST_AUTO_TEST_CASE(round_trip_uncompressed) { checkRoundTrip(false /*compress*/); }
+
+//==============================================================================
+BOOST_AUTO_TEST_CASE(find_block)
+{
+	const uint64_t    NUMBER_OF_PACKETS = 200;
+	const std::string filePath          = getIndexedFilePath("find_block");
+	writeIndexedFile(filePath, NUMBER_OF_PACKETS, true /*compress*/);
+
+	RawDataIndexedFileReader reader(filePath);
+	const auto&              blockIndex = reader.getBlockIndex();
+
+	for(uint64_t i = 0; i < NUMBER_OF_PACKETS; i += 7)
+	{
+		size_t block = reader.findBlockByPacketNumber(i);
+		BOOST_REQUIRE_NE(block, RawDataIndexedFileReader::NOT_FOUND);
+		BOOST_CHECK_LE(blockIndex[block].firstPacketNumber_, i);
+		BOOST_CHECK_LT(i, blockIndex[block].firstPacketNumber_ + blockIndex[block].numberOfPackets_);
+
+		// the block of a packet is the first block with packets at or after its time
+		BOOST_CHECK_EQUAL(reader.findBlockByTime(getPacketTime(i)), block);
+	}
+	BOOST_CHECK_EQUAL(reader.findBlockByPacketNumber(NUMBER_OF_PACKETS), RawDataIndexedFileReader::NOT_FOUND);
+
+	BOOST_CHECK_EQUAL(reader.findBlockByTime(0), 0u);
+	BOOST_CHECK_EQUAL(reader.findBlockByTime(getPacketTime(NUMBER_OF_PACKETS - 1) + 1), RawDataIndexedFileReader::NOT_FOUND);
+
+	// a time between packets finds the block of the next packet
+	uint64_t firstOfBlock1 = blockIndex[1].firstPacketNumber_;
+	BOOST_CHECK_EQUAL(reader.findBlockByTime(getPacketTime(firstOfBlock1) - 5), 1u);
+
+	std::remove(filePath.c_str());
+}  // end find_block
+
+//==============================================================================
+BOOST_AUTO_TEST_CASE(not_closed_cleanly)
+{
+	const uint64_t    NUMBER_OF_PACKETS = 200;
+	const std::string filePath          = getIndexedFilePath("not_closed_cleanly");
+	writeIndexedFile(filePath, NUMBER_OF_PACKETS, true /*compress*/, false /*closeFile*/);
+
+	// append a partial block, as if the writer stopped mid-block
+	{
+		std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::app);
+		file.write("RAWB\1\0", 6);
+	}
+
+	// block headers are walked, and the packets of the last (unwritten) block are lost
+	RawDataIndexedFileReader reader(filePath);
+	BOOST_CHECK(!reader.wasClosedCleanly());
+	BOOST_CHECK_EQUAL(reader.getFileHeader(), FILE_HEADER);
+	BOOST_CHECK(reader.getFileFooter().empty());
+	BOOST_REQUIRE_GT(reader.getBlockIndex().size(), 0u);
+	uint64_t numberOfPackets = reader.getNumberOfPackets();
+	BOOST_CHECK_GT(numberOfPackets, 0u);
+	BOOST_CHECK_LT(numberOfPackets, NUMBER_OF_PACKETS);
+
+	checkPackets(reader, numberOfPackets);
+
+	std::remove(filePath.c_str());
+}  // end not_closed_cleanly
+
+//==============================================================================
+BOOST_AUTO_TEST_CASE(invalid_file)
+{
+	const std::string filePath = getIndexedFilePath("invalid_file");
+	{
+		std::ofstream file(filePath, std::ios::out | std::ios::binary);
+		file << "not a raw data indexed file";
+	}
+	BOOST_CHECK_THROW(RawDataIndexedFileReader reader(filePath), std::runtime_error);
+	std::remove(filePath.c_str());
+
+	BOOST_CHECK_THROW(RawDataIndexedFileReader reader(getIndexedFilePath("missing")), std::runtime_error);
+}  // end invalid_file
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+#define BOOST_TEST_MODULE (slowcontrolsarchive test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <unistd.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "otsdaq/FECore/FESlowControlsArchive.h"
+
+using namespace ots;
+
+namespace
+{
+const int64_t ANY_START_TIME = std::numeric_limits<int64_t>::min();
+const int64_t ANY_END_TIME   = std::numeric_limits<int64_t>::max();
+
+//==============================================================================
+std::string getArchiveFilePath(const std::string& name)
+{
+	return "/tmp/SlowControlsArchive_t_" + std::to_string(getpid()) + "_" + name + FESlowControlsArchive::FILE_EXTENSION;
+}  // end getArchiveFilePath()
+
+//==============================================================================
+std::vector<FESlowControlsArchive::channelInfo_t> getChannels(void)
+{
+	std::vector<FESlowControlsArchive::channelInfo_t> channels(2);
+	channels[0].name_      = "FE0:temperature";
+	channels[0].dataType_  = "double";
+	channels[0].sizeBytes_ = sizeof(double);
+	channels[0].sizeBits_  = 8 * sizeof(double);
+	channels[1].name_      = "FE0:status";
+	channels[1].dataType_  = "16b";
+	channels[1].sizeBytes_ = 2;
+	channels[1].sizeBits_  = 16;
+	return channels;
+}  // end getChannels()
+
+//==============================================================================
+template<class T>
+std::string toValue(T value)
+{
+	return std::string((const char*)&value, sizeof(value));
+}  // end toValue()
+
+//==============================================================================
+// writeArchive
+//	10 records, alternating channels, at t = 1000, 1100, ... 1900 ms,
+//	in blocks of 4 records (so 3 blocks)
+void writeArchive(const std::string& filePath)
+{
+	FESlowControlsArchive archive(filePath, getChannels(), 4 /*recordsPerBlock*/);
+	for(int i = 0; i < 10; ++i)
+	{
+		if(i % 2 == 0)
+			archive.addRecord(0, FESlowControlsArchive::RECORD_TYPE_VALUE, toValue(i * 1.5), 1000 + i * 100);
+		else
+			archive.addRecord(1, FESlowControlsArchive::RECORD_TYPE_VALUE, toValue((uint16_t)(0xAB00 + i)), 1000 + i * 100);
+	}
+	archive.addRecord(2 /*not in dictionary*/, FESlowControlsArchive::RECORD_TYPE_VALUE, toValue(1.), 1950);
+}  // end writeArchive()
+
+//==============================================================================
+std::vector<FESlowControlsArchive::record_t> extract(const std::string& filePath, const std::string& channelName, int64_t startTimeMs, int64_t endTimeMs)
+{
+	std::vector<FESlowControlsArchive::record_t> records;
+	FESlowControlsArchive::extract(filePath,
+	                               channelName,
+	                               startTimeMs,
+	                               endTimeMs,
+	                               [&records](const FESlowControlsArchive::channelInfo_t&, const FESlowControlsArchive::record_t& record) {
+		                               records.push_back(record);
+	                               });
+	return records;
+}  // end extract()
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(slowcontrolsarchive_test)
+
+BOOST_AUTO_TEST_CASE(dictionary_and_index)
+{
+	const std::string filePath = getArchiveFilePath("index");
+	writeArchive(filePath);
+
+	std::vector<FESlowControlsArchive::channelInfo_t> channels;
+	std::vector<FESlowControlsArchive::blockIndex_t>  blockIndex;
+	FESlowControlsArchive::readIndex(filePath, channels, blockIndex);
+
+	BOOST_REQUIRE_EQUAL(channels.size(), 2);
+	BOOST_CHECK_EQUAL(channels[0].name_, "FE0:temperature");
+	BOOST_CHECK_EQUAL(channels[0].dataType_, "double");
+	BOOST_CHECK_EQUAL((unsigned int)channels[0].sizeBytes_, 8);
+	BOOST_CHECK_EQUAL(channels[1].name_, "FE0:status");
+	BOOST_CHECK_EQUAL((unsigned int)channels[1].sizeBits_, 16);
+
+	BOOST_REQUIRE_EQUAL(blockIndex.size(), 3);
+	BOOST_CHECK_EQUAL(blockIndex[0].numberOfRecords_, 4);
+	BOOST_CHECK_EQUAL(blockIndex[0].firstTimeMs_, 1000);
+	BOOST_CHECK_EQUAL(blockIndex[0].lastTimeMs_, 1300);
+	BOOST_CHECK_EQUAL(blockIndex[2].numberOfRecords_, 2);
+	BOOST_CHECK_EQUAL(blockIndex[2].lastTimeMs_, 1900);
+
+	remove(filePath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(extract_round_trip)
+{
+	const std::string filePath = getArchiveFilePath("extract");
+	writeArchive(filePath);
+
+	// all channels, all times
+	std::vector<FESlowControlsArchive::record_t> records = extract(filePath, "", ANY_START_TIME, ANY_END_TIME);
+	BOOST_REQUIRE_EQUAL(records.size(), 10);
+	for(int i = 0; i < 10; ++i)
+	{
+		BOOST_CHECK_EQUAL(records[i].channelId_, (uint32_t)(i % 2));
+		BOOST_CHECK_EQUAL(records[i].timeMs_, 1000 + i * 100);
+	}
+
+	// one channel, values decode as written
+	std::vector<FESlowControlsArchive::channelInfo_t> channels = getChannels();
+	records                                                    = extract(filePath, "FE0:temperature", ANY_START_TIME, ANY_END_TIME);
+	BOOST_REQUIRE_EQUAL(records.size(), 5);
+	double value;
+	memcpy(&value, records[3].value_, sizeof(value));
+	BOOST_CHECK_EQUAL(value, 6 * 1.5);
+	BOOST_CHECK_EQUAL(FESlowControlsArchive::valueToString(channels[0], records[3]), "9");
+
+	records = extract(filePath, "FE0:status", ANY_START_TIME, ANY_END_TIME);
+	BOOST_REQUIRE_EQUAL(records.size(), 5);
+	BOOST_CHECK_EQUAL(FESlowControlsArchive::valueToString(channels[1], records[0]), "0x01ab");  // little-endian bytes
+
+	// time range is inclusive and spans blocks
+	records = extract(filePath, "", 1300, 1500);
+	BOOST_REQUIRE_EQUAL(records.size(), 3);
+	BOOST_CHECK_EQUAL(records.front().timeMs_, 1300);
+	BOOST_CHECK_EQUAL(records.back().timeMs_, 1500);
+
+	BOOST_CHECK(extract(filePath, "", 2000, 3000).empty());
+	BOOST_CHECK_THROW(extract(filePath, "FE0:missing", ANY_START_TIME, ANY_END_TIME), std::runtime_error);
+
+	remove(filePath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(not_closed_cleanly)
+{
+	const std::string filePath = getArchiveFilePath("truncated");
+	writeArchive(filePath);
+
+	// drop the block index and half of the last block, as if the writer was killed
+	std::vector<FESlowControlsArchive::channelInfo_t> channels;
+	std::vector<FESlowControlsArchive::blockIndex_t>  blockIndex;
+	FESlowControlsArchive::readIndex(filePath, channels, blockIndex);
+	BOOST_REQUIRE_EQUAL(blockIndex.size(), 3);
+	BOOST_REQUIRE_EQUAL(truncate(filePath.c_str(), blockIndex[2].offset_ + 20), 0);
+
+	FESlowControlsArchive::readIndex(filePath, channels, blockIndex);
+	BOOST_REQUIRE_EQUAL(blockIndex.size(), 2);  // complete blocks only
+	BOOST_CHECK_EQUAL(blockIndex[1].lastTimeMs_, 1700);
+	BOOST_CHECK_EQUAL(extract(filePath, "", ANY_START_TIME, ANY_END_TIME).size(), 8);
+
+	remove(filePath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(invalid_file)
+{
+	const std::string filePath = getArchiveFilePath("invalid");
+	FILE*             fp       = fopen(filePath.c_str(), "wb");
+	BOOST_REQUIRE(fp);
+	fputs("not an archive", fp);
+	fclose(fp);
+
+	std::vector<FESlowControlsArchive::channelInfo_t> channels;
+	std::vector<FESlowControlsArchive::blockIndex_t>  blockIndex;
+	BOOST_CHECK_THROW(FESlowControlsArchive::readIndex(filePath, channels, blockIndex), std::runtime_error);
+	BOOST_CHECK_THROW(FESlowControlsArchive::readIndex(filePath + ".missing", channels, blockIndex), std::runtime_error);
+
+	remove(filePath.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,120 @@
+#define BOOST_TEST_MODULE (slowcontrolstxpacket test)
+
+#include "boost/test/auto_unit_test.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "otsdaq/FECore/FESlowControlsTxPacket.h"
+
+using namespace ots;
+
+BOOST_AUTO_TEST_SUITE(slowcontrolstxpacket_test)
+
+BOOST_AUTO_TEST_CASE(dictionary_round_trip)
+{
+	std::vector<FESlowControlsTxPacket::channelInfo_t> channels(2);
+	channels[0].name_      = "FE0:temperature";
+	channels[0].sizeBytes_ = 8;
+	channels[0].sizeBits_  = 64;
+	channels[1].name_      = "FE0:status";
+	channels[1].sizeBytes_ = 2;
+	channels[1].sizeBits_  = 12;
+
+	std::string packet;
+	FESlowControlsTxPacket::appendHeader(packet, FESlowControlsTxPacket::DICTIONARY_PACKET_TYPE, 7 /*sequenceNumber*/, 1700000000123LL);
+	BOOST_CHECK_EQUAL(packet.size(), (size_t)FESlowControlsTxPacket::HEADER_SIZE);
+	for(uint16_t i = 0; i < channels.size(); ++i)
+		FESlowControlsTxPacket::appendDictionaryEntry(packet, 100 + i, channels[i]);
+
+	BOOST_CHECK(FESlowControlsTxPacket::isPacked(packet));
+
+	std::map<uint16_t, FESlowControlsTxPacket::channelInfo_t> dictionary;
+	std::vector<FESlowControlsTxPacket::record_t>              records;
+	FESlowControlsTxPacket::header_t                           header = FESlowControlsTxPacket::decode(packet, dictionary, records);
+
+	BOOST_CHECK_EQUAL((unsigned int)header.packetType_, (unsigned int)FESlowControlsTxPacket::DICTIONARY_PACKET_TYPE);
+	BOOST_CHECK_EQUAL((unsigned int)header.version_, (unsigned int)FESlowControlsTxPacket::VERSION);
+	BOOST_CHECK_EQUAL(header.sequenceNumber_, 7);
+	BOOST_CHECK_EQUAL(header.timeMs_, 1700000000123LL);
+	BOOST_CHECK(records.empty());
+
+	BOOST_REQUIRE_EQUAL(dictionary.size(), 2);
+	BOOST_CHECK_EQUAL(dictionary[100].name_, "FE0:temperature");
+	BOOST_CHECK_EQUAL((unsigned int)dictionary[100].sizeBytes_, 8);
+	BOOST_CHECK_EQUAL(dictionary[101].name_, "FE0:status");
+	BOOST_CHECK_EQUAL((unsigned int)dictionary[101].sizeBits_, 12);
+}
+
+BOOST_AUTO_TEST_CASE(samples_round_trip)
+{
+	double      temperature = 21.5;
+	std::string status("\x34\x12", 2);
+	std::string threshold("\x00\x00\x00\x00\x00\x00\x39\x40", 8);  // 25.0
+
+	std::string packet;
+	FESlowControlsTxPacket::appendHeader(packet, FESlowControlsTxPacket::SAMPLES_PACKET_TYPE, 0xFFFFFFFF /*sequenceNumber*/, 5);
+	FESlowControlsTxPacket::appendRecord(packet, 100, 0 /*value*/, std::string((const char*)&temperature, sizeof(temperature)));
+	FESlowControlsTxPacket::appendRecord(packet, 101, 0 /*value*/, status);
+	FESlowControlsTxPacket::appendRecord(packet, 100, 3 /*hi alarm*/, threshold);
+	FESlowControlsTxPacket::appendRecord(packet, 0xFFFF, 0 /*value*/, "");
+	BOOST_CHECK_EQUAL(packet.size(), FESlowControlsTxPacket::HEADER_SIZE + 4 * 4 + 8 + 2 + 8);
+
+	std::map<uint16_t, FESlowControlsTxPacket::channelInfo_t> dictionary;
+	std::vector<FESlowControlsTxPacket::record_t>              records;
+	FESlowControlsTxPacket::header_t                           header = FESlowControlsTxPacket::decode(packet, dictionary, records);
+
+	BOOST_CHECK_EQUAL((unsigned int)header.packetType_, (unsigned int)FESlowControlsTxPacket::SAMPLES_PACKET_TYPE);
+	BOOST_CHECK_EQUAL(header.sequenceNumber_, 0xFFFFFFFF);
+	BOOST_CHECK_EQUAL(header.timeMs_, 5);
+	BOOST_CHECK(dictionary.empty());
+
+	BOOST_REQUIRE_EQUAL(records.size(), 4);
+	BOOST_CHECK_EQUAL(records[0].channelId_, 100);
+	BOOST_CHECK_EQUAL((unsigned int)records[0].type_, 0);
+	BOOST_CHECK(records[0].value_ == std::string((const char*)&temperature, sizeof(temperature)));
+	BOOST_CHECK_EQUAL(records[1].channelId_, 101);
+	BOOST_CHECK(records[1].value_ == status);
+	BOOST_CHECK_EQUAL((unsigned int)records[2].type_, 3);
+	BOOST_CHECK(records[2].value_ == threshold);
+	BOOST_CHECK_EQUAL(records[3].channelId_, 0xFFFF);
+	BOOST_CHECK(records[3].value_.empty());
+}
+
+BOOST_AUTO_TEST_CASE(invalid_packets)
+{
+	std::map<uint16_t, FESlowControlsTxPacket::channelInfo_t> dictionary;
+	std::vector<FESlowControlsTxPacket::record_t>              records;
+
+	// legacy packets start with the record type 0-4
+	std::string legacyPacket(1, '\0');
+	BOOST_CHECK(!FESlowControlsTxPacket::isPacked(legacyPacket));
+	BOOST_CHECK(!FESlowControlsTxPacket::isPacked(""));
+	BOOST_CHECK_THROW(FESlowControlsTxPacket::decode(legacyPacket, dictionary, records), std::runtime_error);
+
+	std::string packet;
+	FESlowControlsTxPacket::appendHeader(packet, FESlowControlsTxPacket::SAMPLES_PACKET_TYPE, 1);
+	BOOST_CHECK_THROW(FESlowControlsTxPacket::decode(packet.substr(0, FESlowControlsTxPacket::HEADER_SIZE - 1), dictionary, records), std::runtime_error);
+
+	// truncated record value
+	FESlowControlsTxPacket::appendRecord(packet, 1, 0, "12345678");
+	BOOST_CHECK_THROW(FESlowControlsTxPacket::decode(packet.substr(0, packet.size() - 1), dictionary, records), std::runtime_error);
+
+	// unknown version
+	packet[1] = FESlowControlsTxPacket::VERSION + 1;
+	BOOST_CHECK_THROW(FESlowControlsTxPacket::decode(packet, dictionary, records), std::runtime_error);
+
+	// truncated dictionary name
+	FESlowControlsTxPacket::channelInfo_t channelInfo;
+	channelInfo.name_      = "FE0:status";
+	channelInfo.sizeBytes_ = 2;
+	channelInfo.sizeBits_  = 16;
+	packet.clear();
+	FESlowControlsTxPacket::appendHeader(packet, FESlowControlsTxPacket::DICTIONARY_PACKET_TYPE, 1);
+	FESlowControlsTxPacket::appendDictionaryEntry(packet, 1, channelInfo);
+	BOOST_CHECK_THROW(FESlowControlsTxPacket::decode(packet.substr(0, packet.size() - 1), dictionary, records), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
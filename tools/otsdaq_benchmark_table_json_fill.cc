@@ -0,0 +1,104 @@
+#include "otsdaq/MessageFacility/MessageFacility.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "otsdaq/ConfigurationInterface/ConfigurationManagerRW.h"
+#include "otsdaq/TableCore/TableBase.h"
+
+// usage:
+// otsdaq_benchmark_table_json_fill <table_name> <table_version> <iterations (optional)>
+//
+// Micro-benchmark comparing TableView::fillFromJSONLegacy() and TableView::fillFromJSON()
+//	on the JSON of an existing table version (e.g. the largest tables of a system).
+//	The filled views are compared to verify both parsers produce the same content.
+
+#define TRACE_NAME "BenchmarkTableJSONFill"
+
+#undef	__COUT__
+#define __COUT__			std::cout << __MF_DECOR__ << __COUT_HDR_FL__
+
+using namespace ots;
+
+//==============================================================================
+// timeFill
+//	returns average seconds per fill, and leaves last filled view in filledView
+double timeFill(TableBase* table, const TableVersion& version, const std::string& json, unsigned int iterations, bool useLegacy, std::unique_ptr<TableView>& filledView)
+{
+	double totalSeconds = 0;
+	for(unsigned int i = 0; i < iterations; ++i)
+	{
+		// fill a fresh view from the mockup, as ConfigurationInterface does
+		filledView.reset(new TableView(table->getTableName()));
+		filledView->copy(*table->getMockupViewP(), version, table->getMockupViewP()->getAuthor());
+
+		auto startTime = std::chrono::steady_clock::now();
+		int  retVal    = useLegacy ? filledView->fillFromJSONLegacy(json) : filledView->fillFromJSON(json);
+		totalSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		if(retVal < 0)
+		{
+			__SS__ << (useLegacy ? "Legacy" : "Single-pass") << " fill failed for " << table->getTableName() << "-v" << version << __E__;
+			__SS_THROW__;
+		}
+	}
+	return iterations ? totalSeconds / iterations : 0;
+}  // end timeFill()
+
+//==============================================================================
+void BenchmarkTableJSONFill(int argc, char* argv[])
+{
+	// The configuration uses __ENV__("SERVICE_DATA_PATH") in init() so define it if it is not defined
+	if(getenv("SERVICE_DATA_PATH") == NULL)
+		setenv("SERVICE_DATA_PATH", (std::string(__ENV__("USER_DATA")) + "/ServiceData").c_str(), 1);
+
+	__COUT__ << "\n\nusage: Three arguments:\n\t <table_name> <table_version> <iterations (optional, default 10)>" << std::endl << std::endl;
+
+	if(argc < 3)
+	{
+		__COUT__ << "\n\nError! Must provide at least 2 parameters.\n\n" << std::endl;
+		return;
+	}
+
+	std::string  tableName  = argv[1];
+	TableVersion version    = TableVersion(atoi(argv[2]));
+	unsigned int iterations = argc > 3 ? atoi(argv[3]) : 10;
+
+	ConfigurationManagerRW cfgMgr("benchmark_admin");
+	cfgMgr.getAllTableInfo(true /* refresh */);
+
+	TableBase* table = cfgMgr.getVersionedTableByName(tableName, version);
+
+	std::stringstream jsonSs;
+	table->getView().printJSON(jsonSs);
+	const std::string json = jsonSs.str();
+
+	__COUT__ << "Table " << tableName << "-v" << version << ": " << table->getView().getNumberOfRows() << " rows x "
+	         << table->getView().getNumberOfColumns() << " columns, JSON size " << json.size() << " bytes, " << iterations << " iterations." << __E__;
+
+	std::unique_ptr<TableView> legacyView, singlePassView;
+	double legacySeconds     = timeFill(table, version, json, iterations, true /* useLegacy */, legacyView);
+	double singlePassSeconds = timeFill(table, version, json, iterations, false /* useLegacy */, singlePassView);
+
+	__COUT__ << "Legacy fill:      " << legacySeconds * 1000. << " ms/fill" << __E__;
+	__COUT__ << "Single-pass fill: " << singlePassSeconds * 1000. << " ms/fill" << __E__;
+	if(singlePassSeconds > 0)
+		__COUT__ << "Speedup: " << legacySeconds / singlePassSeconds << "x" << __E__;
+
+	if(legacyView && singlePassView)
+		__COUT__ << "Filled views " << (legacyView->getDataView() == singlePassView->getDataView() ? "match." : "DO NOT MATCH!") << __E__;
+}  // end BenchmarkTableJSONFill()
+
+int main(int argc, char* argv[])
+{
+	if(getenv("OTSDAQ_LOG_FHICL") == NULL)
+		setenv("OTSDAQ_LOG_FHICL", (std::string(__ENV__("USER_DATA")) + "/MessageFacilityConfigurations/MessageFacilityWithCout.fcl").c_str(), 1);
+
+	if(getenv("OTSDAQ_LOG_ROOT") == NULL)
+		setenv("OTSDAQ_LOG_ROOT", (std::string(__ENV__("USER_DATA")) + "/Logs").c_str(), 1);
+
+	BenchmarkTableJSONFill(argc, argv);
+	return 0;
+}
@@ -0,0 +1,136 @@
+#define TRACE_NAME "RawDataFileReader"
+
+#include "otsdaq/DataManager/RawDataIndexedFile.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// usage:
+// otsdaq_raw_data_file_reader <indexed_file> <first_packet (optional)> <number_of_packets (optional)> <output_file (optional)>
+// otsdaq_raw_data_file_reader <indexed_file> -t <start_time> <end_time (optional)> <output_file (optional)>
+//
+// times are in seconds since epoch (fractional seconds allowed)
+// if no packets are selected, the block index is printed
+// if no output file is given, packet sizes are printed, otherwise packets are
+//	written to the output file as a flat raw data file (file header, packets, file footer)
+
+using namespace ots;
+
+int main(int argc, char* argv[])
+{
+	if(argc < 2)
+	{
+		std::cout << "\n\nusage: One to five arguments:\n\t <indexed_file> <first_packet (optional)> <number_of_packets (optional)> <output_file (optional)>\n"
+		          << "\t <indexed_file> -t <start_time> <end_time (optional)> <output_file (optional)>\n\n"
+		          << "\t Times are in seconds since epoch. If no packets are selected, the block index is printed. "
+		          << "If an output file is given, the selected packets are written to it as a flat raw data file.\n"
+		          << std::endl;
+		return 0;
+	}
+
+	std::string filePath = argv[1];
+
+	try
+	{
+		RawDataIndexedFileReader reader(filePath);
+
+		if(argc < 3)  // print block index
+		{
+			std::cout << "Blocks (" << reader.getBlockIndex().size() << ")" << (reader.wasClosedCleanly() ? "" : ", file was not closed cleanly") << ":"
+			          << std::endl;
+			for(const auto& block : reader.getBlockIndex())
+				std::cout << "\t@" << block.offset_ << "\tpackets " << block.firstPacketNumber_ << " - " << block.firstPacketNumber_ + block.numberOfPackets_ - 1
+				          << "\t" << std::fixed << std::setprecision(3) << block.firstTimeMs_ / 1000. << " - " << block.lastTimeMs_ / 1000. << std::endl;
+			std::cout << "Total packets: " << reader.getNumberOfPackets() << std::endl;
+			return 0;
+		}
+
+		uint64_t    firstPacket = 0, endPacket = reader.getNumberOfPackets();
+		std::string outputPath;
+		if(std::string(argv[2]) == "-t")
+		{
+			int64_t startTimeMs = argc > 3 ? llround(strtod(argv[3], 0) * 1000.) : 0;
+			int64_t endTimeMs   = argc > 4 ? llround(strtod(argv[4], 0) * 1000.) : -1;
+			if(argc > 5)
+				outputPath = argv[5];
+
+			// the index only has the time range of each block, so whole blocks
+			//	overlapping the time range are selected
+			size_t startBlock = reader.findBlockByTime(startTimeMs);
+			if(startBlock == RawDataIndexedFileReader::NOT_FOUND)
+				firstPacket = endPacket;
+			else
+				firstPacket = reader.getBlockIndex()[startBlock].firstPacketNumber_;
+			if(endTimeMs >= 0)
+			{
+				size_t endBlock = reader.findBlockByTime(endTimeMs + 1);
+				if(endBlock != RawDataIndexedFileReader::NOT_FOUND)
+				{
+					const auto& block = reader.getBlockIndex()[endBlock];
+					if(block.firstTimeMs_ > endTimeMs)  // block starts after time range
+						endPacket = block.firstPacketNumber_;
+					else
+						endPacket = block.firstPacketNumber_ + block.numberOfPackets_;
+				}
+				if(endPacket < firstPacket)
+					endPacket = firstPacket;
+			}
+			if(endPacket > firstPacket)
+				std::cout << "Packets of blocks in time range: " << firstPacket << " - " << endPacket - 1 << std::endl;
+			else
+				std::cout << "No blocks in time range." << std::endl;
+		}
+		else
+		{
+			firstPacket = strtoull(argv[2], 0, 0);
+			endPacket   = firstPacket + (argc > 3 ? strtoull(argv[3], 0, 0) : 1);
+			if(argc > 4)
+				outputPath = argv[4];
+		}
+
+		std::ofstream output;
+		if(outputPath != "")
+		{
+			output.open(outputPath, std::ios::out | std::ios::binary);
+			if(!output.is_open())
+			{
+				std::cout << "Failed to open output file: " << outputPath << std::endl;
+				return 1;
+			}
+			output.write(reader.getFileHeader().data(), reader.getFileHeader().size());
+		}
+
+		std::string packet;
+		for(uint64_t packetNumber = firstPacket; packetNumber < endPacket && reader.readPacket(packetNumber, packet); ++packetNumber)
+		{
+			if(output.is_open())
+				output.write(packet.data(), packet.size());
+			else
+				std::cout << "\t" << packetNumber << "\t" << packet.size() << " bytes" << std::endl;
+		}
+
+		if(output.is_open())
+		{
+			output.write(reader.getFileFooter().data(), reader.getFileFooter().size());
+			output.close();
+			if(!output)
+			{
+				std::cout << "Failed to write output file: " << outputPath << std::endl;
+				return 1;
+			}
+		}
+	}
+	catch(const std::runtime_error& e)
+	{
+		std::cout << "Error reading raw data indexed file: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}  // end main()
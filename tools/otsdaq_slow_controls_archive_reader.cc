@@ -0,0 +1,95 @@
+#define TRACE_NAME "SlowControlsArchiveReader"
+
+#include "otsdaq/FECore/FESlowControlsArchive.h"
+#include "otsdaq/Macros/CoutMacros.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// usage:
+// otsdaq_slow_controls_archive_reader <archive_file> <channel_name (optional)> <start_time (optional)> <end_time (optional)>
+//
+// times are in seconds since epoch (fractional seconds allowed)
+// if no channel name is given, the channel dictionary and block index are printed
+// if channel name is "*", all channels are extracted
+
+using namespace ots;
+
+int main(int argc, char* argv[])
+{
+	if(argc < 2)
+	{
+		std::cout << "\n\nusage: One to four arguments:\n\t <archive_file> <channel_name (optional)> <start_time (optional)> <end_time (optional)>\n\n"
+		          << "\t Times are in seconds since epoch. If no channel name is given, the channel dictionary and block index are printed. "
+		          << "Use channel name \"*\" to extract all channels.\n"
+		          << std::endl;
+		return 0;
+	}
+
+	std::string filePath = argv[1];
+
+	try
+	{
+		if(argc < 3)  // print dictionary and block index
+		{
+			std::vector<FESlowControlsArchive::channelInfo_t> channels;
+			std::vector<FESlowControlsArchive::blockIndex_t>  blockIndex;
+			FESlowControlsArchive::readIndex(filePath, channels, blockIndex);
+
+			std::cout << "Channels (" << channels.size() << "):" << std::endl;
+			for(size_t i = 0; i < channels.size(); ++i)
+				std::cout << "\t" << i << "\t" << channels[i].name_ << "\t" << channels[i].dataType_ << "\t" << (unsigned int)channels[i].sizeBytes_ << "B "
+				          << (unsigned int)channels[i].sizeBits_ << "b" << std::endl;
+
+			unsigned long long numberOfRecords = 0;
+			std::cout << "Blocks (" << blockIndex.size() << "):" << std::endl;
+			for(const auto& block : blockIndex)
+			{
+				std::cout << "\t@" << block.offset_ << "\t" << block.numberOfRecords_ << " records\t" << std::fixed << std::setprecision(3)
+				          << block.firstTimeMs_ / 1000. << " - " << block.lastTimeMs_ / 1000. << std::endl;
+				numberOfRecords += block.numberOfRecords_;
+			}
+			std::cout << "Total records: " << numberOfRecords << std::endl;
+			return 0;
+		}
+
+		std::string channelName = argv[2];
+		if(channelName == "*")
+			channelName = "";
+
+		int64_t startTimeMs = std::numeric_limits<int64_t>::min();
+		int64_t endTimeMs   = std::numeric_limits<int64_t>::max();
+		if(argc > 3)
+			startTimeMs = llround(strtod(argv[3], 0) * 1000.);
+		if(argc > 4)
+			endTimeMs = llround(strtod(argv[4], 0) * 1000.);
+
+		// print as text: time, channel name, type, value
+		FESlowControlsArchive::extract(
+		    filePath,
+		    channelName,
+		    startTimeMs,
+		    endTimeMs,
+		    [](const FESlowControlsArchive::channelInfo_t& channelInfo, const FESlowControlsArchive::record_t& record) {
+			    std::cout << record.timeMs_ / 1000 << "." << std::to_string(1000 + record.timeMs_ % 1000).substr(1) << "\t" << channelInfo.name_ << "\t"
+			              << (unsigned int)record.type_ << "\t" << FESlowControlsArchive::valueToString(channelInfo, record) << "\n";
+			    if(!std::cout)  // e.g. disk full or closed pipe, so stop extracting
+				    throw std::runtime_error("Failed to write extracted record of channel '" + channelInfo.name_ + "' to output.");
+		    });
+
+		if(!std::cout.flush())
+			throw std::runtime_error("Failed to write extracted records to output.");
+	}
+	catch(const std::runtime_error& e)
+	{
+		std::cerr << "Error extracting slow controls archive: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}  // end main()